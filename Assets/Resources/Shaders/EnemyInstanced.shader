@@ -0,0 +1,215 @@
+Shader "Custom/EnemyInstanced"
+{
+    // Opaque enemy mesh drawn by EnemyRenderManager with Graphics.RenderMeshInstanced.
+    // Per-instance tint (EnemyColorVariant) and hit flash come from instanced properties, so a
+    // whole enemy type is one draw call however its instances are coloured. The walk pose
+    // (squash/stretch, wobble, bounce) arrives through the instance matrix.
+    Properties
+    {
+        [MainTexture] _BaseMap ("Base Map", 2D) = "white" {}
+        [MainColor] _BaseColor ("Base Color", Color) = (1,1,1,1)
+        _FlashColor ("Hit Flash Color", Color) = (1,1,1,1)
+    }
+
+    SubShader
+    {
+        Tags
+        {
+            "RenderType"="Opaque"
+            "Queue"="Geometry"
+            "RenderPipeline"="UniversalPipeline"
+        }
+
+        HLSLINCLUDE
+        #include "Packages/com.unity.render-pipelines.universal/ShaderLibrary/Core.hlsl"
+
+        TEXTURE2D(_BaseMap);
+        SAMPLER(sampler_BaseMap);
+
+        CBUFFER_START(UnityPerMaterial)
+            float4 _BaseMap_ST;
+            half4 _BaseColor;
+            half4 _FlashColor;
+        CBUFFER_END
+
+        UNITY_INSTANCING_BUFFER_START(EnemyInstanceProps)
+            UNITY_DEFINE_INSTANCED_PROP(half4, _InstanceTint)
+            UNITY_DEFINE_INSTANCED_PROP(half, _InstanceFlash)
+        UNITY_INSTANCING_BUFFER_END(EnemyInstanceProps)
+        ENDHLSL
+
+        Pass
+        {
+            Name "ForwardLit"
+            Tags { "LightMode" = "UniversalForward" }
+
+            HLSLPROGRAM
+            #pragma vertex EnemyVert
+            #pragma fragment EnemyFrag
+            #pragma multi_compile_instancing
+            #pragma multi_compile _ _MAIN_LIGHT_SHADOWS _MAIN_LIGHT_SHADOWS_CASCADE
+            #pragma multi_compile _ _ADDITIONAL_LIGHTS_VERTEX _ADDITIONAL_LIGHTS
+            #pragma multi_compile _ _ADDITIONAL_LIGHT_SHADOWS
+            #pragma multi_compile_fog
+
+            #include "Packages/com.unity.render-pipelines.universal/ShaderLibrary/Lighting.hlsl"
+
+            struct Attributes
+            {
+                float4 positionOS : POSITION;
+                float3 normalOS : NORMAL;
+                float2 uv : TEXCOORD0;
+                UNITY_VERTEX_INPUT_INSTANCE_ID
+            };
+
+            struct Varyings
+            {
+                float4 positionCS : SV_POSITION;
+                float2 uv : TEXCOORD0;
+                float3 positionWS : TEXCOORD1;
+                half3 normalWS : TEXCOORD2;
+                half fogFactor : TEXCOORD3;
+                UNITY_VERTEX_INPUT_INSTANCE_ID
+            };
+
+            Varyings EnemyVert(Attributes input)
+            {
+                Varyings output;
+                UNITY_SETUP_INSTANCE_ID(input);
+                UNITY_TRANSFER_INSTANCE_ID(input, output);
+
+                VertexPositionInputs positions = GetVertexPositionInputs(input.positionOS.xyz);
+                output.positionCS = positions.positionCS;
+                output.positionWS = positions.positionWS;
+                output.normalWS = TransformObjectToWorldNormal(input.normalOS);
+                output.uv = TRANSFORM_TEX(input.uv, _BaseMap);
+                output.fogFactor = ComputeFogFactor(positions.positionCS.z);
+                return output;
+            }
+
+            half4 EnemyFrag(Varyings input) : SV_Target
+            {
+                UNITY_SETUP_INSTANCE_ID(input);
+
+                half4 tint = UNITY_ACCESS_INSTANCED_PROP(EnemyInstanceProps, _InstanceTint);
+                half flash = UNITY_ACCESS_INSTANCED_PROP(EnemyInstanceProps, _InstanceFlash);
+                half3 albedo = SAMPLE_TEXTURE2D(_BaseMap, sampler_BaseMap, input.uv).rgb * _BaseColor.rgb * tint.rgb;
+
+                // Lambert main light plus ambient probe - enough for small top-down meshes
+                half3 normalWS = normalize(input.normalWS);
+                Light mainLight = GetMainLight(TransformWorldToShadowCoord(input.positionWS));
+                half3 lighting = mainLight.color * (saturate(dot(normalWS, mainLight.direction)) * mainLight.shadowAttenuation)
+                    + SampleSH(normalWS);
+
+                // Point and spot lights (pickups, effects) the same way, per pixel in either mode
+                #if defined(_ADDITIONAL_LIGHTS) || defined(_ADDITIONAL_LIGHTS_VERTEX)
+                uint lightCount = GetAdditionalLightsCount();
+                for (uint lightIndex = 0u; lightIndex < lightCount; ++lightIndex)
+                {
+                    Light light = GetAdditionalLight(lightIndex, input.positionWS, half4(1, 1, 1, 1));
+                    lighting += light.color * (saturate(dot(normalWS, light.direction))
+                        * light.distanceAttenuation * light.shadowAttenuation);
+                }
+                #endif
+
+                half3 color = lerp(albedo * lighting, _FlashColor.rgb, flash);
+                color = MixFog(color, input.fogFactor);
+                return half4(color, 1.0);
+            }
+            ENDHLSL
+        }
+
+        Pass
+        {
+            Name "ShadowCaster"
+            Tags { "LightMode" = "ShadowCaster" }
+
+            ZWrite On
+            ZTest LEqual
+            ColorMask 0
+
+            HLSLPROGRAM
+            #pragma vertex ShadowVert
+            #pragma fragment ShadowFrag
+            #pragma multi_compile_instancing
+            #pragma multi_compile_vertex _ _CASTING_PUNCTUAL_LIGHT_SHADOW
+
+            #include "Packages/com.unity.render-pipelines.universal/ShaderLibrary/Shadows.hlsl"
+
+            float3 _LightDirection;
+            float3 _LightPosition;
+
+            struct Attributes
+            {
+                float4 positionOS : POSITION;
+                float3 normalOS : NORMAL;
+                UNITY_VERTEX_INPUT_INSTANCE_ID
+            };
+
+            float4 ShadowVert(Attributes input) : SV_POSITION
+            {
+                UNITY_SETUP_INSTANCE_ID(input);
+
+                float3 positionWS = TransformObjectToWorld(input.positionOS.xyz);
+                float3 normalWS = TransformObjectToWorldNormal(input.normalOS);
+
+                // Point/spot shadow maps bias toward the light itself, as URP's ShadowCasterPass does
+                #if _CASTING_PUNCTUAL_LIGHT_SHADOW
+                float3 lightDirectionWS = normalize(_LightPosition - positionWS);
+                #else
+                float3 lightDirectionWS = _LightDirection;
+                #endif
+                float4 positionCS = TransformWorldToHClip(ApplyShadowBias(positionWS, normalWS, lightDirectionWS));
+
+                #if UNITY_REVERSED_Z
+                positionCS.z = min(positionCS.z, UNITY_NEAR_CLIP_VALUE);
+                #else
+                positionCS.z = max(positionCS.z, UNITY_NEAR_CLIP_VALUE);
+                #endif
+                return positionCS;
+            }
+
+            half4 ShadowFrag() : SV_Target
+            {
+                return 0;
+            }
+            ENDHLSL
+        }
+
+        // Depth prepass / depth texture (SSAO, soft particles, camera depth copies)
+        Pass
+        {
+            Name "DepthOnly"
+            Tags { "LightMode" = "DepthOnly" }
+
+            ZWrite On
+            ColorMask R
+
+            HLSLPROGRAM
+            #pragma vertex DepthVert
+            #pragma fragment DepthFrag
+            #pragma multi_compile_instancing
+
+            struct Attributes
+            {
+                float4 positionOS : POSITION;
+                UNITY_VERTEX_INPUT_INSTANCE_ID
+            };
+
+            float4 DepthVert(Attributes input) : SV_POSITION
+            {
+                UNITY_SETUP_INSTANCE_ID(input);
+                return TransformObjectToHClip(input.positionOS.xyz);
+            }
+
+            // Some platforms copy depth through a colour target, so write it like URP's DepthOnly
+            half DepthFrag(float4 positionCS : SV_POSITION) : SV_Target
+            {
+                return positionCS.z;
+            }
+            ENDHLSL
+        }
+    }
+
+    Fallback Off
+}
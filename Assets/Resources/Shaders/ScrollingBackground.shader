@@ -0,0 +1,186 @@
+Shader "Custom/ScrollingBackground"
+{
+    // Endless ground drawn by InfiniteBackground as one quad. The vertex shader places the quad's
+    // four corners where the camera's frustum corners hit the ground plane (the object's world z),
+    // so it always covers exactly the view without any per-frame transform work, for perspective
+    // and orthographic cameras alike. The texture repeats in world space; a low-frequency value
+    // noise and an optional parallax layer break up the visible tiling period.
+    // Lit in the forward pass like EnemyInstanced: main light, ambient probe and additional lights
+    // on a flat ground normal facing the camera.
+    Properties
+    {
+        [MainTexture] _MainTex ("Tile Texture", 2D) = "white" {}
+        [MainColor] _Color ("Tint", Color) = (1,1,1,1)
+        _SpriteRect ("Sprite Rect (UV offset xy, scale zw)", Vector) = (0,0,1,1)
+        _TileParams ("Tile (size xy, centre zw)", Vector) = (10,10,0,0)
+        _NoiseParams ("Noise (scale, strength)", Vector) = (23,0.08,0,0)
+        _DetailTex ("Parallax Layer", 2D) = "white" {}
+        _DetailParams ("Parallax (tile size, camera factor, strength)", Vector) = (10,0.3,0,0)
+    }
+
+    SubShader
+    {
+        Tags
+        {
+            "Queue"="Transparent"
+            "IgnoreProjector"="True"
+            "RenderType"="Transparent"
+            "PreviewType"="Plane"
+            "RenderPipeline"="UniversalPipeline"
+        }
+
+        // Corner winding flips with the projection (render textures), so draw both faces
+        Cull Off
+        ZWrite Off
+        Blend SrcAlpha OneMinusSrcAlpha
+
+        Pass
+        {
+            Name "ScrollingBackground"
+            Tags { "LightMode" = "UniversalForward" }
+
+            HLSLPROGRAM
+            #pragma vertex BackgroundVert
+            #pragma fragment BackgroundFrag
+            #pragma multi_compile _ _ADDITIONAL_LIGHTS_VERTEX _ADDITIONAL_LIGHTS
+            #pragma multi_compile_fog
+
+            #include "Packages/com.unity.render-pipelines.universal/ShaderLibrary/Core.hlsl"
+            #include "Packages/com.unity.render-pipelines.universal/ShaderLibrary/Lighting.hlsl"
+
+            struct Attributes
+            {
+                float3 positionOS : POSITION;   // Frustum corner in NDC (-1..1), see InfiniteBackground
+            };
+
+            struct Varyings
+            {
+                float4 positionCS : SV_POSITION;
+                float3 positionWS : TEXCOORD0;
+                half fogFactor : TEXCOORD1;
+            };
+
+            TEXTURE2D(_MainTex);
+            SAMPLER(sampler_MainTex);
+            TEXTURE2D(_DetailTex);
+            SAMPLER(sampler_DetailTex);
+
+            CBUFFER_START(UnityPerMaterial)
+                half4 _Color;
+                float4 _SpriteRect;
+                float4 _TileParams;
+                float4 _NoiseParams;
+                float4 _DetailParams;
+            CBUFFER_END
+
+            // Slightly past the frustum edge so the corners never leave a gap
+            #define CORNER_OVERSCAN 1.02
+
+            // The game plays on the XY plane with the camera on the -z side
+            #define GROUND_NORMAL half3(0, 0, -1)
+
+            Varyings BackgroundVert(Attributes input)
+            {
+                Varyings output;
+
+                float2 ndc = input.positionOS.xy * CORNER_OVERSCAN;
+                float3 right = UNITY_MATRIX_I_V._m00_m10_m20;
+                float3 up = UNITY_MATRIX_I_V._m01_m11_m21;
+                float3 forward = -UNITY_MATRIX_I_V._m02_m12_m22;    // View space looks down -z
+
+                float3 origin;
+                float3 direction;
+                if (unity_OrthoParams.w > 0.5)
+                {
+                    origin = _WorldSpaceCameraPos + right * (ndc.x * unity_OrthoParams.x) + up * (ndc.y * unity_OrthoParams.y);
+                    direction = forward;
+                }
+                else
+                {
+                    origin = _WorldSpaceCameraPos;
+                    direction = forward + right * (ndc.x / UNITY_MATRIX_P._m00) + up * (ndc.y / UNITY_MATRIX_P._m11);
+                }
+
+                // Hit the ground plane; rays at or above the horizon stop just short of the far plane
+                float planeZ = UNITY_MATRIX_M._m23;
+                float maxT = _ProjectionParams.z * 0.95 / length(direction);
+                float toPlane = planeZ - origin.z;
+                float t = toPlane * direction.z > 0.0 ? min(toPlane / direction.z, maxT) : maxT;
+
+                output.positionWS = origin + direction * t;
+                output.positionCS = TransformWorldToHClip(output.positionWS);
+                output.fogFactor = ComputeFogFactor(output.positionCS.z);
+                return output;
+            }
+
+            float Hash21(float2 p)
+            {
+                p = frac(p * float2(123.34, 456.21));
+                p += dot(p, p + 45.32);
+                return frac(p.x * p.y);
+            }
+
+            float ValueNoise(float2 p)
+            {
+                float2 cell = floor(p);
+                float2 f = frac(p);
+                float2 u = f * f * (3.0 - 2.0 * f);
+                return lerp(lerp(Hash21(cell), Hash21(cell + float2(1, 0)), u.x),
+                            lerp(Hash21(cell + float2(0, 1)), Hash21(cell + float2(1, 1)), u.x), u.y);
+            }
+
+            // Repeat inside a sub-rect of the texture; gradients come from the unwrapped UV so the
+            // wrap doesn't drop to the smallest mip along tile edges
+            half4 SampleTiled(TEXTURE2D_PARAM(tex, samplerTex), float2 uv, float4 rect)
+            {
+                float2 dx = ddx(uv) * rect.zw;
+                float2 dy = ddy(uv) * rect.zw;
+                return SAMPLE_TEXTURE2D_GRAD(tex, samplerTex, rect.xy + frac(uv) * rect.zw, dx, dy);
+            }
+
+            half4 BackgroundFrag(Varyings input) : SV_Target
+            {
+                float2 world = input.positionWS.xy;
+
+                // Tiles are centred on centre + n * size, like the old sprite grid
+                float2 uv = (world - _TileParams.zw) / _TileParams.xy + 0.5;
+                half4 color = SampleTiled(TEXTURE2D_ARGS(_MainTex, sampler_MainTex), uv, _SpriteRect) * _Color;
+
+                if (_NoiseParams.y > 0.0)
+                {
+                    float2 p = world / _NoiseParams.x;
+                    half noise = ValueNoise(p) * 0.65 + ValueNoise(p * 2.7 + 17.0) * 0.35;
+                    color.rgb *= 1.0 + (noise - 0.5) * 2.0 * _NoiseParams.y;
+                }
+
+                if (_DetailParams.z > 0.0)
+                {
+                    float2 detailUV = (world - _WorldSpaceCameraPos.xy * _DetailParams.y) / _DetailParams.x;
+                    half4 detail = SampleTiled(TEXTURE2D_ARGS(_DetailTex, sampler_DetailTex), detailUV, float4(0, 0, 1, 1));
+                    color.rgb = lerp(color.rgb, detail.rgb, detail.a * _DetailParams.z);
+                }
+
+                // Lambert on the flat ground; the corner-fitted quad has no stable per-vertex
+                // lighting, so vertex additional lights are evaluated per pixel as well
+                Light mainLight = GetMainLight();
+                half3 lighting = mainLight.color * saturate(dot(GROUND_NORMAL, mainLight.direction))
+                    + SampleSH(GROUND_NORMAL);
+
+                #if defined(_ADDITIONAL_LIGHTS) || defined(_ADDITIONAL_LIGHTS_VERTEX)
+                uint lightCount = GetAdditionalLightsCount();
+                for (uint lightIndex = 0u; lightIndex < lightCount; ++lightIndex)
+                {
+                    Light light = GetAdditionalLight(lightIndex, input.positionWS);
+                    lighting += light.color * (light.distanceAttenuation * saturate(dot(GROUND_NORMAL, light.direction)));
+                }
+                #endif
+
+                color.rgb = MixFog(color.rgb * lighting, input.fogFactor);
+                return color;
+            }
+            ENDHLSL
+        }
+    }
+
+    Fallback Off
+}
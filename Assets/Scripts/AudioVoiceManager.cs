@@ -0,0 +1,246 @@
+using UnityEngine;
+
+/// <summary>
+/// Category of a one-shot sound, used for per-category voice caps and priority
+/// </summary>
+public enum AudioVoiceCategory
+{
+    PlayerWeapon,
+    PlayerMovement,
+    EnemyWeapon,
+    EnemyMelee,
+    EnemyMovement,
+    Impact,
+    Pickup,
+    UI
+}
+
+/// <summary>
+/// Global voice limiter for procedural one-shot sounds.
+/// Every Procedural*Audio component plays through a fixed pool of shared AudioSources instead of
+/// its own, so a hundred enemies can't put hundreds of voices on the audio thread.
+/// Each category has a voice cap; when a category (or the whole pool) is full the weakest voice is
+/// stolen - the quietest and most played-out one, weighted by category - or the new sound is dropped
+/// if it is weaker still.
+/// Where ProceduralAudioMixer is supported the procedural generators post to it instead, and it
+/// applies the same caps and priorities on the audio thread.
+/// </summary>
+public class AudioVoiceManager : MonoBehaviour
+{
+    internal const int VoiceCount = 24;
+
+    // Positional sounds lose priority with distance from the player
+    internal const float MaxPriorityDistance = 30f;
+    private const float MinPriorityDistance = 3f;
+
+    // Indexed by AudioVoiceCategory
+    private static readonly int[] CategoryCaps = { 4, 2, 4, 3, 4, 4, 3, 3 };
+    private static readonly float[] CategoryWeights = { 1f, 0.7f, 0.8f, 0.8f, 0.3f, 0.6f, 0.9f, 1f };
+
+    private struct Voice
+    {
+        public AudioSource source;
+        public AudioVoiceCategory category;
+        public float priority;
+        public float startTime;
+        public float endTime;
+    }
+
+    private static AudioVoiceManager instance;
+    private Voice[] voices;
+    private Transform player;
+
+    /// <summary>
+    /// Number of voices currently playing
+    /// </summary>
+    public static int ActiveVoiceCount
+    {
+        get
+        {
+            if (instance == null) return ProceduralAudioMixer.ActiveVoiceCount;
+
+            float now = Time.unscaledTime;
+            int count = 0;
+            foreach (Voice v in instance.voices)
+            {
+                if (now < v.endTime) count++;
+            }
+            return count + ProceduralAudioMixer.ActiveVoiceCount;
+        }
+    }
+
+    /// <summary>
+    /// Play a 2D one-shot. Volume should already include any distance attenuation;
+    /// it doubles as the voice's priority.
+    /// Returns false if the sound was dropped by the voice limiter.
+    /// </summary>
+    public static bool Play(AudioClip clip, AudioVoiceCategory category, float volume, float pitch = 1f)
+    {
+        if (clip == null || volume <= 0.001f) return false;
+
+        EnsureInstance();
+        return instance.PlayInternal(clip, category, volume, pitch, GetPriority(category, volume), false, Vector3.zero, 0f);
+    }
+
+    /// <summary>
+    /// Play a one-shot at a world position with partial 3D falloff.
+    /// Priority drops with distance from the player.
+    /// </summary>
+    public static bool PlayAt(AudioClip clip, AudioVoiceCategory category, Vector3 position, float volume, float pitch = 1f, float spatialBlend = 0.5f)
+    {
+        if (clip == null || volume <= 0.001f) return false;
+
+        EnsureInstance();
+        return instance.PlayInternal(clip, category, volume, pitch, GetPriorityAt(category, position, volume), true, position, spatialBlend);
+    }
+
+    /// <summary>
+    /// Priority of a 2D sound: its volume weighted by category
+    /// </summary>
+    public static float GetPriority(AudioVoiceCategory category, float volume)
+    {
+        return volume * CategoryWeights[(int)category];
+    }
+
+    /// <summary>
+    /// Priority of a positional sound: GetPriority scaled down with distance from the player
+    /// </summary>
+    public static float GetPriorityAt(AudioVoiceCategory category, Vector3 position, float volume)
+    {
+        EnsureInstance();
+        return GetPriority(category, volume) * instance.GetDistanceFactor(position);
+    }
+
+    /// <summary>
+    /// Voices a category may hold at once
+    /// </summary>
+    public static int GetCategoryCap(AudioVoiceCategory category)
+    {
+        return CategoryCaps[(int)category];
+    }
+
+    private static void EnsureInstance()
+    {
+        if (instance != null) return;
+
+        GameObject obj = new GameObject("AudioVoiceManager");
+        DontDestroyOnLoad(obj);
+        instance = obj.AddComponent<AudioVoiceManager>();
+    }
+
+    void Awake()
+    {
+        voices = new Voice[VoiceCount];
+        for (int i = 0; i < VoiceCount; i++)
+        {
+            GameObject voiceObj = new GameObject("Voice " + i);
+            voiceObj.transform.SetParent(transform, false);
+
+            AudioSource source = voiceObj.AddComponent<AudioSource>();
+            source.playOnAwake = false;
+            source.loop = false;
+            source.spatialBlend = 0f;
+            source.rolloffMode = AudioRolloffMode.Linear;
+            source.maxDistance = MaxPriorityDistance;
+
+            voices[i].source = source;
+        }
+    }
+
+    private bool PlayInternal(AudioClip clip, AudioVoiceCategory category, float volume, float pitch, float priority,
+        bool positional, Vector3 position, float spatialBlend)
+    {
+        float now = Time.unscaledTime;
+
+        int inCategory = 0;
+        int free = -1;
+        int weakest = -1;
+        int weakestInCategory = -1;
+        float weakestScore = float.MaxValue;
+        float weakestCategoryScore = float.MaxValue;
+
+        for (int i = 0; i < voices.Length; i++)
+        {
+            Voice v = voices[i];
+            if (now >= v.endTime)
+            {
+                if (free < 0) free = i;
+                continue;
+            }
+
+            float score = GetScore(v, now);
+            if (score < weakestScore)
+            {
+                weakestScore = score;
+                weakest = i;
+            }
+
+            if (v.category == category)
+            {
+                inCategory++;
+                if (score < weakestCategoryScore)
+                {
+                    weakestCategoryScore = score;
+                    weakestInCategory = i;
+                }
+            }
+        }
+
+        int slot;
+        if (inCategory >= CategoryCaps[(int)category])
+        {
+            if (priority <= weakestCategoryScore) return false;
+            slot = weakestInCategory;
+        }
+        else if (free >= 0)
+        {
+            slot = free;
+        }
+        else
+        {
+            if (priority <= weakestScore) return false;
+            slot = weakest;
+        }
+
+        ref Voice voice = ref voices[slot];
+        AudioSource source = voice.source;
+        source.Stop();
+
+        source.transform.position = positional ? position : transform.position;
+        source.spatialBlend = positional ? spatialBlend : 0f;
+        source.clip = clip;
+        source.volume = volume;
+        source.pitch = pitch;
+        source.Play();
+
+        voice.category = category;
+        voice.priority = priority;
+        voice.startTime = now;
+        voice.endTime = now + clip.length / Mathf.Max(0.01f, Mathf.Abs(pitch));
+        return true;
+    }
+
+    /// <summary>
+    /// How much a playing voice is worth keeping: its priority scaled by the part still to play,
+    /// so quiet voices and voices near their end are stolen first
+    /// </summary>
+    private static float GetScore(Voice v, float now)
+    {
+        float duration = Mathf.Max(0.001f, v.endTime - v.startTime);
+        float remaining = Mathf.Clamp01((v.endTime - now) / duration);
+        return v.priority * remaining;
+    }
+
+    private float GetDistanceFactor(Vector3 position)
+    {
+        if (player == null)
+        {
+            GameObject playerObj = GameObject.FindGameObjectWithTag("Player");
+            if (playerObj == null) return 1f;
+            player = playerObj.transform;
+        }
+
+        float dist = Vector2.Distance(position, player.position);
+        return Mathf.Max(0.05f, Mathf.InverseLerp(MaxPriorityDistance, MinPriorityDistance, dist));
+    }
+}
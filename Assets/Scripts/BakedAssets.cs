@@ -0,0 +1,39 @@
+using UnityEngine;
+
+/// <summary>
+/// Textures and materials that used to be generated on startup, baked by ProceduralTextureBaker
+/// into Resources/Baked as compressed assets. Callers load the baked asset and keep their runtime
+/// generator as the fallback for when it is missing (not baked yet, or baked for other settings).
+/// </summary>
+public static class BakedAssets
+{
+    public const string ResourcesFolder = "Baked";
+    public const string AssetFolder = "Assets/Resources/" + ResourcesFolder;
+    public const int HashSeed = unchecked((int)2166136261);
+
+    /// <summary>
+    /// The baked asset called name, or null when it hasn't been baked
+    /// </summary>
+    public static T Load<T>(string name) where T : Object
+    {
+        return Resources.Load<T>(ResourcesFolder + "/" + name);
+    }
+
+    /// <summary>
+    /// Stable hash of generator settings, used in baked asset names so changed settings miss the
+    /// stale bake instead of loading it
+    /// </summary>
+    public static int Hash(int hash, Color color)
+    {
+        Color32 c = color;
+        return Hash(Hash(Hash(Hash(hash, c.r), c.g), c.b), c.a);
+    }
+
+    public static int Hash(int hash, int value)
+    {
+        unchecked
+        {
+            return (hash ^ value) * 16777619;
+        }
+    }
+}
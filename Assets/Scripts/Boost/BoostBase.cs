@@ -76,7 +76,7 @@ public abstract class BoostBase : MonoBehaviour
 
     private void OnTriggerEnter2D(Collider2D other)
     {
-        Debug.Log($"BoostBase OnTriggerEnter2D with {other.name}");
+        GameLog.Verbose(LogCategory.Player, $"BoostBase OnTriggerEnter2D with {other.name}");
         if (other.CompareTag("Player") == false)
         {
             return;
@@ -86,11 +86,11 @@ public abstract class BoostBase : MonoBehaviour
 
         if (stats == null)
         {
-            Debug.Log("PlayerStats component not found on player!");
+            GameLog.Warning(LogCategory.Player, "PlayerStats component not found on player!");
             return;
         }
 
-        Debug.Log($"Applying boost: {GetType().Name} with amount {Amount} for {Duration}s");
+        GameLog.Verbose(LogCategory.Player, $"Applying boost: {GetType().Name} with amount {Amount} for {Duration}s");
 
         // Play procedural audio for this boost type
         ProceduralBoostAudio.PlaySound(BoostSoundType);
@@ -23,7 +23,6 @@ public class ProceduralBoostAudio : MonoBehaviour
     [Range(0f, 1f)]
     [SerializeField] private float volume = 0.6f;
 
-    private static AudioSource sharedAudioSource;
     private static int sampleRate;
     private static float[] audioBuffer;
     private static float[] filterState = new float[8];
@@ -35,14 +34,8 @@ public class ProceduralBoostAudio : MonoBehaviour
 
     private static void EnsureInitialized()
     {
-        if (sharedAudioSource == null)
+        if (audioBuffer == null)
         {
-            GameObject audioObj = new GameObject("BoostPickupAudio");
-            DontDestroyOnLoad(audioObj);
-            sharedAudioSource = audioObj.AddComponent<AudioSource>();
-            sharedAudioSource.playOnAwake = false;
-            sharedAudioSource.spatialBlend = 0f;
-            
             sampleRate = AudioSettings.outputSampleRate;
             int maxSamples = Mathf.CeilToInt(0.8f * sampleRate);
             audioBuffer = new float[maxSamples];
@@ -58,7 +51,7 @@ public class ProceduralBoostAudio : MonoBehaviour
     {
         EnsureInitialized();
         AudioClip clip = GenerateClip(type);
-        sharedAudioSource.PlayOneShot(clip, vol);
+        AudioVoiceManager.Play(clip, AudioVoiceCategory.Pickup, vol);
     }
 
     private static AudioClip GenerateClip(BoostSoundType type)
@@ -548,24 +541,12 @@ public class ProceduralBoostAudio : MonoBehaviour
 
     private static float Lowpass(float input, float cutoff, int stateIdx)
     {
-        float rc = 1f / (2f * Mathf.PI * cutoff);
-        float dt = 1f / sampleRate;
-        float alpha = Mathf.Clamp01(dt / (rc + dt));
-        
-        filterState[stateIdx] += alpha * (input - filterState[stateIdx]);
-        return filterState[stateIdx];
+        return ProceduralDsp.OnePoleLowpass(ref filterState[stateIdx], input, cutoff, sampleRate);
     }
 
     private static float Highpass(float input, float cutoff, int stateIdx)
     {
-        float rc = 1f / (2f * Mathf.PI * cutoff);
-        float dt = 1f / sampleRate;
-        float alpha = Mathf.Clamp01(rc / (rc + dt));
-        
-        float output = alpha * (filterState[stateIdx + 4] + input - filterState[stateIdx]);
-        filterState[stateIdx] = input;
-        filterState[stateIdx + 4] = output;
-        return output;
+        return ProceduralDsp.OnePoleHighpass(ref filterState[stateIdx], ref filterState[stateIdx + 4], input, cutoff, sampleRate);
     }
 
     private static float SoftClip(float x)
@@ -583,25 +564,10 @@ public class ProceduralBoostAudio : MonoBehaviour
     private static AudioClip FinalizeClip(string name, int numSamples, float duration)
     {
         // Normalize
-        float maxAmp = 0f;
-        for (int i = 0; i < numSamples; i++)
-            maxAmp = Mathf.Max(maxAmp, Mathf.Abs(audioBuffer[i]));
-
-        if (maxAmp > 0.01f)
-        {
-            float normalize = 0.8f / maxAmp;
-            for (int i = 0; i < numSamples; i++)
-                audioBuffer[i] *= normalize;
-        }
+        ProceduralDsp.NormalizePeak(audioBuffer, numSamples, 0.8f);
 
         // Fade out
-        int fadeOut = Mathf.Min(numSamples / 5, sampleRate / 20);
-        for (int i = 0; i < fadeOut; i++)
-        {
-            int idx = numSamples - 1 - i;
-            float fade = (float)i / fadeOut;
-            audioBuffer[idx] *= fade * fade;
-        }
+        ProceduralDsp.FadeOutQuadratic(audioBuffer, numSamples, Mathf.Min(numSamples / 5, sampleRate / 20));
 
         AudioClip clip = AudioClip.Create(name, numSamples, 1, sampleRate, false);
         float[] clipData = new float[numSamples];
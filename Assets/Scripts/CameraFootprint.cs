@@ -0,0 +1,78 @@
+using UnityEngine;
+
+/// <summary>
+/// Where a camera's view meets the gameplay plane (constant world z). The game camera is a pitched
+/// perspective camera, so the visible ground is a trapezoid rather than an orthographic rectangle;
+/// EnemySpawner spawns just outside it and QualityGovernor bounds it for on-screen tests.
+/// </summary>
+public static class CameraFootprint
+{
+    private static readonly Vector3[] ViewportCorners =
+    {
+        new Vector3(0f, 0f, 0f), new Vector3(1f, 0f, 0f), new Vector3(1f, 1f, 0f), new Vector3(0f, 1f, 0f)
+    };
+
+    /// <summary>
+    /// Fill corners (4 entries, in viewport order bottom-left, bottom-right, top-right, top-left)
+    /// with the points where the viewport corner rays hit the plane. Rays at or above the horizon
+    /// stop at the far clip distance.
+    /// </summary>
+    public static void Compute(Camera camera, float planeZ, Vector2[] corners)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            Ray ray = camera.ViewportPointToRay(ViewportCorners[i]);
+            float t = camera.farClipPlane;
+            float toPlane = planeZ - ray.origin.z;
+            if (toPlane * ray.direction.z > 0f)
+                t = Mathf.Min(toPlane / ray.direction.z, t);
+
+            Vector3 hit = ray.origin + ray.direction * t;
+            corners[i] = new Vector2(hit.x, hit.y);
+        }
+    }
+
+    /// <summary>
+    /// Axis-aligned bounds of a footprint
+    /// </summary>
+    public static Rect Bounds(Vector2[] corners)
+    {
+        Vector2 min = corners[0];
+        Vector2 max = corners[0];
+        for (int i = 1; i < 4; i++)
+        {
+            min = Vector2.Min(min, corners[i]);
+            max = Vector2.Max(max, corners[i]);
+        }
+        return Rect.MinMaxRect(min.x, min.y, max.x, max.y);
+    }
+
+    /// <summary>
+    /// Distance from a point inside the footprint along a unit direction to its edge,
+    /// or 0 when the ray misses it
+    /// </summary>
+    public static float DistanceToEdge(Vector2[] corners, Vector2 point, Vector2 direction)
+    {
+        float distance = 0f;
+        for (int i = 0; i < 4; i++)
+        {
+            Vector2 a = corners[i];
+            Vector2 edge = corners[(i + 1) & 3] - a;
+            float denominator = Cross(direction, edge);
+            if (Mathf.Abs(denominator) < 1e-6f) continue;
+
+            // point + t * direction = a + s * edge
+            Vector2 toA = a - point;
+            float t = Cross(toA, edge) / denominator;
+            float s = Cross(toA, direction) / denominator;
+            if (t > 0f && s >= 0f && s <= 1f)
+                distance = Mathf.Max(distance, t);
+        }
+        return distance;
+    }
+
+    private static float Cross(Vector2 a, Vector2 b)
+    {
+        return a.x * b.y - a.y * b.x;
+    }
+}
@@ -0,0 +1,232 @@
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using UnityEngine;
+using UnityEngine.Networking;
+#if UNITY_EDITOR
+using UnityEditor;
+#endif
+
+/// <summary>
+/// Streams content that isn't needed to reach the main menu from asset bundles in
+/// StreamingAssets/Bundles, built by ContentBundleBuilder from Assets/StreamedContent/&lt;bundle&gt;/.
+/// None of it is part of the initial WebGL download: MainMenu prefetches the gameplay bundles in
+/// the background, and scenes ask for assets by bundle + asset name and get a callback once loaded.
+/// Bundle files carry their content hash in the name (see bundles.json), so the service worker
+/// caches them indefinitely and an update only re-downloads bundles whose content changed.
+/// In the editor assets load straight from Assets/StreamedContent, no bundle build needed.
+/// </summary>
+public class ContentBundles : MonoBehaviour
+{
+    public const string ContentFolder = "Assets/StreamedContent";
+    public const string BundleFolder = "Bundles";
+    public const string ManifestFile = "bundles.json";
+
+    /// <summary>
+    /// Bundle the gameplay scene's music and ambience streams from
+    /// </summary>
+    public const string GameplayAudio = "gameplay-audio";
+
+    /// <summary>
+    /// Bundle with the gameplay scene's large art (the ground texture)
+    /// </summary>
+    public const string GameplayArt = "gameplay-art";
+
+    /// <summary>
+    /// Bundle with the clue and dialogue sprites of the legacy gamejam scenes
+    /// </summary>
+    public const string ClueSprites = "clue-sprites";
+
+    [Serializable]
+    public class BundleEntry
+    {
+        public string name;   // Folder name under Assets/StreamedContent
+        public string file;   // Hashed file name under StreamingAssets/Bundles
+    }
+
+    [Serializable]
+    public class BundleManifest
+    {
+        public BundleEntry[] bundles;
+    }
+
+    private class BundleState
+    {
+        public string name;
+        public AssetBundle bundle;
+        public bool done;
+        public readonly List<Action<AssetBundle>> waiting = new List<Action<AssetBundle>>();
+    }
+
+    private static ContentBundles instance;
+    private static readonly Dictionary<string, BundleState> states = new Dictionary<string, BundleState>();
+    private static readonly Queue<BundleState> downloadQueue = new Queue<BundleState>();
+    private static Dictionary<string, string> bundleFiles;   // null until bundles.json is read
+    private static bool downloading;
+
+    /// <summary>
+    /// Start downloading a bundle in the background so later loads from it are immediate
+    /// </summary>
+    public static void Prefetch(string bundleName)
+    {
+#if !UNITY_EDITOR
+        GetBundle(bundleName, null);
+#endif
+    }
+
+    /// <summary>
+    /// Load an asset from a streamed bundle. onLoaded gets null if the bundle or asset is missing.
+    /// The callback can run after the caller was destroyed - check for that before using it.
+    /// </summary>
+    public static void Load<T>(string bundleName, string assetName, Action<T> onLoaded) where T : UnityEngine.Object
+    {
+#if UNITY_EDITOR
+        onLoaded?.Invoke(LoadFromContentFolder<T>(bundleName, assetName));
+#else
+        GetBundle(bundleName, bundle =>
+        {
+            if (bundle == null)
+            {
+                onLoaded?.Invoke(null);
+                return;
+            }
+
+            AssetBundleRequest request = bundle.LoadAssetAsync<T>(assetName);
+            request.completed += _ =>
+            {
+                if (request.asset == null)
+                    GameLog.Warning(LogCategory.Content, $"[ContentBundles] '{assetName}' not found in bundle '{bundleName}'");
+                onLoaded?.Invoke(request.asset as T);
+            };
+        });
+#endif
+    }
+
+#if UNITY_EDITOR
+    private static T LoadFromContentFolder<T>(string bundleName, string assetName) where T : UnityEngine.Object
+    {
+        string folder = ContentFolder + "/" + bundleName;
+        if (AssetDatabase.IsValidFolder(folder))
+        {
+            foreach (string guid in AssetDatabase.FindAssets(assetName, new[] { folder }))
+            {
+                string path = AssetDatabase.GUIDToAssetPath(guid);
+                if (System.IO.Path.GetFileNameWithoutExtension(path) == assetName)
+                    return AssetDatabase.LoadAssetAtPath<T>(path);
+            }
+        }
+
+        GameLog.Warning(LogCategory.Content, $"[ContentBundles] '{assetName}' not found in {folder}");
+        return null;
+    }
+#endif
+
+    private static void GetBundle(string bundleName, Action<AssetBundle> onLoaded)
+    {
+        if (!states.TryGetValue(bundleName, out BundleState state))
+        {
+            state = new BundleState { name = bundleName };
+            states[bundleName] = state;
+            downloadQueue.Enqueue(state);
+            EnsureInstance();
+            instance.BeginDownloads();
+        }
+
+        if (state.done)
+        {
+            onLoaded?.Invoke(state.bundle);
+            return;
+        }
+
+        if (onLoaded != null) state.waiting.Add(onLoaded);
+    }
+
+    private static void EnsureInstance()
+    {
+        if (instance != null) return;
+
+        GameObject obj = new GameObject("ContentBundles");
+        DontDestroyOnLoad(obj);
+        instance = obj.AddComponent<ContentBundles>();
+    }
+
+    private void BeginDownloads()
+    {
+        if (!downloading) StartCoroutine(DownloadQueued());
+    }
+
+    /// <summary>
+    /// Download bundles one at a time in request order, so a prefetch never competes with
+    /// the one the current scene is waiting on for bandwidth
+    /// </summary>
+    private IEnumerator DownloadQueued()
+    {
+        downloading = true;
+
+        if (bundleFiles == null)
+            yield return ReadManifest();
+
+        while (downloadQueue.Count > 0)
+        {
+            BundleState state = downloadQueue.Dequeue();
+            if (bundleFiles.TryGetValue(state.name, out string file))
+            {
+                using (UnityWebRequest request = UnityWebRequestAssetBundle.GetAssetBundle(StreamingUrl(BundleFolder + "/" + file)))
+                {
+                    yield return request.SendWebRequest();
+
+                    if (request.result == UnityWebRequest.Result.Success)
+                        state.bundle = DownloadHandlerAssetBundle.GetContent(request);
+                    else
+                        GameLog.Warning(LogCategory.Content, $"[ContentBundles] Failed to download bundle '{state.name}': {request.error}");
+                }
+            }
+            else
+            {
+                GameLog.Warning(LogCategory.Content, $"[ContentBundles] Bundle '{state.name}' is not in {ManifestFile}");
+            }
+
+            state.done = true;
+            foreach (Action<AssetBundle> callback in state.waiting)
+                callback(state.bundle);
+            state.waiting.Clear();
+        }
+
+        downloading = false;
+    }
+
+    private static IEnumerator ReadManifest()
+    {
+        bundleFiles = new Dictionary<string, string>();
+
+        using (UnityWebRequest request = UnityWebRequest.Get(StreamingUrl(BundleFolder + "/" + ManifestFile)))
+        {
+            yield return request.SendWebRequest();
+
+            if (request.result != UnityWebRequest.Result.Success)
+            {
+                GameLog.Warning(LogCategory.Content, $"[ContentBundles] No bundle manifest ({request.error}) - streamed content disabled");
+                yield break;
+            }
+
+            BundleManifest manifest = JsonUtility.FromJson<BundleManifest>(request.downloadHandler.text);
+            if (manifest?.bundles == null) yield break;
+
+            foreach (BundleEntry entry in manifest.bundles)
+                bundleFiles[entry.name] = entry.file;
+        }
+    }
+
+    private static string StreamingUrl(string relativePath)
+    {
+        // WebGL's streamingAssetsPath is already a URL; elsewhere it's a file path
+        string root = Application.streamingAssetsPath;
+        if (!root.Contains("://")) root = "file://" + root;
+        return root + "/" + relativePath;
+    }
+
+    void OnDestroy()
+    {
+        if (instance == this) instance = null;
+    }
+}
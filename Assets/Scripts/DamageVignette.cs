@@ -118,6 +118,7 @@ public class DamageVignette : MonoBehaviour
     {
         GameObject canvasGO = new GameObject("DamageVignetteCanvas");
         Canvas canvas = canvasGO.AddComponent<Canvas>();
+        canvasGO.AddComponent<TrackedCanvas>();
         canvas.renderMode = RenderMode.ScreenSpaceOverlay;
         canvas.sortingOrder = 100; // Render on top
         canvasGO.AddComponent<CanvasScaler>();
@@ -161,6 +162,9 @@ public class DamageVignette : MonoBehaviour
     /// <param name="intensity">Pulse intensity from 0 (subtle) to 1 (maximum).</param>
     public void TriggerPulse(float intensity)
     {
+        // Full-screen blended overlay - dropped at the governor's lowest quality level
+        if (!QualityGovernor.VignetteEnabled) return;
+
         intensity = Mathf.Clamp01(intensity);
         
         _targetAlpha = Mathf.Lerp(BaseAlpha, MaxAlpha, intensity);
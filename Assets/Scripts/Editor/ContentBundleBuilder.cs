@@ -0,0 +1,88 @@
+using System.Collections.Generic;
+using System.IO;
+using UnityEditor;
+using UnityEditor.Build;
+using UnityEditor.Build.Reporting;
+using UnityEngine;
+
+/// <summary>
+/// Builds one asset bundle per folder under Assets/StreamedContent into
+/// Assets/StreamingAssets/Bundles before every player build, and writes bundles.json mapping
+/// bundle names to their hashed file names (read by ContentBundles at runtime).
+/// Assets in those folders must not also be referenced from a build scene, or they ship twice.
+/// </summary>
+public class ContentBundleBuilder : IPreprocessBuildWithReport
+{
+    private const string OutputFolder = "Assets/StreamingAssets/" + ContentBundles.BundleFolder;
+    private const string CacheFolder = "Library/ContentBundles";
+
+    public int callbackOrder => 0;
+
+    public void OnPreprocessBuild(BuildReport report)
+    {
+        Build(report.summary.platform);
+    }
+
+    [MenuItem("Tools/BROcoli/Build Content Bundles")]
+    public static void BuildForActiveTarget()
+    {
+        Build(EditorUserBuildSettings.activeBuildTarget);
+    }
+
+    public static void Build(BuildTarget target)
+    {
+        var builds = new List<AssetBundleBuild>();
+        if (AssetDatabase.IsValidFolder(ContentBundles.ContentFolder))
+        {
+            foreach (string folder in AssetDatabase.GetSubFolders(ContentBundles.ContentFolder))
+            {
+                var assets = new List<string>();
+                foreach (string guid in AssetDatabase.FindAssets("", new[] { folder }))
+                {
+                    string path = AssetDatabase.GUIDToAssetPath(guid);
+                    if (!AssetDatabase.IsValidFolder(path)) assets.Add(path);
+                }
+                if (assets.Count == 0) continue;
+
+                builds.Add(new AssetBundleBuild
+                {
+                    assetBundleName = Path.GetFileName(folder),
+                    assetNames = assets.ToArray()
+                });
+            }
+        }
+
+        // Replace the previous output so stale hashed files never ship
+        if (Directory.Exists(OutputFolder)) Directory.Delete(OutputFolder, true);
+        Directory.CreateDirectory(OutputFolder);
+
+        var manifest = new ContentBundles.BundleManifest { bundles = new ContentBundles.BundleEntry[0] };
+        if (builds.Count > 0)
+        {
+            // Cache folder is per target and persists, so unchanged bundles rebuild incrementally
+            string cache = Path.Combine(CacheFolder, target.ToString());
+            Directory.CreateDirectory(cache);
+
+            AssetBundleManifest built = BuildPipeline.BuildAssetBundles(cache, builds.ToArray(),
+                BuildAssetBundleOptions.ChunkBasedCompression, target);
+            if (built == null)
+                throw new BuildFailedException("ContentBundleBuilder: asset bundle build failed");
+
+            var entries = new List<ContentBundles.BundleEntry>();
+            foreach (AssetBundleBuild build in builds)
+            {
+                // Name the shipped file by content hash so caches never serve a stale bundle
+                string hash = built.GetAssetBundleHash(build.assetBundleName).ToString();
+                string file = build.assetBundleName + "_" + hash;
+                File.Copy(Path.Combine(cache, build.assetBundleName), Path.Combine(OutputFolder, file), true);
+                entries.Add(new ContentBundles.BundleEntry { name = build.assetBundleName, file = file });
+            }
+            manifest.bundles = entries.ToArray();
+        }
+
+        File.WriteAllText(Path.Combine(OutputFolder, ContentBundles.ManifestFile), JsonUtility.ToJson(manifest, true));
+        AssetDatabase.Refresh();
+
+        Debug.Log($"[ContentBundleBuilder] Built {builds.Count} bundle(s) for {target} into {OutputFolder}");
+    }
+}
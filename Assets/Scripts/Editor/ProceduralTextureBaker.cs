@@ -0,0 +1,154 @@
+using System.Collections.Generic;
+using System.IO;
+using UnityEditor;
+using UnityEditor.Build;
+using UnityEditor.Build.Reporting;
+using UnityEditor.SceneManagement;
+using UnityEngine;
+using UnityEngine.SceneManagement;
+
+/// <summary>
+/// Bakes the textures VirtualController and the sanitizer spray used to generate on startup into
+/// compressed assets under Resources/Baked (BakedAssets), before every player build.
+/// VirtualController sprites are rendered from each controller in the build scenes with its own
+/// colours, and named by a hash of them, so a controller whose settings changed since the last bake
+/// falls back to runtime generation instead of showing stale art. Spray textures and the four spray
+/// materials are baked as-is; shipping the materials also keeps their particle shaders in the build.
+/// The folder is generated output.
+/// </summary>
+public class ProceduralTextureBaker : IPreprocessBuildWithReport
+{
+    private const string VirtualControllerPrefix = "VirtualController_";
+
+    // Before SpriteAtlasBuilder (the baked sprites are loaded from Resources, not packed)
+    public int callbackOrder => -20;
+
+    public void OnPreprocessBuild(BuildReport report)
+    {
+        Bake();
+    }
+
+    [MenuItem("Tools/BROcoli/Bake Procedural Textures")]
+    public static void Bake()
+    {
+        if (EditorApplication.isPlayingOrWillChangePlaymode)
+        {
+            Debug.LogWarning("[ProceduralTextureBaker] Exit play mode to bake");
+            return;
+        }
+
+        if (!AssetDatabase.IsValidFolder("Assets/Resources")) AssetDatabase.CreateFolder("Assets", "Resources");
+        if (!AssetDatabase.IsValidFolder(BakedAssets.AssetFolder))
+            AssetDatabase.CreateFolder("Assets/Resources", BakedAssets.ResourcesFolder);
+
+        var written = new HashSet<string>();
+        BakeVirtualControllers(written);
+        BakeSpray(written);
+
+        // Drop controller bakes for settings no scene uses any more
+        foreach (string guid in AssetDatabase.FindAssets(VirtualControllerPrefix, new[] { BakedAssets.AssetFolder }))
+        {
+            string path = AssetDatabase.GUIDToAssetPath(guid);
+            if (!written.Contains(path)) AssetDatabase.DeleteAsset(path);
+        }
+
+        AssetDatabase.SaveAssets();
+        Debug.Log($"[ProceduralTextureBaker] Baked {written.Count} asset(s) into {BakedAssets.AssetFolder}");
+    }
+
+    private static void BakeVirtualControllers(HashSet<string> written)
+    {
+        var opened = new List<Scene>();
+        try
+        {
+            foreach (EditorBuildSettingsScene buildScene in EditorBuildSettings.scenes)
+            {
+                if (!buildScene.enabled) continue;
+
+                Scene scene = SceneManager.GetSceneByPath(buildScene.path);
+                if (scene.isLoaded) continue;
+                opened.Add(EditorSceneManager.OpenScene(buildScene.path, OpenSceneMode.Additive));
+            }
+
+            var controllers = Object.FindObjectsByType<VirtualController>(FindObjectsInactive.Include, FindObjectsSortMode.None);
+            foreach (VirtualController controller in controllers)
+            {
+                controller.RenderTextures(out Texture2D ring, out Texture2D handle, out Texture2D pause);
+                written.Add(WriteTexture(ring, controller.BakedSpriteName("Ring"), true));
+                written.Add(WriteTexture(handle, controller.BakedSpriteName("Handle"), true));
+                written.Add(WriteTexture(pause, controller.BakedSpriteName("Pause"), true));
+            }
+        }
+        finally
+        {
+            foreach (Scene scene in opened)
+                EditorSceneManager.CloseScene(scene, true);
+        }
+    }
+
+    private static void BakeSpray(HashSet<string> written)
+    {
+        string softCirclePath = WriteTexture(SprayMaterialCreator.CreateSoftCircleTexture(SprayMaterialCreator.SoftCircleTextureSize),
+            SprayMaterialCreator.SoftCircleTextureName, false);
+        string dropletPath = WriteTexture(SprayMaterialCreator.CreateDropletTexture(SprayMaterialCreator.DropletTextureSize),
+            SprayMaterialCreator.DropletTextureName, false);
+        written.Add(softCirclePath);
+        written.Add(dropletPath);
+
+        Texture2D softCircle = AssetDatabase.LoadAssetAtPath<Texture2D>(softCirclePath);
+        Texture2D droplet = AssetDatabase.LoadAssetAtPath<Texture2D>(dropletPath);
+
+        written.Add(WriteMaterial(SprayMaterialCreator.CreateSprayCoreMaterial(), softCircle));
+        written.Add(WriteMaterial(SprayMaterialCreator.CreateSprayMistMaterial(), softCircle));
+        written.Add(WriteMaterial(SprayMaterialCreator.CreateSprayDropletMaterial(), droplet));
+        written.Add(WriteMaterial(SprayMaterialCreator.CreateSprayGlowMaterial(), softCircle));
+    }
+
+    private static string WriteTexture(Texture2D texture, string name, bool sprite)
+    {
+        string path = $"{BakedAssets.AssetFolder}/{name}.png";
+        File.WriteAllBytes(path, texture.EncodeToPNG());
+        Object.DestroyImmediate(texture);
+        AssetDatabase.ImportAsset(path, ImportAssetOptions.ForceSynchronousImport);
+
+        var importer = (TextureImporter)AssetImporter.GetAtPath(path);
+        importer.textureType = sprite ? TextureImporterType.Sprite : TextureImporterType.Default;
+        if (sprite)
+        {
+            importer.spriteImportMode = SpriteImportMode.Single;
+            importer.spritePixelsPerUnit = 100f;
+        }
+        importer.alphaIsTransparency = true;
+        importer.mipmapEnabled = false;
+        importer.isReadable = false;
+        importer.wrapMode = TextureWrapMode.Clamp;
+        importer.filterMode = FilterMode.Bilinear;
+        importer.textureCompression = TextureImporterCompression.Compressed;
+        importer.SetPlatformTextureSettings(SpriteAtlasBuilder.PlatformSettings("WebGL", SpriteAtlasBuilder.WebGLFormat()));
+        importer.SetPlatformTextureSettings(SpriteAtlasBuilder.PlatformSettings("iPhone", TextureImporterFormat.ASTC_6x6));
+        importer.SetPlatformTextureSettings(SpriteAtlasBuilder.PlatformSettings("Android", TextureImporterFormat.ASTC_6x6));
+        importer.SaveAndReimport();
+
+        return path;
+    }
+
+    private static string WriteMaterial(Material material, Texture2D texture)
+    {
+        string path = $"{BakedAssets.AssetFolder}/{material.name}.mat";
+        material.mainTexture = texture;
+
+        Material existing = AssetDatabase.LoadAssetAtPath<Material>(path);
+        if (existing != null)
+        {
+            EditorUtility.CopySerialized(material, existing);
+            Object.DestroyImmediate(material);
+            EditorUtility.SetDirty(existing);
+        }
+        else
+        {
+            AssetDatabase.CreateAsset(material, path);
+        }
+
+        return path;
+    }
+}
@@ -0,0 +1,226 @@
+using System.Collections.Generic;
+using System.IO;
+using System.Text.RegularExpressions;
+using UnityEditor;
+using UnityEditor.Build;
+using UnityEditor.Build.Reporting;
+using UnityEngine;
+using UnityEngine.Rendering;
+using UnityEngine.Rendering.Universal;
+
+/// <summary>
+/// Collects the shader variants the game draws with into a ShaderVariantCollection under
+/// Resources/Baked (GameWarmup.VariantCollectionName) before every player build: the materials of
+/// the build scenes, of prefabs under Resources and of the baked spray materials, plus the
+/// instanced enemy shader, the ground shader and the shaders that are only created from code.
+/// Each is recorded with the URP global keywords the pipeline asset turns on at runtime (shadows,
+/// additional lights) and the fog modes of the build scenes, since materials don't carry those.
+/// GameWarmup compiles the collection behind the main menu so the first wave doesn't stall on
+/// shader compiles.
+/// Run after ProceduralTextureBaker so the baked spray materials are current.
+/// </summary>
+public class ShaderWarmupBuilder : IPreprocessBuildWithReport
+{
+    // Shaders used by materials created at runtime (SprayMaterialCreator, SprayParticleController)
+    private static readonly string[] CodeShaders =
+    {
+        "Universal Render Pipeline/Particles/Lit",
+        "Universal Render Pipeline/Particles/Unlit",
+        "Sprites/Default"
+    };
+
+    private const string InstancingKeyword = "INSTANCING_ON";
+
+    // multi_compile_fog keywords by FogMode (Linear = 1, Exponential = 2, ExponentialSquared = 3)
+    private static readonly string[] FogKeywords = { "FOG_LINEAR", "FOG_EXP", "FOG_EXP2" };
+
+    public int callbackOrder => -15;
+
+    public void OnPreprocessBuild(BuildReport report)
+    {
+        Build();
+    }
+
+    [MenuItem("Tools/BROcoli/Build Shader Warmup Collection")]
+    public static void Build()
+    {
+        var materials = new HashSet<Material>();
+        foreach (EditorBuildSettingsScene scene in EditorBuildSettings.scenes)
+        {
+            if (scene.enabled) AddMaterials(materials, scene.path);
+        }
+
+        foreach (string guid in AssetDatabase.FindAssets("t:Prefab"))
+        {
+            string path = AssetDatabase.GUIDToAssetPath(guid);
+            if (path.Contains("/Resources/")) AddMaterials(materials, path);
+        }
+
+        if (AssetDatabase.IsValidFolder(BakedAssets.AssetFolder))
+        {
+            foreach (string guid in AssetDatabase.FindAssets("t:Material", new[] { BakedAssets.AssetFolder }))
+                materials.Add(AssetDatabase.LoadAssetAtPath<Material>(AssetDatabase.GUIDToAssetPath(guid)));
+        }
+
+        List<string> pipelineKeywords = PipelineKeywords();
+        List<string> fogKeywords = SceneFogKeywords();
+
+        var collection = new ShaderVariantCollection();
+        foreach (Material material in materials)
+        {
+            if (material != null && material.shader != null)
+                AddVariants(collection, material.shader, material.shaderKeywords, pipelineKeywords, fogKeywords);
+        }
+
+        Shader instanced = Resources.Load<Shader>(EnemyRenderManager.ShaderPath);
+        if (instanced != null)
+        {
+            AddVariants(collection, instanced, System.Array.Empty<string>(), pipelineKeywords, fogKeywords);
+            AddVariants(collection, instanced, new[] { InstancingKeyword }, pipelineKeywords, fogKeywords);
+        }
+
+        Shader background = Resources.Load<Shader>(InfiniteBackground.ShaderPath);
+        if (background != null)
+            AddVariants(collection, background, System.Array.Empty<string>(), pipelineKeywords, fogKeywords);
+
+        foreach (string shaderName in CodeShaders)
+        {
+            Shader shader = Shader.Find(shaderName);
+            if (shader != null) AddVariants(collection, shader, System.Array.Empty<string>(), pipelineKeywords, fogKeywords);
+        }
+
+        WriteCollection(collection);
+        Debug.Log($"[ShaderWarmupBuilder] {collection.variantCount} variant(s) of {collection.shaderCount} shader(s) from {materials.Count} material(s)");
+    }
+
+    private static void AddMaterials(HashSet<Material> materials, string assetPath)
+    {
+        foreach (string dependency in AssetDatabase.GetDependencies(assetPath, true))
+        {
+            if (!dependency.EndsWith(".mat")) continue;
+
+            Material material = AssetDatabase.LoadAssetAtPath<Material>(dependency);
+            if (material != null) materials.Add(material);
+        }
+    }
+
+    /// <summary>
+    /// Global keywords the forward renderer enables from the active URP asset. Which of them are on
+    /// for a given frame depends on the lights in view, so every combination gets recorded.
+    /// </summary>
+    private static List<string> PipelineKeywords()
+    {
+        var keywords = new List<string>();
+        if (!(GraphicsSettings.currentRenderPipeline is UniversalRenderPipelineAsset urp)) return keywords;
+
+        if (urp.supportsMainLightShadows)
+            keywords.Add(urp.shadowCascadeCount > 1 ? "_MAIN_LIGHT_SHADOWS_CASCADE" : "_MAIN_LIGHT_SHADOWS");
+
+        if (urp.additionalLightsRenderingMode == LightRenderingMode.PerPixel)
+        {
+            keywords.Add("_ADDITIONAL_LIGHTS");
+            if (urp.supportsAdditionalLightShadows) keywords.Add("_ADDITIONAL_LIGHT_SHADOWS");
+        }
+        else if (urp.additionalLightsRenderingMode == LightRenderingMode.PerVertex)
+        {
+            keywords.Add("_ADDITIONAL_LIGHTS_VERTEX");
+        }
+
+        if (urp.supportsSoftShadows) keywords.Add("_SHADOWS_SOFT");
+        return keywords;
+    }
+
+    /// <summary>
+    /// Fog keywords of the enabled build scenes, read from their serialized RenderSettings so the
+    /// scenes don't have to be opened during the build
+    /// </summary>
+    private static List<string> SceneFogKeywords()
+    {
+        var keywords = new List<string>();
+        foreach (EditorBuildSettingsScene scene in EditorBuildSettings.scenes)
+        {
+            if (!scene.enabled || !File.Exists(scene.path)) continue;
+
+            string text = File.ReadAllText(scene.path);
+            if (!Regex.IsMatch(text, @"\n  m_Fog: 1\b")) continue;
+
+            Match mode = Regex.Match(text, @"\n  m_FogMode: (\d)");
+            int index = mode.Success ? int.Parse(mode.Groups[1].Value) - 1 : -1;
+            if (index >= 0 && index < FogKeywords.Length && !keywords.Contains(FogKeywords[index]))
+                keywords.Add(FogKeywords[index]);
+        }
+        return keywords;
+    }
+
+    /// <summary>
+    /// Add a material's keywords combined with every subset of the pipeline keywords and with each
+    /// fog mode, keeping only the global keywords the shader declares
+    /// </summary>
+    private static void AddVariants(ShaderVariantCollection collection, Shader shader, string[] keywords,
+        List<string> pipelineKeywords, List<string> fogKeywords)
+    {
+        var declared = new HashSet<string>(shader.keywordSpace.keywordNames);
+        List<string> globals = pipelineKeywords.FindAll(declared.Contains);
+        var fogModes = new List<string> { null };
+        fogModes.AddRange(fogKeywords.FindAll(declared.Contains));
+
+        var variant = new List<string>();
+        for (int mask = 0; mask < 1 << globals.Count; mask++)
+        {
+            foreach (string fog in fogModes)
+            {
+                variant.Clear();
+                variant.AddRange(keywords);
+                for (int i = 0; i < globals.Count; i++)
+                {
+                    if ((mask & (1 << i)) != 0) variant.Add(globals[i]);
+                }
+                if (fog != null) variant.Add(fog);
+
+                AddVariant(collection, shader, variant.ToArray());
+            }
+        }
+    }
+
+    /// <summary>
+    /// Add the variant for the pass type the shader actually has: URP passes first, then the
+    /// built-in forward pass sprite and legacy particle shaders use
+    /// </summary>
+    private static void AddVariant(ShaderVariantCollection collection, Shader shader, string[] keywords)
+    {
+        foreach (PassType passType in new[] { PassType.ScriptableRenderPipeline, PassType.ScriptableRenderPipelineDefaultUnlit, PassType.Normal })
+        {
+            try
+            {
+                collection.Add(new ShaderVariantCollection.ShaderVariant(shader, passType, keywords));
+                return;
+            }
+            catch (System.ArgumentException)
+            {
+                // The shader has no pass of this type, or not with these keywords
+            }
+        }
+    }
+
+    private static void WriteCollection(ShaderVariantCollection collection)
+    {
+        if (!AssetDatabase.IsValidFolder("Assets/Resources")) AssetDatabase.CreateFolder("Assets", "Resources");
+        if (!AssetDatabase.IsValidFolder(BakedAssets.AssetFolder))
+            AssetDatabase.CreateFolder("Assets/Resources", BakedAssets.ResourcesFolder);
+
+        string path = $"{BakedAssets.AssetFolder}/{GameWarmup.VariantCollectionName}.shadervariants";
+        ShaderVariantCollection existing = AssetDatabase.LoadAssetAtPath<ShaderVariantCollection>(path);
+        if (existing != null)
+        {
+            EditorUtility.CopySerialized(collection, existing);
+            Object.DestroyImmediate(collection);
+            EditorUtility.SetDirty(existing);
+        }
+        else
+        {
+            AssetDatabase.CreateAsset(collection, path);
+        }
+
+        AssetDatabase.SaveAssets();
+    }
+}
@@ -0,0 +1,211 @@
+using System.Collections.Generic;
+using System.IO;
+using UnityEditor;
+using UnityEditor.Build;
+using UnityEditor.Build.Reporting;
+using UnityEditor.U2D;
+using UnityEngine;
+using UnityEngine.U2D;
+
+/// <summary>
+/// Packs the sprites each build scene uses into Assets/SpriteAtlases/&lt;Scene&gt;.spriteatlas before
+/// every player build; sprites used by more than one scene (or by prefabs under Resources) go in
+/// Shared.spriteatlas so no sprite lands in two atlases. Atlases that no longer have sprites are
+/// deleted, so the folder is generated output.
+/// Each atlas gets compressed per-platform overrides: ASTC on iOS/Android, and on WebGL the format
+/// of the WebGL texture subtarget (ASTC or ETC2 for a mobile build, DXT otherwise).
+/// Duplicate source images (same bytes, different files) are reported so one copy can be dropped.
+/// TextureMemoryReport shows what the atlases cost at runtime.
+/// </summary>
+public class SpriteAtlasBuilder : IPreprocessBuildWithReport
+{
+    public const string AtlasFolder = "Assets/SpriteAtlases";
+    private const string SharedAtlasName = "Shared";
+    private const int MaxAtlasSize = 2048;
+
+    // Larger sprites (backgrounds, title art) would take most of a page on their own
+    private const int MaxPackedSpriteSize = 1024;
+
+    // Pack before ContentBundleBuilder
+    public int callbackOrder => -10;
+
+    public void OnPreprocessBuild(BuildReport report)
+    {
+        Build(report.summary.platform);
+    }
+
+    [MenuItem("Tools/BROcoli/Build Sprite Atlases")]
+    public static void BuildForActiveTarget()
+    {
+        Build(EditorUserBuildSettings.activeBuildTarget);
+    }
+
+    public static void Build(BuildTarget target)
+    {
+        // Sprite texture path -> atlas it belongs to
+        var owners = new Dictionary<string, string>();
+
+        foreach (EditorBuildSettingsScene scene in EditorBuildSettings.scenes)
+        {
+            if (!scene.enabled) continue;
+            AddDependencies(owners, scene.path, Path.GetFileNameWithoutExtension(scene.path));
+        }
+
+        // Resources prefabs can be loaded from any scene
+        foreach (string guid in AssetDatabase.FindAssets("t:Prefab"))
+        {
+            string path = AssetDatabase.GUIDToAssetPath(guid);
+            if (path.Contains("/Resources/")) AddDependencies(owners, path, SharedAtlasName);
+        }
+
+        var members = new SortedDictionary<string, List<string>>();
+        foreach (KeyValuePair<string, string> owner in owners)
+        {
+            if (!members.TryGetValue(owner.Value, out List<string> paths))
+                members[owner.Value] = paths = new List<string>();
+            paths.Add(owner.Key);
+        }
+
+        if (!AssetDatabase.IsValidFolder(AtlasFolder))
+            AssetDatabase.CreateFolder("Assets", Path.GetFileName(AtlasFolder));
+
+        var atlases = new List<SpriteAtlas>();
+        var written = new HashSet<string>();
+        foreach (KeyValuePair<string, List<string>> atlasMembers in members)
+        {
+            string path = $"{AtlasFolder}/{atlasMembers.Key}.spriteatlas";
+            atlases.Add(WriteAtlas(path, atlasMembers.Value));
+            written.Add(path);
+            Debug.Log($"[SpriteAtlasBuilder] {atlasMembers.Key}: {atlasMembers.Value.Count} sprite texture(s)");
+        }
+
+        // Drop atlases for scenes that left the build
+        foreach (string guid in AssetDatabase.FindAssets("t:SpriteAtlas", new[] { AtlasFolder }))
+        {
+            string path = AssetDatabase.GUIDToAssetPath(guid);
+            if (!written.Contains(path)) AssetDatabase.DeleteAsset(path);
+        }
+
+        AssetDatabase.SaveAssets();
+        SpriteAtlasUtility.PackAtlases(atlases.ToArray(), target);
+
+        ReportDuplicates(owners.Keys);
+        Debug.Log($"[SpriteAtlasBuilder] Packed {atlases.Count} atlas(es) for {target} into {AtlasFolder}");
+    }
+
+    private static void AddDependencies(Dictionary<string, string> owners, string assetPath, string atlasName)
+    {
+        foreach (string dependency in AssetDatabase.GetDependencies(assetPath, true))
+        {
+            if (!IsPackable(dependency)) continue;
+
+            if (!owners.TryGetValue(dependency, out string owner))
+                owners[dependency] = atlasName;
+            else if (owner != atlasName)
+                owners[dependency] = SharedAtlasName;
+        }
+    }
+
+    private static bool IsPackable(string path)
+    {
+        if (path.StartsWith(AtlasFolder) || path.StartsWith(ContentBundles.ContentFolder)) return false;
+
+        var importer = AssetImporter.GetAtPath(path) as TextureImporter;
+        if (importer == null || importer.textureType != TextureImporterType.Sprite) return false;
+
+        // Tiled/scrolled textures need their own texture to wrap
+        if (importer.wrapMode == TextureWrapMode.Repeat) return false;
+
+        Texture2D texture = AssetDatabase.LoadAssetAtPath<Texture2D>(path);
+        return texture != null && texture.width <= MaxPackedSpriteSize && texture.height <= MaxPackedSpriteSize;
+    }
+
+    private static SpriteAtlas WriteAtlas(string path, List<string> texturePaths)
+    {
+        SpriteAtlas atlas = AssetDatabase.LoadAssetAtPath<SpriteAtlas>(path);
+        if (atlas == null)
+        {
+            atlas = new SpriteAtlas();
+            AssetDatabase.CreateAsset(atlas, path);
+        }
+
+        atlas.Remove(atlas.GetPackables());
+
+        var textures = new Object[texturePaths.Count];
+        int pointFiltered = 0;
+        for (int i = 0; i < texturePaths.Count; i++)
+        {
+            textures[i] = AssetDatabase.LoadAssetAtPath<Texture2D>(texturePaths[i]);
+            if (((TextureImporter)AssetImporter.GetAtPath(texturePaths[i])).filterMode == FilterMode.Point)
+                pointFiltered++;
+        }
+        atlas.Add(textures);
+
+        atlas.SetIncludeInBuild(true);
+        atlas.SetPackingSettings(new SpriteAtlasPackingSettings
+        {
+            blockOffset = 1,
+            padding = 4,
+            enableRotation = false,
+            enableTightPacking = false
+        });
+        atlas.SetTextureSettings(new SpriteAtlasTextureSettings
+        {
+            readable = false,
+            generateMipMaps = false,
+            sRGB = true,
+            // Follow the sources: pixel art stays crisp
+            filterMode = pointFiltered * 2 > texturePaths.Count ? FilterMode.Point : FilterMode.Bilinear
+        });
+
+        atlas.SetPlatformSettings(PlatformSettings("WebGL", WebGLFormat()));
+        atlas.SetPlatformSettings(PlatformSettings("iPhone", TextureImporterFormat.ASTC_6x6));
+        atlas.SetPlatformSettings(PlatformSettings("Android", TextureImporterFormat.ASTC_6x6));
+
+        EditorUtility.SetDirty(atlas);
+        return atlas;
+    }
+
+    internal static TextureImporterPlatformSettings PlatformSettings(string platform, TextureImporterFormat format)
+    {
+        return new TextureImporterPlatformSettings
+        {
+            name = platform,
+            overridden = true,
+            maxTextureSize = MaxAtlasSize,
+            format = format,
+            textureCompression = TextureImporterCompression.Compressed,
+            compressionQuality = (int)TextureCompressionQuality.Normal
+        };
+    }
+
+    /// <summary>
+    /// Atlas format for WebGL, from the texture subtarget (Build Settings - Texture Compression).
+    /// Mobile Safari has no DXT and would decompress DXT atlases to RGBA32 - four times the memory.
+    /// </summary>
+    internal static TextureImporterFormat WebGLFormat()
+    {
+        switch (EditorUserBuildSettings.webGLBuildSubtarget)
+        {
+            case WebGLTextureSubtarget.ASTC: return TextureImporterFormat.ASTC_6x6;
+            case WebGLTextureSubtarget.ETC2: return TextureImporterFormat.ETC2_RGBA8;
+            default: return TextureImporterFormat.DXT5;
+        }
+    }
+
+    private static void ReportDuplicates(IEnumerable<string> texturePaths)
+    {
+        var byHash = new Dictionary<string, string>();
+        using (var md5 = System.Security.Cryptography.MD5.Create())
+        {
+            foreach (string path in texturePaths)
+            {
+                string hash = System.BitConverter.ToString(md5.ComputeHash(File.ReadAllBytes(path)));
+                if (byHash.TryGetValue(hash, out string first))
+                    Debug.LogWarning($"[SpriteAtlasBuilder] Duplicate image packed twice: {first} and {path} - reference one of them");
+                else
+                    byHash[hash] = path;
+            }
+        }
+    }
+}
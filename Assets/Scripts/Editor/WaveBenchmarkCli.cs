@@ -0,0 +1,21 @@
+using UnityEditor;
+
+/// <summary>
+/// Editor entry point for WaveBenchmark. Enters play mode with the benchmark armed; the runtime
+/// harness loads the game scene itself, writes its report and exits the editor in batch mode.
+/// Batch mode: Unity -batchmode -projectPath . -executeMethod WaveBenchmarkCli.Run [-benchmarkOut path.json]
+/// (see scripts/unity-benchmark.sh). Do not pass -quit, the harness exits when it is done.
+/// </summary>
+public static class WaveBenchmarkCli
+{
+    private const string EditorRunKey = "WaveBenchmark.Run";
+
+    [MenuItem("Tools/BROcoli/Run Wave Benchmark")]
+    public static void Run()
+    {
+        if (EditorApplication.isPlaying) return;
+
+        SessionState.SetBool(EditorRunKey, true);
+        EditorApplication.EnterPlaymode();
+    }
+}
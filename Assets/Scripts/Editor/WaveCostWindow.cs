@@ -0,0 +1,450 @@
+using System.Collections.Generic;
+using System.IO;
+using UnityEditor;
+using UnityEngine;
+
+/// <summary>
+/// Estimates what each WaveConfig costs at runtime from WaveTelemetry reports, so waves can be
+/// authored against a per-device frame budget.
+/// Per device, frame-time p90 is fitted by least squares as
+///   base + perEnemy * peakEnemies + perOrb * peakOrbs + perProjectile * peakProjectiles
+/// (enemies alone when there are few waves or a cost comes out negative). A config's peak enemies
+/// come from its recorded waves on that device when there are any; otherwise from what the config
+/// can put on screen - each prefab's PrewarmCount share capped at EnemySpawner.MaxLiveEnemies - times
+/// the observed ratio of peak to that potential. Orbs and projectiles follow the observed ratio to
+/// enemies. The last column is the largest enemyCount the budget allows for the config's mix.
+/// </summary>
+public class WaveCostWindow : EditorWindow
+{
+    private const string BudgetKey = "BROcoli.WaveCostBudgetMs";
+    private const int DefaultMaxLiveEnemies = 400;
+    private const int MinWavesForFullModel = 5;
+
+    private struct Model
+    {
+        public bool valid;
+        public float baseMs;
+        public float perEnemy;
+        public float perOrb;
+        public float perProjectile;
+        public float rSquared;
+        public int samples;
+    }
+
+    private struct Sample
+    {
+        public string device;
+        public WaveTelemetry.Wave wave;
+    }
+
+    private readonly List<Sample> samples = new List<Sample>();
+    private readonly List<string> extraFiles = new List<string>();
+    private readonly List<string> devices = new List<string>();
+    private readonly Dictionary<string, WaveConfig> configsByName = new Dictionary<string, WaveConfig>();
+    private WaveConfig[] configs = new WaveConfig[0];
+    private int maxLiveEnemies = DefaultMaxLiveEnemies;
+    private int deviceIndex;
+    private float budgetMs;
+    private bool showWaves;
+    private Vector2 scroll;
+
+    private static string TelemetryFolder => Path.Combine(Application.persistentDataPath, WaveTelemetry.FolderName);
+
+    [MenuItem("Tools/BROcoli/Wave Cost Model")]
+    public static void Open()
+    {
+        GetWindow<WaveCostWindow>("Wave Cost");
+    }
+
+    [MenuItem("Tools/BROcoli/Record Wave Telemetry")]
+    private static void ToggleRecording()
+    {
+        EditorPrefs.SetBool(WaveTelemetry.EditorEnabledKey, !EditorPrefs.GetBool(WaveTelemetry.EditorEnabledKey, false));
+    }
+
+    [MenuItem("Tools/BROcoli/Record Wave Telemetry", true)]
+    private static bool ToggleRecordingValidate()
+    {
+        Menu.SetChecked("Tools/BROcoli/Record Wave Telemetry", EditorPrefs.GetBool(WaveTelemetry.EditorEnabledKey, false));
+        return !EditorApplication.isPlaying;   // Read when play mode starts
+    }
+
+    private void OnEnable()
+    {
+        budgetMs = EditorPrefs.GetFloat(BudgetKey, 16.7f);
+        Reload();
+    }
+
+    // ==================== Data ====================
+
+    private void Reload()
+    {
+        samples.Clear();
+        devices.Clear();
+
+        if (Directory.Exists(TelemetryFolder))
+        {
+            foreach (string path in Directory.GetFiles(TelemetryFolder, "*.json"))
+                LoadReport(path);
+        }
+        foreach (string path in extraFiles)
+            LoadReport(path);
+
+        devices.Sort();
+        deviceIndex = Mathf.Clamp(deviceIndex, 0, devices.Count);
+
+        configsByName.Clear();
+        var found = new List<WaveConfig>();
+        foreach (string guid in AssetDatabase.FindAssets("t:WaveConfig"))
+        {
+            WaveConfig config = AssetDatabase.LoadAssetAtPath<WaveConfig>(AssetDatabase.GUIDToAssetPath(guid));
+            if (config == null) continue;
+            found.Add(config);
+            configsByName[config.name] = config;
+        }
+        found.Sort((a, b) => EditorUtility.NaturalCompare(a.name, b.name));
+        configs = found.ToArray();
+
+        maxLiveEnemies = DefaultMaxLiveEnemies;
+        foreach (string guid in AssetDatabase.FindAssets("EnemySpawner t:Prefab"))
+        {
+            GameObject prefab = AssetDatabase.LoadAssetAtPath<GameObject>(AssetDatabase.GUIDToAssetPath(guid));
+            if (prefab != null && prefab.TryGetComponent(out EnemySpawner spawner))
+            {
+                maxLiveEnemies = spawner.MaxLiveEnemies;
+                break;
+            }
+        }
+    }
+
+    private void LoadReport(string path)
+    {
+        WaveTelemetry.Report report;
+        try
+        {
+            report = JsonUtility.FromJson<WaveTelemetry.Report>(File.ReadAllText(path));
+        }
+        catch (System.Exception e)
+        {
+            Debug.LogWarning($"[WaveCostWindow] Skipping {path}: {e.Message}");
+            return;
+        }
+        if (report == null || report.waves == null) return;
+
+        string device = string.IsNullOrEmpty(report.device) ? "Unknown" : report.device;
+        if (!devices.Contains(device)) devices.Add(device);
+
+        foreach (WaveTelemetry.Wave wave in report.waves)
+        {
+            if (wave != null && wave.frames > 0)
+                samples.Add(new Sample { device = device, wave = wave });
+        }
+    }
+
+    private string SelectedDevice => deviceIndex > 0 && deviceIndex <= devices.Count ? devices[deviceIndex - 1] : null;
+
+    private bool Matches(Sample sample)
+    {
+        string device = SelectedDevice;
+        return device == null || sample.device == device;
+    }
+
+    // ==================== Model ====================
+
+    /// <summary>
+    /// Enemies a config can put on screen at once: each prefab entry's share of enemyCount
+    /// through PrewarmCount (hydra splits), capped at the spawner's live limit
+    /// </summary>
+    private float PotentialEnemies(WaveConfig config, int enemyCount)
+    {
+        if (config == null || config.enemyPrefabs == null || config.enemyPrefabs.Length == 0)
+            return Mathf.Min(enemyCount, maxLiveEnemies);
+
+        GameObject[] prefabs = config.enemyPrefabs;
+        float share = (float)enemyCount / prefabs.Length;
+        int total = 0;
+        foreach (GameObject prefab in prefabs)
+        {
+            if (prefab == null) continue;
+            int spawns = Mathf.CeilToInt(share);
+            total += prefab.TryGetComponent(out EnemyBase template) ? template.PrewarmCount(spawns) : spawns;
+        }
+        return Mathf.Min(total, maxLiveEnemies);
+    }
+
+    private Model Fit()
+    {
+        var rows = new List<WaveTelemetry.Wave>();
+        foreach (Sample sample in samples)
+        {
+            if (Matches(sample)) rows.Add(sample.wave);
+        }
+
+        Model model = rows.Count >= MinWavesForFullModel ? Solve(rows, 3) : default;
+        if (!model.valid || model.perEnemy < 0f || model.perOrb < 0f || model.perProjectile < 0f)
+            model = Solve(rows, 1);
+        return model;
+    }
+
+    /// <summary>
+    /// Least squares over [1, enemies, orbs, projectiles] (the first 1 + regressors columns), with a
+    /// small ridge term so collinear counts still solve
+    /// </summary>
+    private static Model Solve(List<WaveTelemetry.Wave> rows, int regressors)
+    {
+        int n = regressors + 1;
+        if (rows.Count < n + 1) return default;
+
+        var a = new double[n, n + 1];
+        var x = new double[n];
+        foreach (WaveTelemetry.Wave row in rows)
+        {
+            Features(row, x);
+            for (int i = 0; i < n; i++)
+            {
+                for (int j = 0; j < n; j++) a[i, j] += x[i] * x[j];
+                a[i, n] += x[i] * row.frameMsP90;
+            }
+        }
+
+        double diagonal = 0.0;
+        for (int i = 1; i < n; i++) diagonal += a[i, i];
+        double ridge = 1e-6 + 1e-4 * diagonal / regressors;
+        for (int i = 1; i < n; i++) a[i, i] += ridge;
+
+        double[] beta = GaussianSolve(a, n);
+        if (beta == null) return default;
+
+        var model = new Model
+        {
+            valid = true,
+            baseMs = (float)beta[0],
+            perEnemy = (float)beta[1],
+            perOrb = regressors > 1 ? (float)beta[2] : 0f,
+            perProjectile = regressors > 2 ? (float)beta[3] : 0f,
+            samples = rows.Count,
+        };
+
+        double mean = 0.0;
+        foreach (WaveTelemetry.Wave row in rows) mean += row.frameMsP90;
+        mean /= rows.Count;
+
+        double residual = 0.0;
+        double spread = 0.0;
+        foreach (WaveTelemetry.Wave row in rows)
+        {
+            double error = row.frameMsP90 - Predict(model, row.peakEnemies, row.peakOrbs, row.peakProjectiles);
+            residual += error * error;
+            spread += (row.frameMsP90 - mean) * (row.frameMsP90 - mean);
+        }
+        model.rSquared = spread > 0.0 ? (float)(1.0 - residual / spread) : 1f;
+        return model;
+    }
+
+    private static void Features(WaveTelemetry.Wave row, double[] x)
+    {
+        x[0] = 1.0;
+        if (x.Length > 1) x[1] = row.peakEnemies;
+        if (x.Length > 2) x[2] = row.peakOrbs;
+        if (x.Length > 3) x[3] = row.peakProjectiles;
+    }
+
+    private static double[] GaussianSolve(double[,] a, int n)
+    {
+        for (int col = 0; col < n; col++)
+        {
+            int pivot = col;
+            for (int r = col + 1; r < n; r++)
+            {
+                if (System.Math.Abs(a[r, col]) > System.Math.Abs(a[pivot, col])) pivot = r;
+            }
+            if (System.Math.Abs(a[pivot, col]) < 1e-12) return null;
+
+            for (int c = 0; c <= n; c++)
+                (a[col, c], a[pivot, c]) = (a[pivot, c], a[col, c]);
+
+            for (int r = col + 1; r < n; r++)
+            {
+                double factor = a[r, col] / a[col, col];
+                for (int c = col; c <= n; c++) a[r, c] -= factor * a[col, c];
+            }
+        }
+
+        var result = new double[n];
+        for (int r = n - 1; r >= 0; r--)
+        {
+            double sum = a[r, n];
+            for (int c = r + 1; c < n; c++) sum -= a[r, c] * result[c];
+            result[r] = sum / a[r, r];
+        }
+        return result;
+    }
+
+    private static float Predict(Model model, float enemies, float orbs, float projectiles)
+    {
+        return model.baseMs + model.perEnemy * enemies + model.perOrb * orbs + model.perProjectile * projectiles;
+    }
+
+    // ==================== UI ====================
+
+    private void OnGUI()
+    {
+        using (new EditorGUILayout.HorizontalScope(EditorStyles.toolbar))
+        {
+            if (GUILayout.Button("Reload", EditorStyles.toolbarButton, GUILayout.Width(60))) Reload();
+            if (GUILayout.Button("Add Report...", EditorStyles.toolbarButton, GUILayout.Width(90)))
+            {
+                string path = EditorUtility.OpenFilePanel("Wave telemetry report", TelemetryFolder, "json");
+                if (!string.IsNullOrEmpty(path) && !extraFiles.Contains(path))
+                {
+                    extraFiles.Add(path);
+                    Reload();
+                }
+            }
+            if (GUILayout.Button("Open Folder", EditorStyles.toolbarButton, GUILayout.Width(80)))
+            {
+                Directory.CreateDirectory(TelemetryFolder);
+                EditorUtility.RevealInFinder(TelemetryFolder);
+            }
+            GUILayout.FlexibleSpace();
+            GUILayout.Label(EditorPrefs.GetBool(WaveTelemetry.EditorEnabledKey, false) ? "Recording in play mode" : "Recording off", EditorStyles.miniLabel);
+        }
+
+        var deviceOptions = new string[devices.Count + 1];
+        deviceOptions[0] = "All devices";
+        for (int i = 0; i < devices.Count; i++) deviceOptions[i + 1] = devices[i];
+        deviceIndex = EditorGUILayout.Popup("Device", deviceIndex, deviceOptions);
+
+        EditorGUI.BeginChangeCheck();
+        budgetMs = EditorGUILayout.FloatField("Frame budget (p90 ms)", budgetMs);
+        if (EditorGUI.EndChangeCheck()) EditorPrefs.SetFloat(BudgetKey, Mathf.Max(1f, budgetMs));
+
+        Model model = Fit();
+        DrawModelSummary(model);
+
+        scroll = EditorGUILayout.BeginScrollView(scroll);
+        DrawConfigTable(model);
+
+        EditorGUILayout.Space();
+        showWaves = EditorGUILayout.Foldout(showWaves, $"Recorded waves ({samples.Count})", true);
+        if (showWaves) DrawWaves();
+        EditorGUILayout.EndScrollView();
+    }
+
+    private void DrawModelSummary(Model model)
+    {
+        if (!model.valid)
+        {
+            EditorGUILayout.HelpBox(
+                "Not enough recorded waves to fit a cost model. Enable Tools/BROcoli/Record Wave Telemetry and play, " +
+                "run a build with -waveTelemetry, or add reports posted from WebGL (?waveTelemetry=<endpoint>).",
+                MessageType.Info);
+            return;
+        }
+
+        EditorGUILayout.HelpBox(
+            $"p90 ≈ {model.baseMs:F2} ms + {model.perEnemy * 1000f:F1} µs/enemy + {model.perOrb * 1000f:F1} µs/orb + " +
+            $"{model.perProjectile * 1000f:F1} µs/projectile   (R² {model.rSquared:F2}, {model.samples} waves, spawner cap {maxLiveEnemies})",
+            MessageType.None);
+    }
+
+    private void DrawConfigTable(Model model)
+    {
+        // Observed ratios over the selected device's waves
+        double enemies = 0.0, orbs = 0.0, projectiles = 0.0, survival = 0.0;
+        int survivalCount = 0;
+        foreach (Sample sample in samples)
+        {
+            if (!Matches(sample)) continue;
+
+            WaveTelemetry.Wave w = sample.wave;
+            enemies += w.peakEnemies;
+            orbs += w.peakOrbs;
+            projectiles += w.peakProjectiles;
+
+            configsByName.TryGetValue(w.config ?? "", out WaveConfig config);
+            float potential = PotentialEnemies(config, w.enemyCount);
+            if (potential > 0f)
+            {
+                survival += Mathf.Min(1f, w.peakEnemies / potential);
+                survivalCount++;
+            }
+        }
+        float orbRatio = enemies > 0.0 ? (float)(orbs / enemies) : 0f;
+        float projectileRatio = enemies > 0.0 ? (float)(projectiles / enemies) : 0f;
+        float survivalRatio = survivalCount > 0 ? (float)(survival / survivalCount) : 1f;
+
+        using (new EditorGUILayout.HorizontalScope(EditorStyles.toolbar))
+        {
+            GUILayout.Label("Config", GUILayout.Width(140));
+            GUILayout.Label("Count", GUILayout.Width(50));
+            GUILayout.Label("Interval", GUILayout.Width(55));
+            GUILayout.Label("Peak enemies", GUILayout.Width(95));
+            GUILayout.Label("Est. p90", GUILayout.Width(65));
+            GUILayout.Label("Observed p90", GUILayout.Width(85));
+            GUILayout.Label("Max count in budget", GUILayout.Width(125));
+        }
+
+        float perEnemyEffective = model.perEnemy + model.perOrb * orbRatio + model.perProjectile * projectileRatio;
+        Color defaultColor = GUI.color;
+
+        foreach (WaveConfig config in configs)
+        {
+            // Recorded waves of this config on the selected device
+            float observedPeak = 0f, observedP90 = 0f;
+            int observed = 0;
+            foreach (Sample sample in samples)
+            {
+                if (!Matches(sample) || sample.wave.config != config.name) continue;
+                observedPeak += sample.wave.peakEnemies;
+                observedP90 += sample.wave.frameMsP90;
+                observed++;
+            }
+
+            float potential = PotentialEnemies(config, config.enemyCount);
+            float peak = observed > 0 ? observedPeak / observed : potential * survivalRatio;
+            float estimate = model.valid ? Predict(model, peak, peak * orbRatio, peak * projectileRatio) : 0f;
+
+            string maxCount = "-";
+            if (model.valid && perEnemyEffective > 0f && config.enemyCount > 0)
+            {
+                float enemiesInBudget = (budgetMs - model.baseMs) / perEnemyEffective;
+                float enemiesPerCount = PotentialEnemies(config, config.enemyCount) * survivalRatio / config.enemyCount;
+                if (enemiesInBudget <= 0f) maxCount = "0";
+                else if (enemiesInBudget >= maxLiveEnemies * survivalRatio) maxCount = "any (spawner cap)";
+                else if (enemiesPerCount > 0f) maxCount = Mathf.FloorToInt(enemiesInBudget / enemiesPerCount).ToString();
+            }
+
+            using (new EditorGUILayout.HorizontalScope())
+            {
+                if (GUILayout.Button(config.name, EditorStyles.label, GUILayout.Width(140)))
+                    EditorGUIUtility.PingObject(config);
+                GUILayout.Label(config.enemyCount.ToString(), GUILayout.Width(50));
+                GUILayout.Label(config.spawnInterval.ToString("F2"), GUILayout.Width(55));
+                GUILayout.Label(observed > 0 ? $"{peak:F0} (rec.)" : $"{peak:F0}", GUILayout.Width(95));
+
+                GUI.color = model.valid && estimate > budgetMs ? new Color(1f, 0.5f, 0.5f) : defaultColor;
+                GUILayout.Label(model.valid ? $"{estimate:F2} ms" : "-", GUILayout.Width(65));
+                GUI.color = observed > 0 && observedP90 / observed > budgetMs ? new Color(1f, 0.5f, 0.5f) : defaultColor;
+                GUILayout.Label(observed > 0 ? $"{observedP90 / observed:F2} ms" : "-", GUILayout.Width(85));
+                GUI.color = defaultColor;
+
+                GUILayout.Label(maxCount, GUILayout.Width(125));
+            }
+        }
+    }
+
+    private void DrawWaves()
+    {
+        foreach (Sample sample in samples)
+        {
+            if (!Matches(sample)) continue;
+
+            WaveTelemetry.Wave w = sample.wave;
+            EditorGUILayout.LabelField(
+                $"#{w.wave} {w.config}{(w.completed ? "" : " (ended)")}",
+                $"{w.peakEnemies} enemies, {w.peakOrbs} orbs, {w.peakProjectiles} proj, {w.peakVoices} voices | " +
+                $"p50 {w.frameMsP50:F1} p90 {w.frameMsP90:F1} p99 {w.frameMsP99:F1} ms | GC {w.gcAllocatedBytesPerFrame:F0} B/frame | Q{w.peakQualityLevel}");
+        }
+    }
+}
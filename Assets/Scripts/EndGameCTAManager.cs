@@ -90,7 +90,7 @@ public class EndGameCTAManager : MonoBehaviour
 
     void ShowCTA()
     {
-        int playerScore = PlayerPrefs.GetInt("LastScore", 0);
+        int playerScore = SaveService.GetInt(SaveService.LastScoreKey, 0);
         Debug.Log($"[EndGameCTA] Showing CTA - Score: {playerScore}, Min: {minScoreToShowCTA}");
         
         if (playerScore < minScoreToShowCTA)
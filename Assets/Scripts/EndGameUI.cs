@@ -120,25 +120,9 @@ public class EndGameUI : MonoBehaviour
         // Rate limit
         if (Time.unscaledTime - lastNavTime < NavRepeatDelay) return;
         
-        float nav = 0f;
-        
-        // Keyboard - support both horizontal and vertical
-        if (Input.GetKey(KeyCode.UpArrow) || Input.GetKey(KeyCode.W) || 
-            Input.GetKey(KeyCode.LeftArrow) || Input.GetKey(KeyCode.A)) nav = -1f;
-        else if (Input.GetKey(KeyCode.DownArrow) || Input.GetKey(KeyCode.S) ||
-                 Input.GetKey(KeyCode.RightArrow) || Input.GetKey(KeyCode.D)) nav = 1f;
-        
-        // Gamepad
-        if (Gamepad.current != null)
-        {
-            Vector2 dpad = Gamepad.current.dpad.ReadValue();
-            Vector2 stick = Gamepad.current.leftStick.ReadValue();
-            
-            if (Mathf.Abs(dpad.y) > 0.5f) nav = -Mathf.Sign(dpad.y);
-            else if (Mathf.Abs(dpad.x) > 0.5f) nav = Mathf.Sign(dpad.x);
-            else if (Mathf.Abs(stick.y) > 0.5f) nav = -Mathf.Sign(stick.y);
-            else if (Mathf.Abs(stick.x) > 0.5f) nav = Mathf.Sign(stick.x);
-        }
+        // Both axes: up/left = previous, down/right = next (InputSampler)
+        InputSnapshot input = InputSampler.Current;
+        float nav = input.navigate.y != 0f ? -input.navigate.y : input.navigate.x;
         
         // Navigate
         if (Mathf.Abs(nav) > 0.1f)
@@ -153,11 +137,7 @@ public class EndGameUI : MonoBehaviour
         }
         
         // Submit with Enter/Space/Gamepad A
-        bool submit = Input.GetKeyDown(KeyCode.Return) || Input.GetKeyDown(KeyCode.Space);
-        if (Gamepad.current != null && Gamepad.current.buttonSouth.wasPressedThisFrame)
-        {
-            submit = true;
-        }
+        bool submit = input.submit;
         
         if (submit && selectedIndex >= 0 && selectedIndex < menuButtons.Length)
         {
@@ -228,13 +208,13 @@ public class EndGameUI : MonoBehaviour
 
     public void Restart()
     {
-        Debug.Log("Restarting game");
+        GameLog.Info(LogCategory.UI, "Restarting game");
         SceneManager.LoadScene("Game");
     }
 
     public void GoToMainMenu()
     {
-        Debug.Log("Going to main menu");
+        GameLog.Info(LogCategory.UI, "Going to main menu");
         SceneManager.LoadScene("MainMenuScene");
     }
 }
@@ -1,7 +1,9 @@
 using UnityEngine;
 
 /// <summary>
-/// Procedural walk animation for enemies - adds pulsating scale and rotation based on movement
+/// Procedural walk animation for enemies - adds pulsating scale and rotation based on movement.
+/// The pose is evaluated for all enemies at once by EnemySimulationManager; this component only
+/// holds the settings and registers its visual.
 /// </summary>
 public class EnemyWalkAnimation : MonoBehaviour
 {
@@ -27,7 +29,12 @@ public class EnemyWalkAnimation : MonoBehaviour
     private Vector3 basePosition;
     private Rigidbody2D rb;
     private float timeOffset;
-    private float currentSpin = 0f;
+    private bool initialized = false;
+
+    /// <summary>
+    /// Slot in EnemySimulationManager (-1 when not registered). Managed by EnemySimulationManager.
+    /// </summary>
+    public int SimulationIndex { get; set; } = -1;
     
     void Start()
     {
@@ -62,52 +69,41 @@ public class EnemyWalkAnimation : MonoBehaviour
         
         // Random offset so not all enemies animate in sync
         timeOffset = Random.Range(0f, Mathf.PI * 2f);
+
+        initialized = true;
+        EnemySimulationManager.Register(this, visualTransform, rb, BuildParams());
     }
-    
-    void Update()
+
+    void OnEnable()
     {
-        if (visualTransform == null) return;
-        
-        float time = Time.time + timeOffset;
-        float speed = rb != null ? rb.linearVelocity.magnitude : 0f;
-        
-        // Intensity scales with movement speed (0.5 to 1.5 range)
-        float intensity = Mathf.Clamp(0.5f + speed * 0.15f, 0.5f, 1.5f);
-        
-        // --- Pulsating Scale ---
-        // Creates a breathing/squash-stretch effect
-        float pulsatePhase = Mathf.Sin(time * pulsateSpeed) * intensity;
-        float scaleX = baseScale.x * (1f + pulsatePhase * pulsateAmountX);
-        float scaleY = baseScale.y * (1f - pulsatePhase * pulsateAmountY); // Inverse for squash/stretch
-        float scaleZ = baseScale.z * (1f + pulsatePhase * pulsateAmountZ);
-        
-        visualTransform.localScale = new Vector3(scaleX, scaleY, scaleZ);
-        
-        // --- Wobble/Spin Rotation ---
-        // Base wobble
-        float wobble = Mathf.Sin(time * wobbleSpeed) * wobbleAmount * intensity;
-        
-        // Add spin based on movement direction
-        if (rb != null && speed > 0.5f)
-        {
-            // Spin in the direction of movement
-            float targetSpin = rb.linearVelocity.x * spinSpeedMultiplier;
-            currentSpin = Mathf.Lerp(currentSpin, targetSpin, Time.deltaTime * 5f);
-        }
-        else
+        // First enable happens before Start - registration waits for initialization there
+        if (initialized)
+            EnemySimulationManager.Register(this, visualTransform, rb, BuildParams());
+    }
+
+    private EnemyWalkParams BuildParams()
+    {
+        return new EnemyWalkParams
         {
-            currentSpin = Mathf.Lerp(currentSpin, 0f, Time.deltaTime * 3f);
-        }
-        
-        visualTransform.localRotation = Quaternion.Euler(0f, 0f, wobble + currentSpin);
-        
-        // --- Vertical Bounce ---
-        float bounce = Mathf.Abs(Mathf.Sin(time * bounceSpeed)) * bounceAmount * intensity;
-        visualTransform.localPosition = basePosition + new Vector3(0f, bounce, 0f);
+            pulsateSpeed = pulsateSpeed,
+            pulsateAmountX = pulsateAmountX,
+            pulsateAmountY = pulsateAmountY,
+            pulsateAmountZ = pulsateAmountZ,
+            wobbleSpeed = wobbleSpeed,
+            wobbleAmount = wobbleAmount,
+            spinSpeedMultiplier = spinSpeedMultiplier,
+            bounceSpeed = bounceSpeed,
+            bounceAmount = bounceAmount,
+            timeOffset = timeOffset,
+            baseScale = baseScale,
+            basePosition = basePosition
+        };
     }
     
     void OnDisable()
     {
+        EnemySimulationManager.Unregister(this);
+
         // Reset to base state when disabled
         if (visualTransform != null)
         {
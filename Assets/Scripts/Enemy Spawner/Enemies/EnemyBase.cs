@@ -10,6 +10,34 @@ public abstract class EnemyBase : MonoBehaviour
 
     public event Action<EnemyBase> OnDeath;
 
+    /// <summary>
+    /// Prefab this enemy was taken from by EnemyPool (null if placed in scene or instantiated directly)
+    /// </summary>
+    public GameObject PoolPrefab { get; set; }
+
+    /// <summary>
+    /// True between the killing blow and the next spawn from the pool
+    /// </summary>
+    public bool IsDead => isDead;
+    private bool isDead = false;
+
+    /// <summary>
+    /// Unique per life: a new id every time the enemy is enabled, so pooled enemies coming back
+    /// never match state recorded against their previous life
+    /// </summary>
+    public int SpawnId { get; private set; }
+    private static int nextSpawnId;
+
+    /// <summary>
+    /// Slot in EnemyRegistry (-1 when not registered). Managed by EnemyRegistry.
+    /// </summary>
+    public int RegistryIndex { get; set; } = -1;
+
+    /// <summary>
+    /// Slot in EnemySimulationManager (-1 when not simulated). Managed by EnemySimulationManager.
+    /// </summary>
+    public int SimulationIndex { get; set; } = -1;
+
     public bool healthBarVisable = false;
     public bool alwaysShowHealthBar = false;
     public float TimeToStartSpawning = 0f;
@@ -19,8 +47,6 @@ public abstract class EnemyBase : MonoBehaviour
     float healthBarTimer = 0f;
     float healthBarDisplayDuration = 2f;
     
-    private static bool isQuitting = false;
-    
     [Header("Enemy Stats")]
     public float Speed = 2f;
     public float Health = 50f;
@@ -41,25 +67,83 @@ public abstract class EnemyBase : MonoBehaviour
     public Transform player;
 
     private GameStates gameStates;
+    private PlayerController playerController;
+    private Transform playerControllerOwner;
 
     public Rigidbody2D rb;
 
+    /// <summary>
+    /// Main collider of this enemy (cached in Awake)
+    /// </summary>
+    public Collider2D BodyCollider { get; private set; }
+
+    /// <summary>
+    /// World-space center of the enemy's collider bounds (transform position if it has none)
+    /// </summary>
+    public Vector2 BoundsCenter => BodyCollider != null ? (Vector2)BodyCollider.bounds.center : (Vector2)transform.position;
+
+    // Shared neighbour buffer for separation queries (EnemySimulationManager steps enemies one at a time)
+    private static readonly EnemyBase[] SeparationBuffer = new EnemyBase[64];
+
+    // Prefab defaults captured in Awake so pooled enemies come back exactly like new ones
+    private float spawnSpeed;
+    private float spawnHealth;
+    private float spawnMaxHealth;
+    private float spawnDamage;
+    private int spawnScoreValue;
+    private Vector3 spawnLocalScale;
+
+    // Hit flash - instanced meshes flash in the shader, sprite-only enemies through the coroutine
+    private const float HitFlashDuration = 0.05f;
+    private static readonly WaitForSeconds HitFlashWait = new WaitForSeconds(HitFlashDuration);
+    private InstancedEnemyMesh[] instancedMeshes;
+    private SpriteRenderer flashRenderer;
+    private Color flashSpawnColor;
+
     protected virtual void Awake()
     {
         gameStates = FindFirstObjectByType<GameStates>();
         rb = GetComponent<Rigidbody2D>();
+        BodyCollider = GetComponent<Collider2D>();
         player = GameObject.FindGameObjectWithTag("Player")?.transform;
         
         // Try to get walk audio component if not assigned
         if (walkAudio == null)
             walkAudio = GetComponent<ProceduralEnemyWalkAudio>();
+
+        // Meshes move to EnemyRenderManager's instanced batches
+        instancedMeshes = InstancedEnemyMesh.AttachAll(gameObject);
+
+        flashRenderer = GetComponentInChildren<SpriteRenderer>();
+        if (flashRenderer != null)
+            flashSpawnColor = flashRenderer.color;
+
+        spawnSpeed = Speed;
+        spawnHealth = Health;
+        spawnMaxHealth = MaxHealth;
+        spawnDamage = Damage;
+        spawnScoreValue = ScoreValue;
+        spawnLocalScale = transform.localScale;
     }
 
     [Header("Knockback")]
     [SerializeField] protected float enemyKnockbackForce = 5f;
     [SerializeField] protected float enemyKnockbackDuration = 0.12f;
-    protected float knockbackTimer = 0f;
-    protected bool isKnockedBack = false;
+
+    /// <summary>
+    /// How EnemySimulationManager steers this enemy towards the player
+    /// </summary>
+    public virtual EnemySteeringMode Steering => EnemySteeringMode.Chase;
+
+    /// <summary>
+    /// KeepDistance steering: stop approaching inside this distance
+    /// </summary>
+    public virtual float SteeringStopDistance => 0f;
+
+    /// <summary>
+    /// KeepDistance steering: back away from the player inside this distance
+    /// </summary>
+    public virtual float SteeringRetreatDistance => playerSeparationRadius;
     
     public void TakeDamage(float damage)
     {
@@ -68,11 +152,13 @@ public abstract class EnemyBase : MonoBehaviour
     
     public void TakeDamage(float damage, Vector2 knockbackDirection)
     {
+        // Ignore hits queued against an enemy that already died this frame
+        if (isDead) return;
+
         Health -= damage;
         if (Health <= 0f)
         {
-            Destroy(gameObject);
-            OnDeath?.Invoke(this);
+            Die();
             return;
         }
         
@@ -83,7 +169,15 @@ public abstract class EnemyBase : MonoBehaviour
         }
         
         // Flash effect on hit
-        StartCoroutine(HitFlash());
+        if (instancedMeshes.Length > 0)
+        {
+            foreach (InstancedEnemyMesh mesh in instancedMeshes)
+                mesh.Flash(HitFlashDuration);
+        }
+        else
+        {
+            StartCoroutine(HitFlash());
+        }
 
         if (alwaysShowHealthBar) return;
 
@@ -96,23 +190,36 @@ public abstract class EnemyBase : MonoBehaviour
     public void ApplyKnockback(Vector2 direction)
     {
         if (rb == null) return;
-        isKnockedBack = true;
-        knockbackTimer = enemyKnockbackDuration;
+        EnemySimulationManager.StartKnockback(this, enemyKnockbackDuration);
         rb.linearVelocity = direction * enemyKnockbackForce;
     }
     
     private System.Collections.IEnumerator HitFlash()
     {
-        SpriteRenderer sr = GetComponentInChildren<SpriteRenderer>();
+        SpriteRenderer sr = flashRenderer;
         if (sr != null)
         {
             Color originalColor = sr.color;
             sr.color = Color.white;
-            yield return new WaitForSeconds(0.05f);
+            yield return HitFlashWait;
             sr.color = originalColor;
         }
     }
 
+    protected virtual void OnEnable()
+    {
+        SpawnId = ++nextSpawnId;
+        EnemyRegistry.Register(this);
+        if (rb != null)
+            EnemySimulationManager.Register(this);
+    }
+
+    protected virtual void OnDisable()
+    {
+        EnemyRegistry.Unregister(this);
+        EnemySimulationManager.Unregister(this);
+    }
+
     void Start()
     {
         GameObject playerObj = GameObject.FindGameObjectWithTag("Player");
@@ -124,6 +231,12 @@ public abstract class EnemyBase : MonoBehaviour
         if (_healthBar != null)
             healthBar = _healthBar;
 
+        ResetHealthBar();
+    }
+
+    private void ResetHealthBar()
+    {
+        healthBarTimer = 0f;
         if (healthBar != null)
         {
             healthBar.UpdateBar(Health, MaxHealth);
@@ -140,24 +253,71 @@ public abstract class EnemyBase : MonoBehaviour
         }
     }
 
-    public virtual void Update()
+    /// <summary>
+    /// Pool instances EnemySpawner should prewarm for this many planned spawns of the prefab
+    /// (more for enemies that spawn copies of themselves)
+    /// </summary>
+    public virtual int PrewarmCount(int spawns)
     {
-        if (player == null) return;
-        
-        // Knockback timer
-        if (isKnockedBack)
+        return spawns;
+    }
+
+    /// <summary>
+    /// Restore prefab defaults when taken from EnemyPool.
+    /// Overrides must call base and reset their own per-life state.
+    /// </summary>
+    public virtual void ResetForSpawn()
+    {
+        isDead = false;
+        OnDeath = null;
+
+        Speed = spawnSpeed;
+        Health = spawnHealth;
+        MaxHealth = spawnMaxHealth;
+        Damage = spawnDamage;
+        ScoreValue = spawnScoreValue;
+        transform.localScale = spawnLocalScale;
+
+        if (rb != null)
         {
-            knockbackTimer -= Time.deltaTime;
-            if (knockbackTimer <= 0f)
-            {
-                isKnockedBack = false;
-            }
+            rb.position = transform.position;
+            rb.linearVelocity = Vector2.zero;
+            rb.angularVelocity = 0f;
         }
 
+        if (flashRenderer != null)
+            flashRenderer.color = flashSpawnColor;
+
+        ResetHealthBar();
+    }
+
+    /// <summary>
+    /// Called by EnemyPool right before the enemy is deactivated and pooled.
+    /// </summary>
+    public virtual void OnDespawned()
+    {
+        OnDeath = null;
+        StopAllCoroutines();
+
+        if (flashRenderer != null)
+            flashRenderer.color = flashSpawnColor;
+
+        if (rb != null)
+            rb.linearVelocity = Vector2.zero;
+    }
+
+    /// <summary>
+    /// Per-frame behaviour, called by EnemySimulationManager instead of Update.
+    /// Movement, separation and knockback timing are handled by the manager.
+    /// </summary>
+    public virtual void SimulationUpdate(float deltaTime)
+    {
+        if (player == null) return;
+
         // Health bar timer logic
         if (healthBarVisable && !alwaysShowHealthBar && healthBar != null)
         {
-            healthBarTimer -= Time.deltaTime;
+            healthBarTimer -= deltaTime;
             if (healthBarTimer <= 0f)
             {
                 healthBarVisable = false;
@@ -165,20 +325,51 @@ public abstract class EnemyBase : MonoBehaviour
             }
         }
     }
-    
-    protected virtual void FixedUpdate()
+
+    private void Die()
     {
-        // Apply separation from other enemies and player in physics step
-        ApplySeparation();
+        isDead = true;
+
+        GrantDeathRewards();
+        OnDied();
+        OnDeath?.Invoke(this);
+
+        // Back to the pool (or destroyed if this enemy was not pooled)
+        EnemyPool.Despawn(this);
     }
 
-    void OnDestroy()
+    /// <summary>
+    /// Called by PlayerContactHandler in the physics step this enemy starts touching the player
+    /// </summary>
+    public virtual void OnPlayerContact()
     {
-        // Don't spawn objects if the application is quitting or scene is unloading
-        if (isQuitting) return;
-        if (!gameObject.scene.isLoaded) return;
-        
-        Debug.Log("Destroyed enemy, adding score: " + ScoreValue);
+    }
+
+    /// <summary>
+    /// The player's controller, looked up once per player instead of on every attack
+    /// </summary>
+    protected PlayerController GetPlayerController()
+    {
+        if (player == null) return null;
+        if (playerController == null || playerControllerOwner != player)
+        {
+            playerController = player.GetComponent<PlayerController>();
+            playerControllerOwner = player;
+        }
+        return playerController;
+    }
+
+    /// <summary>
+    /// Hook for subclasses that react to death (e.g. hydra splitting).
+    /// Runs before OnDeath subscribers and before the enemy is despawned.
+    /// </summary>
+    protected virtual void OnDied()
+    {
+    }
+
+    private void GrantDeathRewards()
+    {
+        GameLog.Verbose(LogCategory.Enemies, "Destroyed enemy, adding score: " + ScoreValue);
 
         if (gameStates)
         {
@@ -191,41 +382,30 @@ public abstract class EnemyBase : MonoBehaviour
             gameStates.score += ScoreValue;
         }
         
-        // Initialize and spawn experience gain object
+        // Drop experience (pooled, merges into a nearby orb if there is one)
         if (expGainPrefab != null)
         {
-            GameObject expGainObj = Instantiate(expGainPrefab.gameObject, transform.position, Quaternion.identity);
-            ExpGain expGainComp = expGainObj.GetComponent<ExpGain>();
-            if (expGainComp != null)
-            {
-                int expAmount = ScoreValue; // Example: 1 exp per 10 max health
-                expGainComp.Init(expAmount);
-            }
+            int expAmount = ScoreValue; // Example: 1 exp per 10 max health
+            ExpGainManager.Spawn(expGainPrefab, transform.position, expAmount);
         }
     }
     
-    void OnApplicationQuit()
-    {
-        isQuitting = true;
-    }
-    
     /// <summary>
-    /// Apply separation forces to prevent enemies from overlapping each other and the player
+    /// Separation push (per second) that keeps enemies from overlapping each other and the player.
+    /// EnemySimulationManager adds it to the steered velocity every physics step.
     /// </summary>
-    protected virtual void ApplySeparation()
+    public virtual Vector2 CalculateSeparationVelocity(Vector2 myPos)
     {
-        if (rb == null) return;
-        
         Vector2 separationVelocity = Vector2.zero;
-        Vector2 myPos = rb.position;
         
         // Separation from other enemies (strong - prevent stacking)
-        Collider2D[] nearbyEnemies = Physics2D.OverlapCircleAll(myPos, separationRadius, LayerMask.GetMask("Enemy"));
-        foreach (Collider2D col in nearbyEnemies)
+        int nearbyCount = EnemyRegistry.Query(myPos, separationRadius, SeparationBuffer);
+        for (int i = 0; i < nearbyCount; i++)
         {
-            if (col.gameObject == gameObject) continue;
+            EnemyBase other = SeparationBuffer[i];
+            if (other == this) continue;
             
-            Rigidbody2D otherRb = col.attachedRigidbody;
+            Rigidbody2D otherRb = other.rb;
             if (otherRb == null) continue;
             
             Vector2 toMe = myPos - otherRb.position;
@@ -255,10 +435,6 @@ public abstract class EnemyBase : MonoBehaviour
             }
         }
         
-        // Apply separation as velocity change
-        if (separationVelocity.sqrMagnitude > 0.01f)
-        {
-            rb.linearVelocity += separationVelocity * Time.fixedDeltaTime;
-        }
+        return separationVelocity;
     }
 }
\ No newline at end of file
@@ -4,6 +4,7 @@ using UnityEngine;
 /// Applies per-instance color tint variations to enemy renderers
 /// using MaterialPropertyBlock to avoid material duplication.
 /// Works with URP Lit shader by tinting the _BaseColor property.
+/// Meshes drawn by EnemyRenderManager take the tint as an instanced property instead.
 /// </summary>
 public class EnemyColorVariant : MonoBehaviour
 {
@@ -75,6 +76,12 @@ public class EnemyColorVariant : MonoBehaviour
         {
             if (r == null) continue;
 
+            if (r.TryGetComponent(out InstancedEnemyMesh instanced))
+            {
+                instanced.SetTint(v.tint);
+                continue;
+            }
+
             r.GetPropertyBlock(mpb);
             mpb.SetColor(BaseColorId, v.tint);
             mpb.SetColor(ColorId, v.tint);
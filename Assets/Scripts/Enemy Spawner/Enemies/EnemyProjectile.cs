@@ -1,8 +1,9 @@
 using UnityEngine;
 
-[RequireComponent(typeof(Collider2D))]
-[RequireComponent(typeof(Rigidbody2D))]
-public class EnemyProjectile : MonoBehaviour
+/// <summary>
+/// Ranged enemy shot. Flown and hit-tested against the player by ProjectileManager.
+/// </summary>
+public class EnemyProjectile : PooledProjectile
 {
     public float damage = 10f;
     public float speed = 10f;
@@ -13,20 +14,12 @@ public class EnemyProjectile : MonoBehaviour
     [SerializeField] private Transform visualTransform;    // The 3D model to scale during fizzle
     [SerializeField] private float spinSpeed = 180f;       // Rotation speed in degrees/second
 
-    private Rigidbody2D rb;
-    private Collider2D col;
-    private float spawnTime;
     private Vector3 initialScale;
     private bool isFizzling;
 
-    void Awake()
+    protected override void Awake()
     {
-        rb = GetComponent<Rigidbody2D>();
-        col = GetComponent<Collider2D>();
-        rb.gravityScale = 0f;
-        rb.collisionDetectionMode = CollisionDetectionMode2D.Continuous;
-
-        col.isTrigger = true;
+        base.Awake();
         
         if (visualTransform != null)
             initialScale = visualTransform.localScale;
@@ -34,26 +27,23 @@ public class EnemyProjectile : MonoBehaviour
 
     public void Init(Vector2 direction)
     {
-        rb.linearVelocity = direction.normalized * speed;
-        spawnTime = Time.time;
-        
-        // Capture initial scale if not already done
-        if (visualTransform != null && initialScale == Vector3.zero)
-            initialScale = visualTransform.localScale;
+        // Pooled shots start unfizzled
+        isFizzling = false;
+        if (visualTransform != null)
+            visualTransform.localScale = initialScale;
             
-        Destroy(gameObject, lifeTime);
+        Launch(direction.normalized * speed, lifeTime, true);
     }
     
-    void Update()
+    public override void SimulationUpdate(float timeAlive, float deltaTime)
     {
         // Spin the visual
         if (visualTransform != null)
         {
-            visualTransform.Rotate(0f, spinSpeed * Time.deltaTime, 0f, Space.Self);
+            visualTransform.Rotate(0f, spinSpeed * deltaTime, 0f, Space.Self);
         }
         
         // Fizzle out effect - shrink towards end of life
-        float timeAlive = Time.time - spawnTime;
         float fizzleThreshold = lifeTime - fizzleStartTime;
         
         if (timeAlive > fizzleThreshold && visualTransform != null)
@@ -65,24 +55,12 @@ public class EnemyProjectile : MonoBehaviour
         }
     }
 
-    void OnTriggerEnter2D(Collider2D other)
+    public override bool OnHitPlayer(PlayerStats stats)
     {
-        // Check if hit player
-        if (other.CompareTag("Player"))
-        {
-            PlayerStats stats = other.GetComponentInChildren<PlayerStats>();
-
-            stats.ApplyDamage(damage);
-            
-            // Play enemy projectile hit sound
-            ProceduralEnemyProjectileHitAudio.PlayHit(transform.position, ProceduralEnemyProjectileHitAudio.EnemyHitSoundType.PlasmaImpact, 0.45f);
-            
-            Destroy(gameObject);
-        }
-        // Destroy on hitting walls/obstacles (but not other enemies)
-        else if (!other.CompareTag("Enemy") && !other.isTrigger)
-        {
-            Destroy(gameObject);
-        }
+        stats.ApplyDamage(damage);
+        
+        // Play enemy projectile hit sound
+        ProceduralEnemyProjectileHitAudio.PlayHit(transform.position, ProceduralEnemyProjectileHitAudio.EnemyHitSoundType.PlasmaImpact, 0.45f);
+        return true;
     }
 }
@@ -53,41 +53,45 @@ public class EnemyScript : EnemyBase
         }
     }
 
-    protected override void FixedUpdate()
+    public override void SimulationUpdate(float deltaTime)
     {
-        if (player == null) return;
-        
-        // Don't move toward player during knockback
-        if (isKnockedBack)
-        {
-            // Still apply separation during knockback
-            base.FixedUpdate();
-            return;
-        }
-
-        Vector2 dir = (Vector2)player.position - rb.position;
-        float distToPlayer = dir.magnitude;
+        base.SimulationUpdate(deltaTime);
         
-        if (distToPlayer < 0.0001f) return;
-
-        dir.Normalize();
-
-        // Move towards player at full speed - separation handles preventing overlap
-        Vector2 targetVel = dir * Speed;
-
-        // Smooth acceleration towards target velocity
-        rb.linearVelocity = Vector2.MoveTowards(rb.linearVelocity, targetVel, acceleration * Time.fixedDeltaTime);
+        // Update attack animation only - attacks start on player contact
+        UpdateAttackAnimation(deltaTime);
+    }
+    
+    public override void ResetForSpawn()
+    {
+        base.ResetForSpawn();
         
-        // Apply separation AFTER movement (so it can push away)
-        base.FixedUpdate();
+        nextMeleeAttackTime = 0f;
+        CancelAttackAnimation();
     }
-
-    public override void Update()
+    
+    public override void OnDespawned()
+    {
+        CancelAttackAnimation();
+        base.OnDespawned();
+    }
+    
+    /// <summary>
+    /// Snap the visual back to rest if an attack is in progress
+    /// </summary>
+    private void CancelAttackAnimation()
     {
-        base.Update();
+        if (isAttacking)
+        {
+            visualTransform.localPosition = attackStartPos;
+        }
         
-        // Update attack animation only - attacks start via trigger collision
-        UpdateAttackAnimation();
+        isAttacking = false;
+        hasDamagedThisAttack = false;
+        attackPhase = 0;
+        attackTimer = 0f;
+        visualTransform.localScale = baseLocalScale;
+        if (spriteRenderer != null)
+            spriteRenderer.color = originalColor;
     }
     
     private void StartAttackAnimation()
@@ -105,11 +109,11 @@ public class EnemyScript : EnemyBase
         attackTargetPos = attackStartPos + (Vector3)(toPlayer * attackLungeDistance);
     }
     
-    private void UpdateAttackAnimation()
+    private void UpdateAttackAnimation(float deltaTime)
     {
         if (!isAttacking) return;
         
-        attackTimer += Time.deltaTime;
+        attackTimer += deltaTime;
         
         switch (attackPhase)
         {
@@ -204,7 +208,7 @@ public class EnemyScript : EnemyBase
     private void PerformMeleeAttack()
     {
         // Deal damage to player - only proceed if damage was actually dealt
-        var playerController = player.GetComponent<PlayerController>();
+        PlayerController playerController = GetPlayerController();
         if (playerController != null)
         {
             // Calculate knockback direction (away from enemy)
@@ -224,10 +228,10 @@ public class EnemyScript : EnemyBase
         }
     }
 
-    void OnTriggerEnter2D(Collider2D other)
+    public override void OnPlayerContact()
     {
         // Trigger attack animation on contact (animation will deal damage)
-        if (other.CompareTag("Player") && Time.time >= nextMeleeAttackTime && !isAttacking)
+        if (Time.time >= nextMeleeAttackTime && !isAttacking)
         {
             StartAttackAnimation();
         }
@@ -0,0 +1,142 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+/// <summary>
+/// Per-prefab object pool for enemies.
+/// Pooled instances live under an inactive root so they skip Awake/Update until spawned.
+/// The root belongs to the active scene, so the pool is emptied automatically on scene change.
+/// </summary>
+public static class EnemyPool
+{
+    private static Transform poolRoot;
+    private static readonly Dictionary<GameObject, Stack<EnemyBase>> available = new Dictionary<GameObject, Stack<EnemyBase>>();
+    private static readonly Dictionary<GameObject, int> totalCreated = new Dictionary<GameObject, int>();
+
+    /// <summary>
+    /// Number of instances ever created for a prefab (active + pooled)
+    /// </summary>
+    public static int GetTotalCount(GameObject prefab)
+    {
+        EnsureRoot();
+        return prefab != null && totalCreated.TryGetValue(prefab, out int count) ? count : 0;
+    }
+
+    /// <summary>
+    /// Number of inactive instances waiting in the pool for a prefab
+    /// </summary>
+    public static int GetAvailableCount(GameObject prefab)
+    {
+        EnsureRoot();
+        return prefab != null && available.TryGetValue(prefab, out var stack) ? stack.Count : 0;
+    }
+
+    /// <summary>
+    /// Create one inactive instance of the prefab and add it to the pool.
+    /// Returns false if the prefab has no EnemyBase component.
+    /// </summary>
+    public static bool PrewarmOne(GameObject prefab)
+    {
+        EnemyBase enemy = CreateInstance(prefab);
+        if (enemy == null) return false;
+
+        GetStack(prefab).Push(enemy);
+        return true;
+    }
+
+    /// <summary>
+    /// Take an enemy from the pool (or create one) and activate it at the given position.
+    /// The returned enemy has been reset to its prefab defaults.
+    /// </summary>
+    public static EnemyBase Spawn(GameObject prefab, Vector3 position, Quaternion rotation)
+    {
+        if (prefab == null) return null;
+
+        Stack<EnemyBase> stack = GetStack(prefab);
+        EnemyBase enemy = null;
+        while (stack.Count > 0 && enemy == null)
+        {
+            // Skip instances destroyed externally while pooled
+            enemy = stack.Pop();
+        }
+
+        if (enemy == null)
+        {
+            enemy = CreateInstance(prefab);
+            if (enemy == null) return null;
+        }
+
+        // Re-parenting out of the inactive root activates the hierarchy (Awake runs on first use)
+        Transform t = enemy.transform;
+        t.SetParent(null, false);
+        t.SetPositionAndRotation(position, rotation);
+        enemy.ResetForSpawn();
+        return enemy;
+    }
+
+    /// <summary>
+    /// Return an enemy to its pool. Enemies that did not come from the pool are destroyed.
+    /// </summary>
+    public static void Despawn(EnemyBase enemy)
+    {
+        if (enemy == null) return;
+
+        GameObject prefab = enemy.PoolPrefab;
+        if (prefab == null || !EnsureRoot())
+        {
+            Object.Destroy(enemy.gameObject);
+            return;
+        }
+
+        enemy.OnDespawned();
+        enemy.transform.SetParent(poolRoot, false);
+        GetStack(prefab).Push(enemy);
+    }
+
+    private static EnemyBase CreateInstance(GameObject prefab)
+    {
+        if (prefab == null || !EnsureRoot()) return null;
+
+        GameObject obj = Object.Instantiate(prefab, poolRoot, false);
+        EnemyBase enemy = obj.GetComponent<EnemyBase>();
+        if (enemy == null)
+        {
+            GameLog.Warning(LogCategory.Enemies, $"EnemyPool: Prefab '{prefab.name}' has no EnemyBase component, cannot pool it.");
+            Object.Destroy(obj);
+            return null;
+        }
+
+        obj.name = prefab.name;
+        enemy.PoolPrefab = prefab;
+        totalCreated[prefab] = GetTotalCount(prefab) + 1;
+        return enemy;
+    }
+
+    private static Stack<EnemyBase> GetStack(GameObject prefab)
+    {
+        if (!available.TryGetValue(prefab, out var stack))
+        {
+            stack = new Stack<EnemyBase>();
+            available[prefab] = stack;
+        }
+        return stack;
+    }
+
+    /// <summary>
+    /// Create the inactive pool root in the active scene if needed.
+    /// When the previous root was unloaded with its scene, stale bookkeeping is dropped.
+    /// </summary>
+    private static bool EnsureRoot()
+    {
+        if (poolRoot != null) return true;
+
+        available.Clear();
+        totalCreated.Clear();
+
+        if (!Application.isPlaying) return false;
+
+        GameObject rootObj = new GameObject("EnemyPool");
+        rootObj.SetActive(false);
+        poolRoot = rootObj.transform;
+        return true;
+    }
+}
@@ -0,0 +1,224 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+/// <summary>
+/// Shared registry of live enemies with a uniform spatial hash for allocation-free range queries.
+/// Enemies register in OnEnable and unregister in OnDisable.
+/// The hash is rebuilt lazily, at most once per physics step (or when the set of enemies changes),
+/// so every separation/targeting query in the same step shares one O(N) build.
+/// </summary>
+public static class EnemyRegistry
+{
+    public const float CellSize = 2.5f;           // Matches the default enemy separation radius
+    private const int BucketCount = 1024;         // Power of two so the hash can be masked
+    private const int BucketMask = BucketCount - 1;
+
+    private static readonly List<EnemyBase> enemies = new List<EnemyBase>(256);
+    private static readonly Dictionary<GameObject, EnemyBase> byGameObject = new Dictionary<GameObject, EnemyBase>(256);
+
+    // Snapshot sorted by bucket (counting sort), rebuilt from 'enemies'
+    private static EnemyBase[] sortedEnemies = new EnemyBase[256];
+    private static Vector2[] sortedPositions = new Vector2[256];
+    private static int[] sortedCellX = new int[256];
+    private static int[] sortedCellY = new int[256];
+    private static readonly int[] bucketStart = new int[BucketCount + 1];
+    private static readonly int[] bucketCursor = new int[BucketCount];
+
+    // Per-item scratch in registration order, filled before the scatter pass
+    private static Vector2[] scratchPositions = new Vector2[256];
+    private static int[] scratchCellX = new int[256];
+    private static int[] scratchCellY = new int[256];
+    private static int[] scratchBucket = new int[256];
+    private static int builtCount;
+
+    private static int version;
+    private static int builtVersion = -1;
+    private static float builtFixedTime = -1f;
+
+    /// <summary>
+    /// Number of registered (active) enemies
+    /// </summary>
+    public static int Count => enemies.Count;
+
+    /// <summary>
+    /// Registered enemy by index (0..Count-1). Order changes when enemies unregister.
+    /// </summary>
+    public static EnemyBase Get(int index) => enemies[index];
+
+    /// <summary>
+    /// Live enemy on a GameObject (e.g. a collision callback's other), without GetComponent
+    /// </summary>
+    public static EnemyBase FromGameObject(GameObject obj)
+    {
+        return obj != null && byGameObject.TryGetValue(obj, out EnemyBase enemy) ? enemy : null;
+    }
+
+    public static void Register(EnemyBase enemy)
+    {
+        if (enemy == null || enemy.RegistryIndex >= 0) return;
+
+        enemy.RegistryIndex = enemies.Count;
+        enemies.Add(enemy);
+        byGameObject[enemy.gameObject] = enemy;
+        version++;
+    }
+
+    public static void Unregister(EnemyBase enemy)
+    {
+        if (enemy == null) return;
+
+        int index = enemy.RegistryIndex;
+        if (index < 0 || index >= enemies.Count || enemies[index] != enemy) return;
+
+        // Swap-remove keeps unregistering O(1)
+        int last = enemies.Count - 1;
+        EnemyBase moved = enemies[last];
+        enemies[index] = moved;
+        moved.RegistryIndex = index;
+        enemies.RemoveAt(last);
+        byGameObject.Remove(enemy.gameObject);
+
+        enemy.RegistryIndex = -1;
+        version++;
+    }
+
+    /// <summary>
+    /// Find live enemies whose position lies within radius of center.
+    /// Fills results (like Physics2D.OverlapCircleNonAlloc) and returns how many were written.
+    /// </summary>
+    public static int Query(Vector2 center, float radius, EnemyBase[] results)
+    {
+        if (results == null || results.Length == 0) return 0;
+
+        EnsureBuilt();
+        if (builtCount == 0) return 0;
+
+        float radiusSqr = radius * radius;
+        int minX = Mathf.FloorToInt((center.x - radius) / CellSize);
+        int maxX = Mathf.FloorToInt((center.x + radius) / CellSize);
+        int minY = Mathf.FloorToInt((center.y - radius) / CellSize);
+        int maxY = Mathf.FloorToInt((center.y + radius) / CellSize);
+
+        int found = 0;
+        long cellCount = (long)(maxX - minX + 1) * (maxY - minY + 1);
+
+        // Very large radius: scanning the snapshot is cheaper than walking cells
+        if (cellCount > builtCount)
+        {
+            for (int i = 0; i < builtCount && found < results.Length; i++)
+            {
+                if ((sortedPositions[i] - center).sqrMagnitude <= radiusSqr && IsAlive(sortedEnemies[i]))
+                    results[found++] = sortedEnemies[i];
+            }
+            return found;
+        }
+
+        for (int cy = minY; cy <= maxY; cy++)
+        {
+            for (int cx = minX; cx <= maxX; cx++)
+            {
+                int bucket = Hash(cx, cy);
+                int end = bucketStart[bucket + 1];
+                for (int i = bucketStart[bucket]; i < end; i++)
+                {
+                    // Different cells can share a bucket - only accept items from the cell being visited
+                    if (sortedCellX[i] != cx || sortedCellY[i] != cy) continue;
+                    if ((sortedPositions[i] - center).sqrMagnitude > radiusSqr) continue;
+                    if (!IsAlive(sortedEnemies[i])) continue;
+
+                    results[found++] = sortedEnemies[i];
+                    if (found >= results.Length) return found;
+                }
+            }
+        }
+
+        return found;
+    }
+
+    /// <summary>
+    /// Force the spatial hash to be rebuilt on the next query
+    /// </summary>
+    public static void MarkDirty()
+    {
+        version++;
+    }
+
+    private static bool IsAlive(EnemyBase enemy)
+    {
+        return enemy != null && !enemy.IsDead && enemy.isActiveAndEnabled;
+    }
+
+    private static int Hash(int cx, int cy)
+    {
+        return ((cx * 73856093) ^ (cy * 19349663)) & BucketMask;
+    }
+
+    private static void EnsureBuilt()
+    {
+        if (builtVersion == version && builtFixedTime == Time.fixedTime) return;
+        Rebuild();
+    }
+
+    private static void Rebuild()
+    {
+        builtVersion = version;
+        builtFixedTime = Time.fixedTime;
+
+        int count = enemies.Count;
+        EnsureCapacity(count);
+        System.Array.Clear(bucketStart, 0, bucketStart.Length);
+
+        // Pass 1: read positions and count items per bucket (one slot ahead for the prefix sum)
+        for (int i = 0; i < count; i++)
+        {
+            EnemyBase enemy = enemies[i];
+            Vector2 pos = enemy.rb != null ? enemy.rb.position : (Vector2)enemy.transform.position;
+            int cx = Mathf.FloorToInt(pos.x / CellSize);
+            int cy = Mathf.FloorToInt(pos.y / CellSize);
+            int bucket = Hash(cx, cy);
+
+            scratchPositions[i] = pos;
+            scratchCellX[i] = cx;
+            scratchCellY[i] = cy;
+            scratchBucket[i] = bucket;
+            bucketStart[bucket + 1]++;
+        }
+
+        for (int b = 0; b < BucketCount; b++)
+        {
+            bucketStart[b + 1] += bucketStart[b];
+            bucketCursor[b] = bucketStart[b];
+        }
+
+        // Pass 2: scatter into bucket order
+        for (int i = 0; i < count; i++)
+        {
+            int dst = bucketCursor[scratchBucket[i]]++;
+            sortedEnemies[dst] = enemies[i];
+            sortedPositions[dst] = scratchPositions[i];
+            sortedCellX[dst] = scratchCellX[i];
+            sortedCellY[dst] = scratchCellY[i];
+        }
+
+        // Drop stale references past the live range
+        if (builtCount > count)
+            System.Array.Clear(sortedEnemies, count, builtCount - count);
+
+        builtCount = count;
+    }
+
+    private static void EnsureCapacity(int count)
+    {
+        if (sortedEnemies.Length >= count) return;
+
+        int size = Mathf.NextPowerOfTwo(count);
+        System.Array.Resize(ref sortedEnemies, size);
+        sortedPositions = new Vector2[size];
+        sortedCellX = new int[size];
+        sortedCellY = new int[size];
+        scratchPositions = new Vector2[size];
+        scratchCellX = new int[size];
+        scratchCellY = new int[size];
+        scratchBucket = new int[size];
+    }
+}
@@ -0,0 +1,390 @@
+using System.Collections.Generic;
+using Unity.Collections;
+using Unity.Jobs;
+using UnityEngine;
+using UnityEngine.Jobs;
+using UnityEngine.Rendering;
+
+/// <summary>
+/// Draws enemy meshes in GPU-instanced batches, one per mesh and material pair, instead of one
+/// MeshRenderer each. Every type shares the enemy FBX, so a full wave costs a handful of draw calls.
+/// Per-instance tint and hit flash are instanced shader properties (Custom/EnemyInstanced), so
+/// colour variants never break a batch; the walk pose EnemySimulationManager writes to the visual
+/// transforms reaches the GPU through the instance matrices. Instances outside the camera view
+/// are left out of the draw.
+/// Only opaque single-material MeshRenderers are instanced; anything else keeps its own renderer.
+/// </summary>
+public class EnemyRenderManager : MonoBehaviour
+{
+    private const int MaxInstancesPerDraw = 1023;   // Constant buffer limit for instanced arrays
+    private const int InitialCapacity = 64;
+    public const string ShaderPath = "Shaders/EnemyInstanced";
+
+    [Header("Culling")]
+    [SerializeField] private float viewMargin = 2f;   // World units outside the view still drawn (shadows, big meshes)
+
+    [Header("Jobs")]
+    [SerializeField] private bool useJobs = true;
+    [SerializeField] private int minBatchForJobs = 64;
+
+    private static EnemyRenderManager instance;
+    private static Shader instancedShader;
+    private static bool shaderLoaded;
+
+    private static readonly int BaseMapId = Shader.PropertyToID("_BaseMap");
+    private static readonly int BaseColorId = Shader.PropertyToID("_BaseColor");
+    private static readonly int InstanceTintId = Shader.PropertyToID("_InstanceTint");
+    private static readonly int InstanceFlashId = Shader.PropertyToID("_InstanceFlash");
+    private static readonly int SurfaceId = Shader.PropertyToID("_Surface");
+
+    private sealed class Batch
+    {
+        public Mesh mesh;
+        public Material material;
+        public ShadowCastingMode shadowCasting;
+        public bool receiveShadows;
+        public int layer;
+
+        // Indexed by InstancedEnemyMesh.RenderIndex
+        public readonly List<InstancedEnemyMesh> instances = new List<InstancedEnemyMesh>(InitialCapacity);
+        public TransformAccessArray transforms;
+        public NativeArray<Matrix4x4> matrices;
+        public Vector4[] tints = new Vector4[InitialCapacity];
+        public float[] flashUntil = new float[InitialCapacity];
+    }
+
+    private readonly List<Batch> batches = new List<Batch>();
+    private readonly Dictionary<Material, Material> instancedMaterials = new Dictionary<Material, Material>();
+
+    // Scratch for one draw call
+    private readonly Matrix4x4[] drawMatrices = new Matrix4x4[MaxInstancesPerDraw];
+    private readonly Vector4[] drawTints = new Vector4[MaxInstancesPerDraw];
+    private readonly float[] drawFlashes = new float[MaxInstancesPerDraw];
+    private MaterialPropertyBlock drawProps;
+
+    /// <summary>
+    /// Number of instanced draw calls submitted last frame
+    /// </summary>
+    public static int DrawCallsLastFrame { get; private set; }
+
+    /// <summary>
+    /// Whether this platform can draw enemies instanced (GPU support and the shader is in the build)
+    /// </summary>
+    public static bool InstancingSupported
+    {
+        get
+        {
+            if (!shaderLoaded)
+            {
+                shaderLoaded = true;
+                instancedShader = Resources.Load<Shader>(ShaderPath);
+                if (instancedShader != null && !instancedShader.isSupported) instancedShader = null;
+            }
+            return instancedShader != null && SystemInfo.supportsInstancing;
+        }
+    }
+
+    private bool JobsAvailable => useJobs && Application.platform != RuntimePlatform.WebGLPlayer;
+
+    private static EnemyRenderManager GetOrCreate()
+    {
+        if (instance == null && Application.isPlaying)
+        {
+            GameObject obj = new GameObject("EnemyRenderManager");
+            instance = obj.AddComponent<EnemyRenderManager>();
+        }
+        return instance;
+    }
+
+    /// <summary>
+    /// Whether a renderer can be drawn by the manager: one opaque material on a plain mesh
+    /// </summary>
+    public static bool CanInstance(MeshRenderer renderer)
+    {
+        if (renderer == null || renderer.sharedMaterials.Length != 1) return false;
+
+        Material material = renderer.sharedMaterial;
+        MeshFilter filter = renderer.GetComponent<MeshFilter>();
+        if (material == null || filter == null || filter.sharedMesh == null || filter.sharedMesh.subMeshCount != 1)
+            return false;
+
+        // URP Lit/Simple Lit mark transparency with _Surface = 1
+        return !material.HasProperty(SurfaceId) || material.GetFloat(SurfaceId) < 0.5f;
+    }
+
+    void Awake()
+    {
+        if (instance != null && instance != this)
+        {
+            Destroy(this);
+            return;
+        }
+        instance = this;
+        drawProps = new MaterialPropertyBlock();
+    }
+
+    void OnDestroy()
+    {
+        if (instance != this) return;
+        instance = null;
+
+        foreach (Batch batch in batches)
+        {
+            foreach (InstancedEnemyMesh mesh in batch.instances)
+            {
+                if (mesh != null) mesh.RenderIndex = -1;
+            }
+            if (batch.transforms.isCreated) batch.transforms.Dispose();
+            if (batch.matrices.IsCreated) batch.matrices.Dispose();
+        }
+
+        foreach (Material material in instancedMaterials.Values)
+            Destroy(material);
+    }
+
+    // ==================== Registration ====================
+
+    /// <summary>
+    /// Start drawing a mesh in its batch. Returns false if it can't be instanced, in which case
+    /// its own renderer should stay on.
+    /// </summary>
+    public static bool Register(InstancedEnemyMesh mesh)
+    {
+        if (!InstancingSupported) return false;
+
+        EnemyRenderManager mgr = GetOrCreate();
+        if (mgr == null || mesh == null || mesh.Mesh == null) return false;
+        if (mesh.RenderIndex >= 0) return true;
+
+        if (mesh.BatchIndex < 0 || mesh.BatchIndex >= mgr.batches.Count)
+            mesh.BatchIndex = mgr.FindOrCreateBatch(mesh);
+
+        Batch batch = mgr.batches[mesh.BatchIndex];
+        int index = batch.instances.Count;
+        EnsureCapacity(batch, index + 1);
+        batch.instances.Add(mesh);
+        batch.transforms.Add(mesh.transform);
+        batch.tints[index] = mesh.Tint;
+        batch.flashUntil[index] = 0f;
+        mesh.RenderIndex = index;
+        return true;
+    }
+
+    public static void Unregister(InstancedEnemyMesh mesh)
+    {
+        // Never create a manager here - this runs during scene teardown
+        EnemyRenderManager mgr = instance;
+        if (mgr == null || mesh == null || mesh.BatchIndex < 0 || mesh.BatchIndex >= mgr.batches.Count) return;
+
+        Batch batch = mgr.batches[mesh.BatchIndex];
+        int index = mesh.RenderIndex;
+        if (index < 0 || index >= batch.instances.Count || batch.instances[index] != mesh) return;
+
+        int last = batch.instances.Count - 1;
+        InstancedEnemyMesh moved = batch.instances[last];
+        batch.instances[index] = moved;
+        batch.tints[index] = batch.tints[last];
+        batch.flashUntil[index] = batch.flashUntil[last];
+        batch.transforms.RemoveAtSwapBack(index);   // Same swap-back as the list above
+        moved.RenderIndex = index;
+        batch.instances.RemoveAt(last);
+
+        mesh.RenderIndex = -1;
+    }
+
+    public static void SetTint(InstancedEnemyMesh mesh, Vector4 tint)
+    {
+        if (TryGetSlot(mesh, out Batch batch, out int index))
+            batch.tints[index] = tint;
+    }
+
+    public static void Flash(InstancedEnemyMesh mesh, float duration)
+    {
+        if (TryGetSlot(mesh, out Batch batch, out int index))
+            batch.flashUntil[index] = Time.time + duration;
+    }
+
+    /// <summary>
+    /// Create the instanced materials of every mesh under prefab that the manager would draw, and
+    /// draw one instance of each for camera only at position (GameWarmup). Returns the number of
+    /// meshes drawn.
+    /// </summary>
+    public static int WarmUp(GameObject prefab, Camera camera, Vector3 position)
+    {
+        if (!InstancingSupported || prefab == null) return 0;
+
+        EnemyRenderManager mgr = GetOrCreate();
+        if (mgr == null) return 0;
+
+        int drawn = 0;
+        foreach (MeshRenderer renderer in prefab.GetComponentsInChildren<MeshRenderer>(true))
+        {
+            if (!CanInstance(renderer)) continue;
+
+            var renderParams = new RenderParams(mgr.GetInstancedMaterial(renderer.sharedMaterial))
+            {
+                camera = camera,
+                layer = renderer.gameObject.layer,
+                matProps = mgr.drawProps,
+                worldBounds = new Bounds(position, Vector3.one * 10f)
+            };
+            mgr.drawMatrices[0] = Matrix4x4.Translate(position);
+            mgr.drawTints[0] = Vector4.one;
+            mgr.drawFlashes[0] = 0f;
+            mgr.Submit(renderParams, renderer.GetComponent<MeshFilter>().sharedMesh, 1);
+            drawn++;
+        }
+        return drawn;
+    }
+
+    private static bool TryGetSlot(InstancedEnemyMesh mesh, out Batch batch, out int index)
+    {
+        batch = null;
+        index = -1;
+        EnemyRenderManager mgr = instance;
+        if (mgr == null || mesh == null || mesh.BatchIndex < 0 || mesh.BatchIndex >= mgr.batches.Count) return false;
+
+        batch = mgr.batches[mesh.BatchIndex];
+        index = mesh.RenderIndex;
+        return index >= 0 && index < batch.instances.Count;
+    }
+
+    private int FindOrCreateBatch(InstancedEnemyMesh mesh)
+    {
+        MeshRenderer source = mesh.SourceRenderer;
+        Material material = GetInstancedMaterial(source.sharedMaterial);
+
+        for (int i = 0; i < batches.Count; i++)
+        {
+            Batch b = batches[i];
+            if (b.mesh == mesh.Mesh && b.material == material && b.layer == mesh.gameObject.layer
+                && b.shadowCasting == source.shadowCastingMode && b.receiveShadows == source.receiveShadows)
+                return i;
+        }
+
+        batches.Add(new Batch
+        {
+            mesh = mesh.Mesh,
+            material = material,
+            shadowCasting = source.shadowCastingMode,
+            receiveShadows = source.receiveShadows,
+            layer = mesh.gameObject.layer,
+            transforms = new TransformAccessArray(InitialCapacity),
+            matrices = new NativeArray<Matrix4x4>(InitialCapacity, Allocator.Persistent)
+        });
+        return batches.Count - 1;
+    }
+
+    /// <summary>
+    /// Instanced copy of an enemy's material (texture and base colour carried over), one per source
+    /// </summary>
+    private Material GetInstancedMaterial(Material source)
+    {
+        if (instancedMaterials.TryGetValue(source, out Material material)) return material;
+
+        material = new Material(instancedShader)
+        {
+            name = source.name + " (Instanced)",
+            enableInstancing = true
+        };
+        if (source.HasProperty(BaseMapId))
+        {
+            material.SetTexture(BaseMapId, source.GetTexture(BaseMapId));
+            material.SetTextureScale(BaseMapId, source.GetTextureScale(BaseMapId));
+            material.SetTextureOffset(BaseMapId, source.GetTextureOffset(BaseMapId));
+        }
+        if (source.HasProperty(BaseColorId))
+            material.SetColor(BaseColorId, source.GetColor(BaseColorId));
+
+        instancedMaterials[source] = material;
+        return material;
+    }
+
+    private static void EnsureCapacity(Batch batch, int required)
+    {
+        if (batch.matrices.Length >= required) return;
+
+        int size = Mathf.NextPowerOfTwo(required);
+        var grown = new NativeArray<Matrix4x4>(size, Allocator.Persistent);
+        NativeArray<Matrix4x4>.Copy(batch.matrices, grown, batch.matrices.Length);
+        batch.matrices.Dispose();
+        batch.matrices = grown;
+
+        System.Array.Resize(ref batch.tints, size);
+        System.Array.Resize(ref batch.flashUntil, size);
+        batch.transforms.capacity = size;
+    }
+
+    // ==================== Drawing ====================
+
+    void LateUpdate()
+    {
+        // After EnemySimulationManager has posed the visuals for this frame
+        float now = Time.time;
+        int drawCalls = 0;
+
+        for (int b = 0; b < batches.Count; b++)
+        {
+            Batch batch = batches[b];
+            int count = batch.instances.Count;
+            if (count == 0) continue;
+
+            GatherMatrices(batch, count);
+
+            var renderParams = new RenderParams(batch.material)
+            {
+                layer = batch.layer,
+                shadowCastingMode = batch.shadowCasting,
+                receiveShadows = batch.receiveShadows,
+                matProps = drawProps,
+                worldBounds = new Bounds(Vector3.zero, Vector3.one * 100000f)   // Culled per instance below
+            };
+
+            int drawCount = 0;
+            for (int i = 0; i < count; i++)
+            {
+                Matrix4x4 matrix = batch.matrices[i];
+                if (!QualityGovernor.IsInView(new Vector2(matrix.m03, matrix.m13), viewMargin)) continue;
+
+                drawMatrices[drawCount] = matrix;
+                drawTints[drawCount] = batch.tints[i];
+                drawFlashes[drawCount] = now < batch.flashUntil[i] ? 1f : 0f;
+                if (++drawCount == MaxInstancesPerDraw)
+                {
+                    Submit(renderParams, batch.mesh, drawCount);
+                    drawCalls++;
+                    drawCount = 0;
+                }
+            }
+
+            if (drawCount > 0)
+            {
+                Submit(renderParams, batch.mesh, drawCount);
+                drawCalls++;
+            }
+        }
+
+        DrawCallsLastFrame = drawCalls;
+    }
+
+    private void GatherMatrices(Batch batch, int count)
+    {
+        if (JobsAvailable && count >= minBatchForJobs)
+        {
+            new EnemyInstanceMatrixJob { matrices = batch.matrices }
+                .ScheduleReadOnly(batch.transforms, 32).Complete();
+            return;
+        }
+
+        for (int i = 0; i < count; i++)
+            batch.matrices[i] = batch.transforms[i].localToWorldMatrix;
+    }
+
+    private void Submit(RenderParams renderParams, Mesh mesh, int count)
+    {
+        // The block is copied when the draw is queued, so it can be refilled for the next chunk
+        drawProps.SetVectorArray(InstanceTintId, drawTints);
+        drawProps.SetFloatArray(InstanceFlashId, drawFlashes);
+        Graphics.RenderMeshInstanced(renderParams, mesh, 0, drawMatrices, count);
+    }
+}
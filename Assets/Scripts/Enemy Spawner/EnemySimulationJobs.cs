@@ -0,0 +1,209 @@
+using Unity.Burst;
+using Unity.Collections;
+using Unity.Jobs;
+using UnityEngine;
+using UnityEngine.Jobs;
+
+/// <summary>
+/// How an enemy steers towards the player
+/// </summary>
+public enum EnemySteeringMode : byte
+{
+    Chase = 0,          // Always move straight at the player (melee)
+    KeepDistance = 1    // Approach until stop distance, back off when too close (ranged)
+}
+
+/// <summary>
+/// Per-instance walk animation settings, copied from EnemyWalkAnimation when it registers
+/// </summary>
+public struct EnemyWalkParams
+{
+    public float pulsateSpeed;
+    public float pulsateAmountX;
+    public float pulsateAmountY;
+    public float pulsateAmountZ;
+    public float wobbleSpeed;
+    public float wobbleAmount;
+    public float spinSpeedMultiplier;
+    public float bounceSpeed;
+    public float bounceAmount;
+    public float timeOffset;
+    public Vector3 baseScale;
+    public Vector3 basePosition;
+}
+
+/// <summary>
+/// Pure math shared by the Burst jobs and the main-thread fallback (WebGL has no worker threads).
+/// </summary>
+public static class EnemySimulationMath
+{
+    /// <summary>
+    /// Steering velocity for one enemy. Returns false when the enemy sits on the player
+    /// and should skip the rest of its physics step (matches the old per-enemy FixedUpdate).
+    /// </summary>
+    public static bool Steer(
+        EnemySteeringMode mode, Vector2 position, Vector2 velocity, Vector2 playerPos,
+        float speed, float acceleration, float stopDistance, float retreatDistance,
+        float deltaTime, out Vector2 newVelocity)
+    {
+        newVelocity = velocity;
+
+        Vector2 toPlayer = playerPos - position;
+        float dist = toPlayer.magnitude;
+        float maxDelta = acceleration * deltaTime;
+
+        if (mode == EnemySteeringMode.Chase)
+        {
+            if (dist < 0.0001f) return false;
+
+            Vector2 targetVel = toPlayer / dist * speed;
+            newVelocity = Vector2.MoveTowards(velocity, targetVel, maxDelta);
+            return true;
+        }
+
+        if (dist > stopDistance)
+        {
+            // Far away -> move towards player
+            Vector2 targetVel = toPlayer / dist * speed;
+            newVelocity = Vector2.MoveTowards(velocity, targetVel, maxDelta);
+        }
+        else if (dist < retreatDistance && dist > 0.0001f)
+        {
+            // Too close to player - move away
+            float urgency = 1f - (dist / retreatDistance);
+            Vector2 targetVel = -toPlayer / dist * speed * urgency;
+            newVelocity = Vector2.MoveTowards(velocity, targetVel, maxDelta);
+        }
+        else
+        {
+            // Within stop range but not too close -> stop moving
+            newVelocity = Vector2.MoveTowards(velocity, Vector2.zero, maxDelta);
+        }
+        return true;
+    }
+
+    /// <summary>
+    /// Pulsate / wobble / bounce pose for one enemy visual (see EnemyWalkAnimation)
+    /// </summary>
+    public static void EvaluateWalk(
+        in EnemyWalkParams p, Vector2 velocity, ref float currentSpin, float time, float deltaTime,
+        out Vector3 localPosition, out Quaternion localRotation, out Vector3 localScale)
+    {
+        float t = time + p.timeOffset;
+        float speed = velocity.magnitude;
+
+        // Intensity scales with movement speed (0.5 to 1.5 range)
+        float intensity = Mathf.Clamp(0.5f + speed * 0.15f, 0.5f, 1.5f);
+
+        // Pulsating squash/stretch
+        float pulsatePhase = Mathf.Sin(t * p.pulsateSpeed) * intensity;
+        localScale = new Vector3(
+            p.baseScale.x * (1f + pulsatePhase * p.pulsateAmountX),
+            p.baseScale.y * (1f - pulsatePhase * p.pulsateAmountY),
+            p.baseScale.z * (1f + pulsatePhase * p.pulsateAmountZ));
+
+        // Wobble plus spin in the direction of movement
+        float wobble = Mathf.Sin(t * p.wobbleSpeed) * p.wobbleAmount * intensity;
+        if (speed > 0.5f)
+            currentSpin = Mathf.Lerp(currentSpin, velocity.x * p.spinSpeedMultiplier, deltaTime * 5f);
+        else
+            currentSpin = Mathf.Lerp(currentSpin, 0f, deltaTime * 3f);
+
+        // Z-only rotation built by hand (Quaternion.Euler is not Burst-compatible)
+        float halfAngle = (wobble + currentSpin) * Mathf.Deg2Rad * 0.5f;
+        localRotation = new Quaternion(0f, 0f, Mathf.Sin(halfAngle), Mathf.Cos(halfAngle));
+
+        // Vertical bounce
+        float bounce = Mathf.Abs(Mathf.Sin(t * p.bounceSpeed)) * p.bounceAmount * intensity;
+        localPosition = p.basePosition + new Vector3(0f, bounce, 0f);
+    }
+}
+
+/// <summary>
+/// Steering for all live enemies in one pass.
+/// Enemies whose steerSteps is 0 are not due this step (see EnemySimulationManager LOD) and keep
+/// their velocity; the others steer over steerSteps physics steps at once.
+/// </summary>
+[BurstCompile]
+public struct EnemySteeringJob : IJobParallelFor
+{
+    [ReadOnly] public NativeArray<Vector2> positions;
+    [ReadOnly] public NativeArray<float> speeds;
+    [ReadOnly] public NativeArray<float> accelerations;
+    [ReadOnly] public NativeArray<float> stopDistances;
+    [ReadOnly] public NativeArray<float> retreatDistances;
+    [ReadOnly] public NativeArray<EnemySteeringMode> modes;
+    [ReadOnly] public NativeArray<float> knockbackTimers;
+    [ReadOnly] public NativeArray<byte> steerSteps;
+    public NativeArray<Vector2> velocities;
+    [WriteOnly] public NativeArray<bool> skipSeparation;
+    public Vector2 playerPosition;
+    public float deltaTime;
+
+    public void Execute(int i)
+    {
+        int steps = steerSteps[i];
+        if (steps == 0)
+        {
+            skipSeparation[i] = true;
+            return;
+        }
+
+        // Knocked back enemies keep their velocity and only get separation
+        if (knockbackTimers[i] > 0f)
+        {
+            skipSeparation[i] = false;
+            return;
+        }
+
+        bool moved = EnemySimulationMath.Steer(
+            modes[i], positions[i], velocities[i], playerPosition,
+            speeds[i], accelerations[i], stopDistances[i], retreatDistances[i],
+            deltaTime * steps, out Vector2 newVelocity);
+
+        velocities[i] = newVelocity;
+        skipSeparation[i] = !moved;
+    }
+}
+
+/// <summary>
+/// Walk animation for all registered enemy visuals, writing transforms directly
+/// </summary>
+[BurstCompile]
+public struct EnemyWalkAnimationJob : IJobParallelForTransform
+{
+    [ReadOnly] public NativeArray<EnemyWalkParams> parameters;
+    [ReadOnly] public NativeArray<Vector2> velocities;
+    [ReadOnly] public NativeArray<bool> animate;
+    public NativeArray<float> spins;
+    public float time;
+    public float deltaTime;
+
+    public void Execute(int i, TransformAccess transform)
+    {
+        if (!animate[i]) return;
+
+        float spin = spins[i];
+        EnemySimulationMath.EvaluateWalk(parameters[i], velocities[i], ref spin, time, deltaTime,
+            out Vector3 localPosition, out Quaternion localRotation, out Vector3 localScale);
+        spins[i] = spin;
+
+        transform.localPosition = localPosition;
+        transform.localRotation = localRotation;
+        transform.localScale = localScale;
+    }
+}
+
+/// <summary>
+/// Reads the world matrix of every instanced enemy mesh for EnemyRenderManager
+/// </summary>
+[BurstCompile]
+public struct EnemyInstanceMatrixJob : IJobParallelForTransform
+{
+    [WriteOnly] public NativeArray<Matrix4x4> matrices;
+
+    public void Execute(int i, TransformAccess transform)
+    {
+        matrices[i] = transform.localToWorldMatrix;
+    }
+}
@@ -0,0 +1,474 @@
+using System.Collections.Generic;
+using Unity.Collections;
+using Unity.Jobs;
+using UnityEngine;
+using UnityEngine.Jobs;
+
+/// <summary>
+/// Owns the per-frame simulation of every live enemy so the engine pays one Update/FixedUpdate
+/// callback in total instead of one per enemy component.
+/// Hot per-enemy state (position, velocity, steering parameters, knockback timer, walk-animation
+/// pose) lives here in struct-of-arrays form and is stepped in single loops. Large batches run as
+/// Burst jobs where worker threads exist; WebGL and small batches run the same math inline.
+///
+/// Level of detail: enemies in (or just outside) the camera view get everything every frame.
+/// Off-screen enemies skip walk animation and step audio, and steer only every few physics steps
+/// (time-sliced by index so the work is spread evenly) with the skipped time folded into the step;
+/// far away ones steer less often still. Rigidbodies keep their last velocity in between. Tiers
+/// are re-evaluated every step, so an enemy is back at full rate as soon as it nears the view.
+/// </summary>
+public class EnemySimulationManager : MonoBehaviour
+{
+    private const int InitialCapacity = 256;
+
+    [Header("Jobs")]
+    [SerializeField] private bool useJobs = true;
+    [SerializeField] private int minBatchForJobs = 64;   // Below this the scheduling overhead outweighs the win
+    [SerializeField] private int jobBatchSize = 32;
+
+    [Header("Level of Detail")]
+    [SerializeField] private float lodViewMargin = 2f;      // Full rate this far outside the camera view, so resuming never shows
+    [SerializeField] private float farDistance = 25f;       // Off-screen enemies further than this from the player are far
+    [SerializeField] private int offscreenSteerInterval = 2;  // Physics steps between steering updates
+    [SerializeField] private int farSteerInterval = 4;
+
+    private static EnemySimulationManager instance;
+
+    // ===== Enemies (indexed by EnemyBase.SimulationIndex) =====
+    private readonly List<EnemyBase> enemies = new List<EnemyBase>(InitialCapacity);
+    private EnemyBase[] tickBuffer = new EnemyBase[InitialCapacity];
+    private NativeArray<Vector2> positions;
+    private NativeArray<Vector2> velocities;
+    private NativeArray<float> speeds;
+    private NativeArray<float> accelerations;
+    private NativeArray<float> stopDistances;
+    private NativeArray<float> retreatDistances;
+    private NativeArray<EnemySteeringMode> modes;
+    private NativeArray<float> knockbackTimers;
+    private NativeArray<bool> skipSeparation;
+    private NativeArray<byte> steerSteps;   // Physics steps folded into this steering update (0 = not due); rebuilt every step
+    private int fixedStepCount;
+
+    // ===== Walk animations (indexed by EnemyWalkAnimation.SimulationIndex) =====
+    private readonly List<EnemyWalkAnimation> walkAnimations = new List<EnemyWalkAnimation>(InitialCapacity);
+    private readonly List<Rigidbody2D> walkBodies = new List<Rigidbody2D>(InitialCapacity);
+    private TransformAccessArray walkTransforms;
+    private NativeArray<EnemyWalkParams> walkParams;
+    private NativeArray<Vector2> walkVelocities;
+    private NativeArray<float> walkSpins;
+    private NativeArray<bool> walkAnimate;   // Rebuilt every frame, so never swap-removed
+
+    // ===== Walk audio (indexed by ProceduralEnemyWalkAudio.SimulationIndex) =====
+    private readonly List<ProceduralEnemyWalkAudio> walkAudio = new List<ProceduralEnemyWalkAudio>(InitialCapacity);
+
+    private Transform player;
+
+    /// <summary>
+    /// Number of enemies currently simulated
+    /// </summary>
+    public static int EnemyCount => instance != null ? instance.enemies.Count : 0;
+
+    private bool JobsAvailable => useJobs && Application.platform != RuntimePlatform.WebGLPlayer;
+
+    private static EnemySimulationManager GetOrCreate()
+    {
+        if (instance == null && Application.isPlaying)
+        {
+            GameObject obj = new GameObject("EnemySimulationManager");
+            instance = obj.AddComponent<EnemySimulationManager>();
+        }
+        return instance;
+    }
+
+    void Awake()
+    {
+        if (instance != null && instance != this)
+        {
+            Destroy(this);
+            return;
+        }
+        instance = this;
+
+        positions = new NativeArray<Vector2>(InitialCapacity, Allocator.Persistent);
+        velocities = new NativeArray<Vector2>(InitialCapacity, Allocator.Persistent);
+        speeds = new NativeArray<float>(InitialCapacity, Allocator.Persistent);
+        accelerations = new NativeArray<float>(InitialCapacity, Allocator.Persistent);
+        stopDistances = new NativeArray<float>(InitialCapacity, Allocator.Persistent);
+        retreatDistances = new NativeArray<float>(InitialCapacity, Allocator.Persistent);
+        modes = new NativeArray<EnemySteeringMode>(InitialCapacity, Allocator.Persistent);
+        knockbackTimers = new NativeArray<float>(InitialCapacity, Allocator.Persistent);
+        skipSeparation = new NativeArray<bool>(InitialCapacity, Allocator.Persistent);
+        steerSteps = new NativeArray<byte>(InitialCapacity, Allocator.Persistent);
+
+        walkTransforms = new TransformAccessArray(InitialCapacity);
+        walkParams = new NativeArray<EnemyWalkParams>(InitialCapacity, Allocator.Persistent);
+        walkVelocities = new NativeArray<Vector2>(InitialCapacity, Allocator.Persistent);
+        walkSpins = new NativeArray<float>(InitialCapacity, Allocator.Persistent);
+        walkAnimate = new NativeArray<bool>(InitialCapacity, Allocator.Persistent);
+    }
+
+    void OnDestroy()
+    {
+        if (instance != this) return;
+        instance = null;
+
+        // Anything still registered loses its slot
+        foreach (EnemyBase enemy in enemies)
+        {
+            if (enemy != null) enemy.SimulationIndex = -1;
+        }
+        foreach (EnemyWalkAnimation anim in walkAnimations)
+        {
+            if (anim != null) anim.SimulationIndex = -1;
+        }
+        foreach (ProceduralEnemyWalkAudio audio in walkAudio)
+        {
+            if (audio != null) audio.SimulationIndex = -1;
+        }
+
+        positions.Dispose();
+        velocities.Dispose();
+        speeds.Dispose();
+        accelerations.Dispose();
+        stopDistances.Dispose();
+        retreatDistances.Dispose();
+        modes.Dispose();
+        knockbackTimers.Dispose();
+        skipSeparation.Dispose();
+        steerSteps.Dispose();
+
+        if (walkTransforms.isCreated) walkTransforms.Dispose();
+        walkParams.Dispose();
+        walkVelocities.Dispose();
+        walkSpins.Dispose();
+        walkAnimate.Dispose();
+    }
+
+    // ==================== Registration ====================
+
+    public static void Register(EnemyBase enemy)
+    {
+        EnemySimulationManager mgr = GetOrCreate();
+        if (mgr == null || enemy == null || enemy.SimulationIndex >= 0) return;
+
+        int index = mgr.enemies.Count;
+        mgr.EnsureEnemyCapacity(index + 1);
+        mgr.enemies.Add(enemy);
+        mgr.knockbackTimers[index] = 0f;
+        enemy.SimulationIndex = index;
+    }
+
+    public static void Unregister(EnemyBase enemy)
+    {
+        // Never create a manager here - this runs during scene teardown
+        EnemySimulationManager mgr = instance;
+        if (mgr == null || enemy == null) return;
+
+        int index = enemy.SimulationIndex;
+        if (index < 0 || index >= mgr.enemies.Count || mgr.enemies[index] != enemy) return;
+
+        // Swap-remove in every array so the SoA stays dense
+        int last = mgr.enemies.Count - 1;
+        EnemyBase moved = mgr.enemies[last];
+        mgr.enemies[index] = moved;
+        mgr.knockbackTimers[index] = mgr.knockbackTimers[last];
+        moved.SimulationIndex = index;
+        mgr.enemies.RemoveAt(last);
+
+        enemy.SimulationIndex = -1;
+    }
+
+    public static void Register(EnemyWalkAnimation anim, Transform visual, Rigidbody2D body, EnemyWalkParams parameters)
+    {
+        EnemySimulationManager mgr = GetOrCreate();
+        if (mgr == null || anim == null || visual == null || anim.SimulationIndex >= 0) return;
+
+        int index = mgr.walkAnimations.Count;
+        mgr.EnsureWalkCapacity(index + 1);
+        mgr.walkAnimations.Add(anim);
+        mgr.walkBodies.Add(body);
+        mgr.walkTransforms.Add(visual);
+        mgr.walkParams[index] = parameters;
+        mgr.walkSpins[index] = 0f;
+        anim.SimulationIndex = index;
+    }
+
+    public static void Unregister(EnemyWalkAnimation anim)
+    {
+        EnemySimulationManager mgr = instance;
+        if (mgr == null || anim == null) return;
+
+        int index = anim.SimulationIndex;
+        if (index < 0 || index >= mgr.walkAnimations.Count || mgr.walkAnimations[index] != anim) return;
+
+        int last = mgr.walkAnimations.Count - 1;
+        EnemyWalkAnimation moved = mgr.walkAnimations[last];
+        mgr.walkAnimations[index] = moved;
+        mgr.walkBodies[index] = mgr.walkBodies[last];
+        mgr.walkParams[index] = mgr.walkParams[last];
+        mgr.walkSpins[index] = mgr.walkSpins[last];
+        mgr.walkTransforms.RemoveAtSwapBack(index);   // Same swap-back as the lists above
+        moved.SimulationIndex = index;
+        mgr.walkAnimations.RemoveAt(last);
+        mgr.walkBodies.RemoveAt(last);
+
+        anim.SimulationIndex = -1;
+    }
+
+    public static void Register(ProceduralEnemyWalkAudio audio)
+    {
+        EnemySimulationManager mgr = GetOrCreate();
+        if (mgr == null || audio == null || audio.SimulationIndex >= 0) return;
+
+        audio.SimulationIndex = mgr.walkAudio.Count;
+        mgr.walkAudio.Add(audio);
+    }
+
+    public static void Unregister(ProceduralEnemyWalkAudio audio)
+    {
+        EnemySimulationManager mgr = instance;
+        if (mgr == null || audio == null) return;
+
+        int index = audio.SimulationIndex;
+        if (index < 0 || index >= mgr.walkAudio.Count || mgr.walkAudio[index] != audio) return;
+
+        int last = mgr.walkAudio.Count - 1;
+        ProceduralEnemyWalkAudio moved = mgr.walkAudio[last];
+        mgr.walkAudio[index] = moved;
+        moved.SimulationIndex = index;
+        mgr.walkAudio.RemoveAt(last);
+
+        audio.SimulationIndex = -1;
+    }
+
+    // ==================== Knockback ====================
+
+    public static void StartKnockback(EnemyBase enemy, float duration)
+    {
+        EnemySimulationManager mgr = instance;
+        if (mgr == null || enemy == null) return;
+
+        int index = enemy.SimulationIndex;
+        if (index < 0 || index >= mgr.enemies.Count) return;
+        mgr.knockbackTimers[index] = duration;
+    }
+
+    public static bool IsKnockedBack(EnemyBase enemy)
+    {
+        EnemySimulationManager mgr = instance;
+        if (mgr == null || enemy == null) return false;
+
+        int index = enemy.SimulationIndex;
+        return index >= 0 && index < mgr.enemies.Count && mgr.knockbackTimers[index] > 0f;
+    }
+
+    // ==================== Simulation ====================
+
+    void Update()
+    {
+        float dt = Time.deltaTime;
+        int count = enemies.Count;
+
+        // Knockback timers in one pass
+        for (int i = 0; i < count; i++)
+        {
+            float timer = knockbackTimers[i];
+            if (timer > 0f) knockbackTimers[i] = timer - dt;
+        }
+
+        // Per-enemy behaviour (attack animation, shooting, health bar).
+        // Iterate a snapshot: enemies can die, split or spawn while ticking.
+        if (tickBuffer.Length < count)
+            tickBuffer = new EnemyBase[Mathf.NextPowerOfTwo(count)];
+        enemies.CopyTo(tickBuffer);
+
+        for (int i = 0; i < count; i++)
+        {
+            EnemyBase enemy = tickBuffer[i];
+            tickBuffer[i] = null;
+            if (enemy == null || enemy.IsDead || enemy.SimulationIndex < 0) continue;
+            enemy.SimulationUpdate(dt);
+        }
+
+        UpdateWalkAnimations(dt);
+        UpdateWalkAudio(dt);
+    }
+
+    void FixedUpdate()
+    {
+        int count = enemies.Count;
+        if (count == 0) return;
+
+        if (player == null)
+        {
+            player = GameObject.FindGameObjectWithTag("Player")?.transform;
+            if (player == null) return;
+        }
+
+        float dt = Time.fixedDeltaTime;
+        Vector2 playerPosition = player.position;
+
+        // Under load QualityGovernor stretches the off-screen intervals further
+        int intervalScale = QualityGovernor.OffscreenSteeringScale;
+        int offscreenInterval = Mathf.Clamp(offscreenSteerInterval * intervalScale, 1, byte.MaxValue);
+        int farInterval = Mathf.Clamp(farSteerInterval * intervalScale, 1, byte.MaxValue);
+        float farDistanceSqr = farDistance * farDistance;
+        int step = fixedStepCount++;
+
+        // Gather
+        for (int i = 0; i < count; i++)
+        {
+            EnemyBase enemy = enemies[i];
+            Rigidbody2D body = enemy.rb;
+            Vector2 position = body.position;
+
+            // LOD tier -> steering interval; index offsets spread each tier across the steps
+            int interval = 1;
+            if (!QualityGovernor.IsInView(position, lodViewMargin))
+                interval = (position - playerPosition).sqrMagnitude > farDistanceSqr ? farInterval : offscreenInterval;
+            steerSteps[i] = (byte)((step + i) % interval == 0 ? interval : 0);
+
+            positions[i] = position;
+            velocities[i] = body.linearVelocity;
+            speeds[i] = enemy.Speed;
+            accelerations[i] = enemy.acceleration;
+            stopDistances[i] = enemy.SteeringStopDistance;
+            retreatDistances[i] = enemy.SteeringRetreatDistance;
+            modes[i] = enemy.Steering;
+        }
+
+        // Steer
+        var steering = new EnemySteeringJob
+        {
+            positions = positions,
+            speeds = speeds,
+            accelerations = accelerations,
+            stopDistances = stopDistances,
+            retreatDistances = retreatDistances,
+            modes = modes,
+            knockbackTimers = knockbackTimers,
+            steerSteps = steerSteps,
+            velocities = velocities,
+            skipSeparation = skipSeparation,
+            playerPosition = playerPosition,
+            deltaTime = dt
+        };
+
+        if (JobsAvailable && count >= minBatchForJobs)
+        {
+            steering.Schedule(count, jobBatchSize).Complete();
+        }
+        else
+        {
+            for (int i = 0; i < count; i++) steering.Execute(i);
+        }
+
+        // Separation (spatial hash queries) and write back; enemies not due keep their velocity
+        for (int i = 0; i < count; i++)
+        {
+            if (skipSeparation[i]) continue;
+
+            EnemyBase enemy = enemies[i];
+            Vector2 velocity = velocities[i];
+            Vector2 separation = enemy.CalculateSeparationVelocity(positions[i]);
+            if (separation.sqrMagnitude > 0.01f)
+                velocity += separation * dt;
+
+            enemy.rb.linearVelocity = velocity;
+        }
+    }
+
+    private void UpdateWalkAnimations(float dt)
+    {
+        int count = walkAnimations.Count;
+        if (count == 0) return;
+
+        // Off-screen poses stay frozen; the pose is a function of time, so it picks up in phase
+        for (int i = 0; i < count; i++)
+        {
+            Rigidbody2D body = walkBodies[i];
+            walkVelocities[i] = body != null ? body.linearVelocity : Vector2.zero;
+            walkAnimate[i] = body == null || QualityGovernor.IsInView(body.position, lodViewMargin);
+        }
+
+        float time = Time.time;
+
+        if (JobsAvailable && count >= minBatchForJobs)
+        {
+            new EnemyWalkAnimationJob
+            {
+                parameters = walkParams,
+                velocities = walkVelocities,
+                animate = walkAnimate,
+                spins = walkSpins,
+                time = time,
+                deltaTime = dt
+            }.Schedule(walkTransforms).Complete();
+            return;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            if (!walkAnimate[i]) continue;
+
+            float spin = walkSpins[i];
+            EnemySimulationMath.EvaluateWalk(walkParams[i], walkVelocities[i], ref spin, time, dt,
+                out Vector3 localPosition, out Quaternion localRotation, out Vector3 localScale);
+            walkSpins[i] = spin;
+
+            Transform visual = walkTransforms[i];
+            visual.localScale = localScale;
+            visual.SetLocalPositionAndRotation(localPosition, localRotation);
+        }
+    }
+
+    private void UpdateWalkAudio(float dt)
+    {
+        // Step timers of off-screen enemies just pause
+        for (int i = walkAudio.Count - 1; i >= 0; i--)
+        {
+            ProceduralEnemyWalkAudio audio = walkAudio[i];
+            if (QualityGovernor.IsInView(audio.Position, lodViewMargin))
+                audio.SimulationUpdate(dt);
+        }
+    }
+
+    // ==================== Storage ====================
+
+    private void EnsureEnemyCapacity(int required)
+    {
+        if (positions.Length >= required) return;
+
+        int size = Mathf.NextPowerOfTwo(required);
+        Grow(ref positions, size);
+        Grow(ref velocities, size);
+        Grow(ref speeds, size);
+        Grow(ref accelerations, size);
+        Grow(ref stopDistances, size);
+        Grow(ref retreatDistances, size);
+        Grow(ref modes, size);
+        Grow(ref knockbackTimers, size);
+        Grow(ref skipSeparation, size);
+        Grow(ref steerSteps, size);
+    }
+
+    private void EnsureWalkCapacity(int required)
+    {
+        if (walkParams.Length >= required) return;
+
+        int size = Mathf.NextPowerOfTwo(required);
+        Grow(ref walkParams, size);
+        Grow(ref walkVelocities, size);
+        Grow(ref walkSpins, size);
+        Grow(ref walkAnimate, size);
+        walkTransforms.capacity = size;
+    }
+
+    private static void Grow<T>(ref NativeArray<T> array, int size) where T : struct
+    {
+        var grown = new NativeArray<T>(size, Allocator.Persistent);
+        NativeArray<T>.Copy(array, grown, array.Length);
+        array.Dispose();
+        array = grown;
+    }
+}
@@ -1,7 +1,19 @@
 ﻿using System;
 using System.Collections;
+using System.Collections.Generic;
+using System.Diagnostics;
 using UnityEngine;
+using Debug = UnityEngine.Debug;
 
+/// <summary>
+/// Spawns the enemies of one wave at a time.
+/// A wave is planned up front (PlanWave, during the pre-wave countdown): every spawn gets its prefab,
+/// time and direction, grouped so enemies arrive in small packs. While the wave runs, due spawns are
+/// released in frame-budgeted batches just outside the camera view, and held back while the live
+/// enemy count or the smoothed frame time is over budget so a big wave never lands in a single
+/// frame. A frame-time hold lasts at most maxFrameHoldSeconds, so devices that never reach the
+/// frame budget still get at least one spawn per hold period and waves always drain.
+/// </summary>
 public class EnemySpawner : MonoBehaviour
 {
     public Transform player;
@@ -11,13 +23,63 @@ public class EnemySpawner : MonoBehaviour
     [Header("Powerup Drops")]
     [SerializeField] private GameObject[] powerupPrefabs;
     [SerializeField] private float powerupDropChance = 0.15f; // 15% chance per enemy kill
-    
+
+    [Header("Pooling")]
+    [SerializeField] private int prewarmPerFrame = 4; // Instances created per frame while pre-warming
+
+    [Header("Spawn Placement")]
+    [SerializeField] private float minSpawnRadius = 10f;      // Never closer to the player than this
+    [SerializeField] private float offscreenMargin = 1.5f;    // World units beyond the camera edge
+    [SerializeField] private int minGroupSize = 1;
+    [SerializeField] private int maxGroupSize = 5;             // Enemies sharing a spawn direction
+    [SerializeField] private float groupSpreadDegrees = 12f;
+
+    [Header("Spawn Budget")]
+    [SerializeField] private int maxSpawnsPerFrame = 8;
+    [SerializeField] private float spawnBudgetMs = 1.5f;       // Main-thread time spawning may take per frame
+    [SerializeField] private int maxLiveEnemies = 400;         // Hold spawns while this many enemies are alive
+    [SerializeField] private float maxFrameTimeMs = 33.3f;     // Hold spawns while smoothed frames are slower than this
+    [SerializeField] private float frameTimeSmoothing = 0.1f;
+    [SerializeField] private float maxFrameHoldSeconds = 1f;   // Longest frame-time hold before one spawn is let through
+
+    private const float MaxFrameSampleMs = 100f;               // Hitches (loads, GC) don't count in full
+
+    private struct PlannedSpawn
+    {
+        public GameObject prefab;
+        public float time;          // Seconds after wave start
+        public Vector2 direction;   // Unit direction from the player
+    }
+
+    private readonly List<PlannedSpawn> plan = new List<PlannedSpawn>();
+    private readonly Stopwatch spawnClock = new Stopwatch();
+    private WaveConfig plannedWave;
+    private int nextSpawn;
+    private bool isSpawning;
+    private float smoothedFrameMs;
+    private float frameHoldTime;
+    private Camera mainCamera;
+    private readonly Vector2[] viewFootprint = new Vector2[4];
+
     private int aliveEnemies;
     private WaveConfig currentWave;
     private bool hasPowerupDroppedThisWave = false;
+    private Coroutine spawnRoutine;
+    private Coroutine prewarmRoutine;
 
     public event Action OnWaveCompleted;
 
+    /// <summary>
+    /// Hold spawns on live count and frame time. WaveBenchmark turns this off so its waves are
+    /// identical on every machine; the per-frame spawn count cap always applies.
+    /// </summary>
+    public bool Throttling { get; set; } = true;
+
+    /// <summary>
+    /// Live enemy count above which spawns are held (used by the editor's wave cost model)
+    /// </summary>
+    public int MaxLiveEnemies => maxLiveEnemies;
+
     /// <summary>
     /// Set the powerup prefabs that can drop from enemies
     /// </summary>
@@ -26,50 +88,214 @@ public class EnemySpawner : MonoBehaviour
         powerupPrefabs = prefabs;
     }
 
+    /// <summary>
+    /// Plan every spawn of a wave (prefab, time, direction) so nothing is rolled while it runs.
+    /// Spawns keep the config's spawnInterval cadence; each group shares one direction.
+    /// </summary>
+    public void PlanWave(WaveConfig config)
+    {
+        plan.Clear();
+        plannedWave = config;
+        if (config == null || config.enemyPrefabs == null || config.enemyPrefabs.Length == 0) return;
+
+        if (plan.Capacity < config.enemyCount)
+            plan.Capacity = config.enemyCount;
+
+        int groupRemaining = 0;
+        float groupAngle = 0f;
+        for (int i = 0; i < config.enemyCount; i++)
+        {
+            if (groupRemaining <= 0)
+            {
+                groupRemaining = UnityEngine.Random.Range(minGroupSize, maxGroupSize + 1);
+                groupAngle = UnityEngine.Random.Range(0f, 360f);
+            }
+            groupRemaining--;
+
+            float angle = (groupAngle + UnityEngine.Random.Range(-groupSpreadDegrees, groupSpreadDegrees)) * Mathf.Deg2Rad;
+            plan.Add(new PlannedSpawn
+            {
+                prefab = config.enemyPrefabs[UnityEngine.Random.Range(0, config.enemyPrefabs.Length)],
+                time = i * config.spawnInterval,
+                direction = new Vector2(Mathf.Cos(angle), Mathf.Sin(angle)),
+            });
+        }
+    }
+
     public void StartWave(WaveConfig config)
     {
         if (config == null)
         {
-            Debug.LogError("EnemySpawner: WaveConfig is null.");
+            GameLog.Error(LogCategory.Waves, "EnemySpawner: WaveConfig is null.");
             return;
         }
 
+        if (plannedWave != config)
+            PlanWave(config);
+
         currentWave = config;
         IsWaveComplete = false;
         aliveEnemies = 0;
+        nextSpawn = 0;
         hasPowerupDroppedThisWave = false; // Reset powerup drop for new wave
 
-        Debug.Log($"EnemySpawner: Starting wave with {currentWave.enemyCount} enemies.");
+        GameLog.Info(LogCategory.Waves, $"EnemySpawner: Starting wave with {currentWave.enemyCount} enemies.");
 
-        StopAllCoroutines();
-        StartCoroutine(SpawnRoutine());
+        if (spawnRoutine != null)
+            StopCoroutine(spawnRoutine);
+        isSpawning = true;
+        spawnRoutine = StartCoroutine(SpawnRoutine());
+    }
+
+    /// <summary>
+    /// Fill the enemy pool for an upcoming wave, spread over several frames.
+    /// Each prefab gets its share of WaveConfig.enemyCount.
+    /// </summary>
+    public void PrewarmWave(WaveConfig config)
+    {
+        if (config == null || config.enemyPrefabs == null || config.enemyPrefabs.Length == 0) return;
+
+        if (prewarmRoutine != null)
+            StopCoroutine(prewarmRoutine);
+        prewarmRoutine = StartCoroutine(PrewarmRoutine(config));
+    }
+
+    private IEnumerator PrewarmRoutine(WaveConfig config)
+    {
+        GameObject[] prefabs = config.enemyPrefabs;
+        float sharePerEntry = (float)config.enemyCount / prefabs.Length;
+        int createdThisFrame = 0;
+
+        for (int i = 0; i < prefabs.Length; i++)
+        {
+            GameObject prefab = prefabs[i];
+            if (prefab == null) continue;
+
+            // A prefab listed several times gets one share per entry
+            int entries = 0;
+            for (int j = 0; j < prefabs.Length; j++)
+            {
+                if (prefabs[j] == prefab) entries++;
+            }
+            int target = Mathf.CeilToInt(sharePerEntry * entries);
+            EnemyBase template = prefab.GetComponent<EnemyBase>();
+            if (template != null) target = template.PrewarmCount(target);
+
+            while (EnemyPool.GetTotalCount(prefab) < target)
+            {
+                if (!EnemyPool.PrewarmOne(prefab)) break;
+
+                if (++createdThisFrame >= prewarmPerFrame)
+                {
+                    createdThisFrame = 0;
+                    yield return null;
+                }
+            }
+        }
+
+        prewarmRoutine = null;
     }
 
     private IEnumerator SpawnRoutine()
     {
-        for (int i = 0; i < currentWave.enemyCount; i++)
+        float elapsed = 0f;
+        smoothedFrameMs = 0f;
+        frameHoldTime = 0f;
+        while (nextSpawn < plan.Count)
         {
-            SpawnEnemy();
-            yield return new WaitForSeconds(currentWave.spawnInterval);
+            bool held = IsOverBudget();
+            if (held && IsFrameHoldExpired())
+            {
+                // Held too long on frame time alone: let the next spawn through now
+                held = false;
+                elapsed = Mathf.Max(elapsed, plan[nextSpawn].time);
+            }
+
+            if (!held)
+            {
+                spawnClock.Restart();
+                int spawned = 0;
+                while (nextSpawn < plan.Count && plan[nextSpawn].time <= elapsed && spawned < maxSpawnsPerFrame)
+                {
+                    SpawnEnemy(plan[nextSpawn]);
+                    nextSpawn++;
+                    spawned++;
+
+                    if (Throttling && spawnClock.Elapsed.TotalMilliseconds >= spawnBudgetMs) break;
+                }
+
+                // Schedule time only runs while we're keeping up, so held spawns aren't dumped at once later
+                elapsed += Time.deltaTime;
+            }
+
+            yield return null;
         }
+
+        isSpawning = false;
+        CheckWaveComplete();
     }
 
-    private void SpawnEnemy()
+    private bool IsOverBudget()
     {
-        GameObject prefab = currentWave.enemyPrefabs[
-            UnityEngine.Random.Range(0, currentWave.enemyPrefabs.Length)
-        ];
+        float frameMs = Mathf.Min(Time.unscaledDeltaTime * 1000f, MaxFrameSampleMs);
+        smoothedFrameMs = smoothedFrameMs > 0f ? smoothedFrameMs + (frameMs - smoothedFrameMs) * frameTimeSmoothing : frameMs;
 
-        Vector2 spawnPos = (Vector2)player.position + UnityEngine.Random.insideUnitCircle.normalized * 10f;
+        if (!Throttling) return false;
+        if (EnemySimulationManager.EnemyCount >= maxLiveEnemies)
+        {
+            frameHoldTime = 0f;
+            return true;
+        }
+
+        bool slow = smoothedFrameMs > maxFrameTimeMs;
+        frameHoldTime = slow ? frameHoldTime + Time.unscaledDeltaTime : 0f;
+        return slow;
+    }
+
+    /// <summary>
+    /// Whether spawns have been held on frame time for maxFrameHoldSeconds. Starts a new hold period.
+    /// The live-enemy cap has no limit; it clears as enemies die.
+    /// </summary>
+    private bool IsFrameHoldExpired()
+    {
+        if (frameHoldTime < maxFrameHoldSeconds) return false;
+        frameHoldTime = 0f;
+        return true;
+    }
+
+    private void SpawnEnemy(PlannedSpawn spawn)
+    {
+        Vector2 spawnPos = GetSpawnPosition(spawn.direction);
+
+        EnemyBase e = EnemyPool.Spawn(spawn.prefab, spawnPos, Quaternion.identity);
+        if (e == null) return;
 
-        GameObject enemy = Instantiate(prefab, spawnPos, Quaternion.identity);
         aliveEnemies++;
+        e.OnDeath += HandleEnemyDeath;
+    }
+
+    /// <summary>
+    /// Point along direction from the player that is just outside the camera view
+    /// (and at least minSpawnRadius away). The view is the camera's footprint on the player's
+    /// plane, so the pitched perspective camera sees further up-screen than down.
+    /// </summary>
+    private Vector2 GetSpawnPosition(Vector2 direction)
+    {
+        Vector2 playerPos = player.position;
+        float distance = minSpawnRadius;
+
+        if (mainCamera == null)
+            mainCamera = Camera.main;
 
-        EnemyBase e = enemy.GetComponent<EnemyBase>();
-        if (e != null)
+        if (mainCamera != null)
         {
-            e.OnDeath += HandleEnemyDeath;
+            CameraFootprint.Compute(mainCamera, player.position.z, viewFootprint);
+            float toEdge = CameraFootprint.DistanceToEdge(viewFootprint, playerPos, direction);
+            if (toEdge > 0f)
+                distance = Mathf.Max(distance, toEdge + offscreenMargin);
         }
+
+        return playerPos + direction * distance;
     }
 
     private void HandleEnemyDeath(EnemyBase enemy)
@@ -80,12 +306,18 @@ public class EnemySpawner : MonoBehaviour
         TryDropPowerup(enemy.transform.position);
         
         aliveEnemies--;
+        CheckWaveComplete();
+    }
 
-        if (aliveEnemies <= 0)
-        {
-            IsWaveComplete = true;
-            OnWaveCompleted?.Invoke();
-        }
+    /// <summary>
+    /// The wave is over once every planned enemy has spawned and died
+    /// </summary>
+    private void CheckWaveComplete()
+    {
+        if (IsWaveComplete || isSpawning || aliveEnemies > 0) return;
+
+        IsWaveComplete = true;
+        OnWaveCompleted?.Invoke();
     }
     
     private void TryDropPowerup(Vector3 position)
@@ -104,7 +336,6 @@ public class EnemySpawner : MonoBehaviour
         Instantiate(prefab, position, Quaternion.identity);
         hasPowerupDroppedThisWave = true;
         
-        Debug.Log($"Powerup dropped at {position}!");
+        GameLog.Verbose(LogCategory.Enemies, $"Powerup dropped at {position}!");
     }
 }
-
@@ -0,0 +1,103 @@
+using UnityEngine;
+
+/// <summary>
+/// Marks an enemy mesh as drawn by EnemyRenderManager. Its own MeshRenderer is switched off and
+/// the manager draws it in an instanced batch with every other mesh sharing its mesh and material.
+/// Added at runtime by EnemyBase (see AttachAll); tint and hit flash go through here instead of
+/// the renderer.
+/// </summary>
+public class InstancedEnemyMesh : MonoBehaviour
+{
+    private static readonly Vector4 White = new Vector4(1f, 1f, 1f, 1f);
+    private static readonly int BaseColorId = Shader.PropertyToID("_BaseColor");
+
+    private MeshRenderer meshRenderer;
+    private Mesh mesh;
+    private Vector4 tint = White;
+
+    /// <summary>
+    /// Slot in the manager batch while enabled (-1 when not registered)
+    /// </summary>
+    public int RenderIndex { get; set; } = -1;
+
+    /// <summary>
+    /// Manager batch this mesh draws in (-1 until first registered)
+    /// </summary>
+    public int BatchIndex { get; set; } = -1;
+
+    public Mesh Mesh => mesh;
+    public MeshRenderer SourceRenderer => meshRenderer;
+    public Vector4 Tint => tint;
+
+    /// <summary>
+    /// Add an InstancedEnemyMesh to every mesh under root that the manager can draw.
+    /// Returns the attached components (empty when instancing is unavailable).
+    /// </summary>
+    public static InstancedEnemyMesh[] AttachAll(GameObject root)
+    {
+        if (!EnemyRenderManager.InstancingSupported) return System.Array.Empty<InstancedEnemyMesh>();
+
+        MeshRenderer[] renderers = root.GetComponentsInChildren<MeshRenderer>(true);
+        int count = 0;
+        var attached = new InstancedEnemyMesh[renderers.Length];
+        foreach (MeshRenderer r in renderers)
+        {
+            if (!EnemyRenderManager.CanInstance(r)) continue;
+
+            InstancedEnemyMesh instanced = r.GetComponent<InstancedEnemyMesh>();
+            if (instanced == null) instanced = r.gameObject.AddComponent<InstancedEnemyMesh>();
+            attached[count++] = instanced;
+        }
+
+        System.Array.Resize(ref attached, count);
+        return attached;
+    }
+
+    void Awake()
+    {
+        meshRenderer = GetComponent<MeshRenderer>();
+        mesh = GetComponent<MeshFilter>().sharedMesh;
+
+        // Keep a tint EnemyColorVariant applied before this component was attached
+        if (meshRenderer.HasPropertyBlock())
+        {
+            var block = new MaterialPropertyBlock();
+            meshRenderer.GetPropertyBlock(block);
+            if (block.HasColor(BaseColorId)) tint = block.GetColor(BaseColorId);
+        }
+    }
+
+    void OnEnable()
+    {
+        if (EnemyRenderManager.Register(this))
+            meshRenderer.enabled = false;
+    }
+
+    void OnDisable()
+    {
+        EnemyRenderManager.Unregister(this);
+    }
+
+    void OnDestroy()
+    {
+        // Hand drawing back if the manager went away first (scene teardown)
+        if (meshRenderer != null) meshRenderer.enabled = true;
+    }
+
+    /// <summary>
+    /// Per-instance colour multiplier (EnemyColorVariant)
+    /// </summary>
+    public void SetTint(Color color)
+    {
+        tint = color;
+        EnemyRenderManager.SetTint(this, tint);
+    }
+
+    /// <summary>
+    /// Draw fully in the flash colour for duration seconds
+    /// </summary>
+    public void Flash(float duration)
+    {
+        EnemyRenderManager.Flash(this, duration);
+    }
+}
@@ -17,9 +17,17 @@ public class WaveGenerator : MonoBehaviour
 
     private EnemySpawner spawner;
     private int currentWave = 1;
+    private bool externallyDriven;
 
     public int CurrentWaveNumber => currentWave;
 
+    /// <summary>
+    /// Wave configs assigned in the inspector
+    /// </summary>
+    public WaveConfig[] Waves => waves;
+
+    public EnemySpawner Spawner => spawner;
+
     private void Start()
     {
         spawner = Instantiate(
@@ -34,34 +42,62 @@ public class WaveGenerator : MonoBehaviour
             spawner.SetPowerupPrefabs(powerupPrefabs);
         }
 
-        StartCoroutine(WaveLoop());
+        // The next wave is started from the completion event instead of polling every frame
+        spawner.OnWaveCompleted += HandleWaveCompleted;
+        StartCoroutine(PreWaveCountdown());
     }
 
-    private IEnumerator WaveLoop()
+    private void OnDestroy()
     {
-        while (gameStates == null || gameStates.IsGameOver == false)
-        {
-            yield return StartCoroutine(PreWaveCountdown());
+        if (spawner != null)
+            spawner.OnWaveCompleted -= HandleWaveCompleted;
 
-            WaveConfig config = GetWaveConfig(currentWave);
-
-            Debug.Log($"Starting Wave {currentWave}...");
+        // Game over or quit in the middle of a wave
+        WaveTelemetry.EndWave(false);
+    }
 
-            spawner.StartWave(config);
+    private void HandleWaveCompleted()
+    {
+        WaveTelemetry.EndWave(true);
+        if (externallyDriven) return;
+        if (gameStates != null && gameStates.IsGameOver) return;
 
-            yield return new WaitUntil(() => spawner.IsWaveComplete);
+        currentWave++;
+        StartCoroutine(PreWaveCountdown());
+    }
 
-            currentWave++;
-        }
+    /// <summary>
+    /// Stop the wave loop and start config immediately, without countdown or waiting for the
+    /// current wave to be cleared. Used by WaveBenchmark to drive synthetic waves.
+    /// </summary>
+    public void RunWave(WaveConfig config)
+    {
+        StopAllCoroutines();
+        externallyDriven = true;
+        spawner.StartWave(config);
     }
 
+    /// <summary>
+    /// Plan the next wave and build up the enemy pool while the countdown runs, then start it.
+    /// The first countdown also runs GameWarmup's off-screen frame.
+    /// </summary>
     private IEnumerator PreWaveCountdown()
     {
+        WaveConfig config = GetWaveConfig(currentWave);
+        spawner.PlanWave(config);
+        spawner.PrewarmWave(config);
+        if (currentWave == 1)
+            GameWarmup.WarmUpGameplay(config);
+
         for (int i = Mathf.CeilToInt(preWaveCountdownSeconds); i > 0; i--)
         {
-            Debug.Log($"Wave {currentWave} starts in {i}...");
+            GameLog.Verbose(LogCategory.Waves, $"Wave {currentWave} starts in {i}...");
             yield return _waitForSeconds1;
         }
+
+        GameLog.Info(LogCategory.Waves, $"Starting Wave {currentWave}...");
+        WaveTelemetry.BeginWave(currentWave, config);
+        spawner.StartWave(config);
     }
 
     private WaveConfig GetWaveConfig(int waveNumber)
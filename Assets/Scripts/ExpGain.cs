@@ -1,21 +1,40 @@
 using UnityEngine;
 
+/// <summary>
+/// XP orb dropped by enemies. Spawned, pooled and moved by ExpGainManager and picked up by
+/// PlayerContactHandler; the orb itself only holds its value.
+/// </summary>
 [RequireComponent(typeof(Rigidbody2D))]
 [RequireComponent(typeof(Collider2D))]
 public class ExpGain : MonoBehaviour
 {
+    private const float MergeScaleStep = 0.1f;   // Visual growth per merged drop
+    private const float MaxMergeScale = 1.6f;
+
     public float lifeTime = 30f;
     public int expAmountGain;
     private Rigidbody2D rb;
     private Collider2D col;
-    
-    // Magnet attraction
-    private Transform _playerTransform;
-    private PlayerStats _playerStats;
-    private const float MagnetSpeed = 12f;  // Speed to move towards player
-    private const float MagnetAcceleration = 25f;  // How fast to accelerate
-    private float _currentSpeed = 0f;
-    
+    private Vector3 baseScale;
+    private int mergeCount;
+
+    /// <summary>
+    /// Slot in ExpGainManager while live (-1 when not registered)
+    /// </summary>
+    public int SimulationIndex { get; set; } = -1;
+
+    /// <summary>
+    /// Prefab this orb was pooled from (null if it was placed in the scene)
+    /// </summary>
+    public GameObject PoolPrefab { get; set; }
+
+    /// <summary>
+    /// True once the player has picked the orb up; the manager returns it to the pool
+    /// </summary>
+    public bool IsCollected { get; private set; }
+
+    public Rigidbody2D Body => rb;
+
     void Awake()
     {
         rb = GetComponent<Rigidbody2D>();
@@ -24,59 +43,48 @@ public class ExpGain : MonoBehaviour
         rb.collisionDetectionMode = CollisionDetectionMode2D.Continuous;
 
         col.isTrigger = true;
-        
-        // Find player for magnet effect
-        GameObject player = GameObject.FindGameObjectWithTag("Player");
-        if (player != null)
-        {
-            _playerTransform = player.transform;
-            _playerStats = player.GetComponent<PlayerStats>();
-        }
+        baseScale = transform.localScale;
+    }
+
+    void OnEnable()
+    {
+        ExpGainManager.Register(this);
+    }
+
+    void OnDisable()
+    {
+        ExpGainManager.Unregister(this);
     }
 
     public void Init(int expAmount)
     {
         expAmountGain = expAmount;
-        Destroy(gameObject, lifeTime);
+        IsCollected = false;
+        mergeCount = 0;
+        transform.localScale = baseScale;
+        rb.linearVelocity = Vector2.zero;
     }
-    
-    void Update()
+
+    /// <summary>
+    /// Fold another drop into this orb
+    /// </summary>
+    public void Merge(int expAmount)
     {
-        // Check for magnet attraction
-        if (_playerStats != null && _playerStats.HasMagnetActive && _playerTransform != null)
-        {
-            float magnetRadius = _playerStats.MagnetRadius;
-            float distanceToPlayer = Vector2.Distance(transform.position, _playerTransform.position);
-            
-            if (distanceToPlayer <= magnetRadius)
-            {
-                // Accelerate towards player
-                _currentSpeed = Mathf.MoveTowards(_currentSpeed, MagnetSpeed, MagnetAcceleration * Time.deltaTime);
-                
-                Vector2 direction = ((Vector2)_playerTransform.position - (Vector2)transform.position).normalized;
-                rb.linearVelocity = direction * _currentSpeed;
-            }
-        }
-        else if (_currentSpeed > 0f)
-        {
-            // Magnet expired, slow down
-            _currentSpeed = Mathf.MoveTowards(_currentSpeed, 0f, MagnetAcceleration * Time.deltaTime);
-            if (_currentSpeed <= 0.1f)
-            {
-                rb.linearVelocity = Vector2.zero;
-                _currentSpeed = 0f;
-            }
-        }
+        expAmountGain += expAmount;
+        mergeCount++;
+        transform.localScale = baseScale * Mathf.Min(MaxMergeScale, 1f + mergeCount * MergeScaleStep);
     }
 
-    void OnTriggerEnter2D(Collider2D other)
+    /// <summary>
+    /// Mark the orb as picked up; the manager despawns it in its next Update.
+    /// Returns false if it was already collected.
+    /// </summary>
+    public bool Collect()
     {
-        if (other.CompareTag("Player"))
-        {
-            // Play satisfying pickup sound
-            ProceduralXPPickupAudio.PlayPickup();
-            
-            Destroy(gameObject);
-        }
+        if (IsCollected) return false;
+
+        IsCollected = true;
+        rb.linearVelocity = Vector2.zero;
+        return true;
     }
 }
@@ -0,0 +1,309 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+/// <summary>
+/// Owns every live XP orb: pools them per prefab, runs magnet attraction and lifetime for all of
+/// them in one Update, and merges orbs that would spawn on top of each other into a single orb
+/// worth their sum so the live count stays bounded during big waves.
+/// </summary>
+public class ExpGainManager : MonoBehaviour
+{
+    private const int InitialCapacity = 256;
+    private const float MagnetSpeed = 12f;          // Speed to move towards player
+    private const float MagnetAcceleration = 25f;   // How fast to accelerate
+
+    [Header("Merging")]
+    [SerializeField] private float mergeRadius = 0.75f;   // New orbs closer than this to a live orb fold into it
+    [SerializeField] private int maxActiveOrbs = 250;     // Past this, new orbs fold into the nearest live orb
+
+    private static ExpGainManager instance;
+
+    // Live orbs (indexed by ExpGain.SimulationIndex)
+    private readonly List<ExpGain> orbs = new List<ExpGain>(InitialCapacity);
+    private readonly Dictionary<GameObject, ExpGain> byGameObject = new Dictionary<GameObject, ExpGain>(InitialCapacity);
+    private Vector2[] positions = new Vector2[InitialCapacity];
+    private float[] speeds = new float[InitialCapacity];
+    private float[] expireTimes = new float[InitialCapacity];
+
+    private readonly Dictionary<GameObject, Stack<ExpGain>> pools = new Dictionary<GameObject, Stack<ExpGain>>();
+    private Transform poolRoot;
+
+    private Transform player;
+    private PlayerStats playerStats;
+    private int magnetStatsVersion = -1;
+    private float magnetRadiusSqr;
+
+    /// <summary>
+    /// Number of XP orbs currently in the world
+    /// </summary>
+    public static int ActiveCount => instance != null ? instance.orbs.Count : 0;
+
+    /// <summary>
+    /// Live orb on a GameObject (e.g. a player contact), without GetComponent
+    /// </summary>
+    public static ExpGain FromGameObject(GameObject obj)
+    {
+        return instance != null && obj != null && instance.byGameObject.TryGetValue(obj, out ExpGain orb) ? orb : null;
+    }
+
+    private static ExpGainManager GetOrCreate()
+    {
+        if (instance == null && Application.isPlaying)
+        {
+            GameObject obj = new GameObject("ExpGainManager");
+            instance = obj.AddComponent<ExpGainManager>();
+        }
+        return instance;
+    }
+
+    /// <summary>
+    /// Drop expAmount of XP at position: merges into a nearby live orb when there is one,
+    /// otherwise takes an orb from the prefab's pool (or creates one).
+    /// Returns the orb that holds the XP.
+    /// </summary>
+    public static ExpGain Spawn(ExpGain prefab, Vector3 position, int expAmount)
+    {
+        if (prefab == null) return null;
+
+        ExpGainManager manager = GetOrCreate();
+        if (manager == null) return null;
+
+        ExpGain target = manager.FindMergeTarget(position);
+        if (target != null)
+        {
+            target.Merge(expAmount);
+            manager.expireTimes[target.SimulationIndex] = Time.time + target.lifeTime;
+            return target;
+        }
+
+        ExpGain orb = manager.Take(prefab);
+        Transform t = orb.transform;
+        t.SetParent(null, false);   // Leaving the inactive pool root activates the orb (and registers it)
+        t.SetPositionAndRotation(position, Quaternion.identity);
+        orb.Body.position = position;
+        orb.Init(expAmount);
+
+        if (orb.SimulationIndex >= 0)
+            manager.positions[orb.SimulationIndex] = position;
+        return orb;
+    }
+
+    public static void Register(ExpGain orb)
+    {
+        ExpGainManager manager = GetOrCreate();
+        if (manager == null || orb.SimulationIndex >= 0) return;
+
+        int index = manager.orbs.Count;
+        manager.EnsureCapacity(index + 1);
+        manager.orbs.Add(orb);
+        manager.byGameObject[orb.gameObject] = orb;
+        manager.positions[index] = orb.transform.position;
+        manager.speeds[index] = 0f;
+        manager.expireTimes[index] = Time.time + orb.lifeTime;
+        orb.SimulationIndex = index;
+    }
+
+    public static void Unregister(ExpGain orb)
+    {
+        if (instance == null) return;
+        instance.RemoveAt(orb);
+    }
+
+    void Awake()
+    {
+        if (instance != null && instance != this)
+        {
+            Destroy(this);
+            return;
+        }
+        instance = this;
+
+        GameObject rootObj = new GameObject("Pool");
+        rootObj.SetActive(false);
+        poolRoot = rootObj.transform;
+        poolRoot.SetParent(transform, false);
+    }
+
+    void OnDestroy()
+    {
+        if (instance != this) return;
+        instance = null;
+
+        foreach (ExpGain orb in orbs)
+        {
+            if (orb != null) orb.SimulationIndex = -1;
+        }
+    }
+
+    void Update()
+    {
+        if (player == null)
+        {
+            GameObject playerObj = GameObject.FindGameObjectWithTag("Player");
+            if (playerObj != null)
+            {
+                player = playerObj.transform;
+                playerStats = playerObj.GetComponent<PlayerStats>();
+                magnetStatsVersion = -1;
+            }
+        }
+
+        // Magnet state is recomputed only when PlayerStats reports a change
+        if (playerStats != null && playerStats.Version != magnetStatsVersion)
+        {
+            magnetStatsVersion = playerStats.Version;
+            magnetRadiusSqr = playerStats.HasMagnetActive ? playerStats.MagnetRadius * playerStats.MagnetRadius : 0f;
+        }
+        bool magnetActive = playerStats != null && player != null && magnetRadiusSqr > 0f;
+        Vector2 playerPos = player != null ? (Vector2)player.position : Vector2.zero;
+        float maxDelta = MagnetAcceleration * Time.deltaTime;
+        float now = Time.time;
+
+        // Backwards so despawning (swap-remove) never skips an orb
+        for (int i = orbs.Count - 1; i >= 0; i--)
+        {
+            ExpGain orb = orbs[i];
+            if (orb == null)
+            {
+                RemoveIndex(i);
+                continue;
+            }
+
+            if (orb.IsCollected || now >= expireTimes[i])
+            {
+                Release(orb);
+                continue;
+            }
+
+            Rigidbody2D body = orb.Body;
+            Vector2 pos = body.position;
+            positions[i] = pos;
+
+            if (magnetActive)
+            {
+                Vector2 toPlayer = playerPos - pos;
+                float distSqr = toPlayer.sqrMagnitude;
+                if (distSqr <= magnetRadiusSqr && distSqr > 0.0001f)
+                {
+                    // Accelerate towards player
+                    speeds[i] = Mathf.MoveTowards(speeds[i], MagnetSpeed, maxDelta);
+                    body.linearVelocity = toPlayer / Mathf.Sqrt(distSqr) * speeds[i];
+                }
+            }
+            else if (speeds[i] > 0f)
+            {
+                // Magnet expired, slow down
+                speeds[i] = Mathf.MoveTowards(speeds[i], 0f, maxDelta);
+                if (speeds[i] <= 0.1f)
+                {
+                    body.linearVelocity = Vector2.zero;
+                    speeds[i] = 0f;
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// Live orb a new drop at position should fold into, or null to spawn a new orb
+    /// </summary>
+    private ExpGain FindMergeTarget(Vector3 position)
+    {
+        bool atCap = orbs.Count >= maxActiveOrbs;
+        float bestSqr = atCap ? float.MaxValue : mergeRadius * mergeRadius;
+        Vector2 pos = position;
+        ExpGain best = null;
+
+        for (int i = 0; i < orbs.Count; i++)
+        {
+            ExpGain orb = orbs[i];
+            if (orb == null || orb.IsCollected) continue;
+
+            float distSqr = (positions[i] - pos).sqrMagnitude;
+            if (distSqr <= bestSqr)
+            {
+                bestSqr = distSqr;
+                best = orb;
+            }
+        }
+        return best;
+    }
+
+    private ExpGain Take(ExpGain prefab)
+    {
+        if (pools.TryGetValue(prefab.gameObject, out Stack<ExpGain> stack))
+        {
+            while (stack.Count > 0)
+            {
+                // Skip orbs destroyed externally while pooled
+                ExpGain pooled = stack.Pop();
+                if (pooled != null) return pooled;
+            }
+        }
+
+        ExpGain orb = Instantiate(prefab, poolRoot, false);
+        orb.name = prefab.name;
+        orb.PoolPrefab = prefab.gameObject;
+        return orb;
+    }
+
+    /// <summary>
+    /// Return an orb to its pool. Orbs that were not spawned through the manager are destroyed.
+    /// </summary>
+    private void Release(ExpGain orb)
+    {
+        RemoveAt(orb);
+
+        GameObject prefab = orb.PoolPrefab;
+        if (prefab == null)
+        {
+            Destroy(orb.gameObject);
+            return;
+        }
+
+        orb.Body.linearVelocity = Vector2.zero;
+        orb.transform.SetParent(poolRoot, false);
+
+        if (!pools.TryGetValue(prefab, out Stack<ExpGain> stack))
+        {
+            stack = new Stack<ExpGain>();
+            pools[prefab] = stack;
+        }
+        stack.Push(orb);
+    }
+
+    private void RemoveAt(ExpGain orb)
+    {
+        int index = orb.SimulationIndex;
+        if (index < 0 || index >= orbs.Count || orbs[index] != orb) return;
+
+        RemoveIndex(index);
+        byGameObject.Remove(orb.gameObject);
+        orb.SimulationIndex = -1;
+    }
+
+    private void RemoveIndex(int index)
+    {
+        // Swap-remove keeps unregistering O(1)
+        int last = orbs.Count - 1;
+        if (index != last)
+        {
+            ExpGain moved = orbs[last];
+            orbs[index] = moved;
+            positions[index] = positions[last];
+            speeds[index] = speeds[last];
+            expireTimes[index] = expireTimes[last];
+            if (moved != null) moved.SimulationIndex = index;
+        }
+        orbs.RemoveAt(last);
+    }
+
+    private void EnsureCapacity(int count)
+    {
+        if (positions.Length >= count) return;
+
+        int size = Mathf.NextPowerOfTwo(count);
+        System.Array.Resize(ref positions, size);
+        System.Array.Resize(ref speeds, size);
+        System.Array.Resize(ref expireTimes, size);
+    }
+}
@@ -27,6 +27,13 @@ public static class ForceLandscapeAspect
     private static bool _isFocusLost = false;
     private static float _savedTimeScale = 1f;
     private static GameObject _rotateOverlay;
+    private static Rect _viewportRect = new Rect(0f, 0f, 1f, 1f);
+    private const string ClearCameraName = "[LetterboxClearCamera]";
+
+    /// <summary>
+    /// Letterboxed viewport applied to every tracked camera
+    /// </summary>
+    public static Rect ViewportRect => _viewportRect;
     
     // Debounce timer to prevent rapid state changes (especially on iOS Safari offline)
     private static float _lastOrientationChangeTime = -999f;
@@ -72,11 +79,14 @@ public static class ForceLandscapeAspect
         if (DEBUG_MODE)
             Debug.Log($"[ForceLandscapeAspect] Scene loaded: {scene.name}, updating all cameras...");
         
+        // One scan per scene load; from then on cameras register themselves on enable
+        TrackedCamera.AttachAll(ClearCameraName);
         UpdateAllCameras();
     }
 
     /// <summary>
-    /// Updates the viewport of all active cameras to enforce landscape aspect ratio
+    /// Updates the viewport of all active cameras to enforce landscape aspect ratio.
+    /// Disabled cameras pick the rect up in TrackedCamera.OnEnable.
     /// </summary>
     public static void UpdateAllCameras()
     {
@@ -108,20 +118,16 @@ public static class ForceLandscapeAspect
         }
         
         Rect targetRect = CalculateViewportRect(screenAspect);
+        _viewportRect = targetRect;
 
-        // Find and update ALL cameras (including inactive ones that might become active)
-        Camera[] allCameras = Object.FindObjectsByType<Camera>(FindObjectsInactive.Include, FindObjectsSortMode.None);
-        
-        foreach (Camera cam in allCameras)
+        var cameras = TrackedCamera.Active;
+        for (int i = 0; i < cameras.Count; i++)
         {
-            if (cam != null && cam.gameObject.name != "[LetterboxClearCamera]")
-            {
-                cam.rect = targetRect;
-            }
+            cameras[i].Camera.rect = targetRect;
         }
 
         if (DEBUG_MODE)
-            Debug.Log($"[ForceLandscapeAspect] Updated {allCameras.Length} cameras. Screen: {Screen.width}x{Screen.height}, Aspect: {screenAspect:F3}, Rect: {targetRect}");
+            Debug.Log($"[ForceLandscapeAspect] Updated {cameras.Count} cameras. Screen: {Screen.width}x{Screen.height}, Aspect: {screenAspect:F3}, Rect: {targetRect}");
     }
 
     private static void OnEnteredPortrait()
@@ -238,6 +244,7 @@ public static class ForceLandscapeAspect
         scaler.matchWidthOrHeight = 0.5f;
         
         _rotateOverlay.AddComponent<GraphicRaycaster>();
+        _rotateOverlay.AddComponent<TrackedCanvas>();
         
         // Dark background
         GameObject bgObj = new GameObject("Background");
@@ -430,7 +437,7 @@ public static class ForceLandscapeAspect
         void Start()
         {
             // Create a camera specifically for clearing the letterbox/pillarbox areas to black
-            var clearCamObj = new GameObject("[LetterboxClearCamera]");
+            var clearCamObj = new GameObject(ClearCameraName);
             clearCamObj.transform.SetParent(transform);
             _clearCamera = clearCamObj.AddComponent<Camera>();
             _clearCamera.depth = -100; // Render first (behind everything)
@@ -1,6 +1,9 @@
+using System.Diagnostics;
 using UnityEngine;
+using UnityEngine.LowLevel;
 using UnityEngine.Rendering;
 using UnityEngine.InputSystem;
+using Debug = UnityEngine.Debug;
 #if UNITY_STANDALONE_WIN && !UNITY_EDITOR
 using UnityEngine.NVIDIA;
 #endif
@@ -39,6 +42,42 @@ public class FrameRateOptimizer : MonoBehaviour
     public static string ActiveLatencyMode { get; private set; } = "None";
     public static string PlatformInfo { get; private set; } = "";
 
+    // Frame phase timing (all platforms) - filled by the markers below
+    private static readonly Stopwatch _phaseClock = Stopwatch.StartNew();
+    private static long _simulationStartTicks;
+    private static long _renderStartTicks;
+    private static long _fixedStartTicks;
+    private static long _fixedTicksThisFrame;
+    private static int _fixedStepsThisFrame;
+
+    /// <summary>
+    /// Main-thread CPU time of the last frame's simulation (FixedUpdate, Update, LateUpdate) in ms
+    /// </summary>
+    public static float SimulationMs { get; private set; }
+
+    /// <summary>
+    /// Main-thread CPU time of the last frame's render submission (PostLateUpdate) in ms
+    /// </summary>
+    public static float RenderSubmitMs { get; private set; }
+
+    /// <summary>
+    /// Main-thread CPU time of all FixedUpdate steps in the last frame in ms (part of SimulationMs)
+    /// </summary>
+    public static float FixedUpdateMs { get; private set; }
+
+    /// <summary>
+    /// Number of FixedUpdate steps the last frame ran
+    /// </summary>
+    public static int FixedStepsLastFrame { get; private set; }
+
+    // PlayerLoop system types for the phase markers
+    private struct SimulationStartMarker { }
+    private struct SimulationEndMarker { }
+    private struct RenderStartMarker { }
+    private struct RenderEndMarker { }
+    private struct FixedStartMarker { }
+    private struct FixedEndMarker { }
+
     private void Awake()
     {
         if (_optimizationsApplied)
@@ -50,17 +89,6 @@ public class FrameRateOptimizer : MonoBehaviour
         ApplyAllOptimizations();
     }
 
-    // Process Reflex markers every frame
-    private void Update()
-    {
-        MarkSimulationStart();
-    }
-
-    private void LateUpdate()
-    {
-        MarkSimulationEnd();
-    }
-
     private void ApplyAllOptimizations()
     {
         _optimizationsApplied = true;
@@ -84,6 +112,8 @@ public class FrameRateOptimizer : MonoBehaviour
         
         ApplyMiscOptimizations();
 
+        InstallFrameMarkers();
+
         Debug.Log($"[FrameRateOptimizer] ✓ All optimizations applied");
         Debug.Log($"[FrameRateOptimizer] ✓ Active latency mode: {ActiveLatencyMode}");
     }
@@ -184,9 +214,9 @@ public class FrameRateOptimizer : MonoBehaviour
             var settings = InputSystem.settings;
             if (settings != null)
             {
-                // Process input in sync with player loop (not in background)
-                // This ensures input is read at the start of each frame
-                settings.updateMode = InputSettings.UpdateMode.ProcessEventsInDynamicUpdate;
+                // Process input in InputSampler's stage at the end of EarlyUpdate, ahead of
+                // FixedUpdate, rather than in PreUpdate after it - a touch moves the player this frame
+                InputSampler.UseManualUpdates();
                 
                 // Reduce input buffering - process events immediately
                 // Lower = less buffering = lower latency, but may miss rapid inputs
@@ -198,7 +228,7 @@ public class FrameRateOptimizer : MonoBehaviour
                 settings.backgroundBehavior = InputSettings.BackgroundBehavior.ResetAndDisableAllDevices;
                 settings.editorInputBehaviorInPlayMode = InputSettings.EditorInputBehaviorInPlayMode.AllDeviceInputAlwaysGoesToGameView;
                 
-                Debug.Log("[FrameRateOptimizer] Input System: Dynamic update, minimal buffering");
+                Debug.Log("[FrameRateOptimizer] Input System: Manual update before FixedUpdate, minimal buffering");
             }
         }
         catch (System.Exception e)
@@ -426,10 +456,85 @@ public class FrameRateOptimizer : MonoBehaviour
         Debug.Log($"[FrameRateOptimizer] Platform Mode: {ActiveLatencyMode}");
     }
 
-    // ==================== REFLEX MARKERS ====================
-    
+    // ==================== FRAME MARKERS ====================
+
+    /// <summary>
+    /// Hook the phase markers into the PlayerLoop: simulation runs from the end of EarlyUpdate
+    /// (before FixedUpdate) to the end of PreLateUpdate, render submission is all of PostLateUpdate,
+    /// and each FixedUpdate step is timed on its own.
+    /// Safe to call more than once. Used by this optimizer and by PerformanceHud.
+    /// </summary>
+    public static void InstallFrameMarkers()
+    {
+        PlayerLoopSystem loop = PlayerLoop.GetCurrentPlayerLoop();
+        if (loop.subSystemList == null || ContainsSystem(loop, typeof(SimulationStartMarker))) return;
+
+        for (int i = 0; i < loop.subSystemList.Length; i++)
+        {
+            ref PlayerLoopSystem phase = ref loop.subSystemList[i];
+            if (phase.type == typeof(UnityEngine.PlayerLoop.EarlyUpdate))
+                phase.subSystemList = Insert(phase.subSystemList, false, typeof(SimulationStartMarker), MarkSimulationStart);
+            else if (phase.type == typeof(UnityEngine.PlayerLoop.FixedUpdate))
+            {
+                phase.subSystemList = Insert(phase.subSystemList, true, typeof(FixedStartMarker), MarkFixedStart);
+                phase.subSystemList = Insert(phase.subSystemList, false, typeof(FixedEndMarker), MarkFixedEnd);
+            }
+            else if (phase.type == typeof(UnityEngine.PlayerLoop.PreLateUpdate))
+                phase.subSystemList = Insert(phase.subSystemList, false, typeof(SimulationEndMarker), MarkSimulationEnd);
+            else if (phase.type == typeof(UnityEngine.PlayerLoop.PostLateUpdate))
+            {
+                phase.subSystemList = Insert(phase.subSystemList, true, typeof(RenderStartMarker), MarkRenderStart);
+                phase.subSystemList = Insert(phase.subSystemList, false, typeof(RenderEndMarker), MarkRenderEnd);
+            }
+        }
+
+        PlayerLoop.SetPlayerLoop(loop);
+    }
+
+    internal static PlayerLoopSystem[] Insert(PlayerLoopSystem[] systems, bool atStart, System.Type type, PlayerLoopSystem.UpdateFunction callback)
+    {
+        int count = systems?.Length ?? 0;
+        var result = new PlayerLoopSystem[count + 1];
+        int offset = atStart ? 1 : 0;
+        if (count > 0)
+            System.Array.Copy(systems, 0, result, offset, count);
+        result[atStart ? 0 : count] = new PlayerLoopSystem { type = type, updateDelegate = callback };
+        return result;
+    }
+
+    internal static bool ContainsSystem(PlayerLoopSystem system, System.Type type)
+    {
+        if (system.type == type) return true;
+        if (system.subSystemList == null) return false;
+
+        foreach (PlayerLoopSystem sub in system.subSystemList)
+        {
+            if (ContainsSystem(sub, type)) return true;
+        }
+        return false;
+    }
+
+    private static float TicksToMs(long ticks)
+    {
+        return (float)(ticks * 1000.0 / Stopwatch.Frequency);
+    }
+
+    private static void MarkFixedStart()
+    {
+        _fixedStartTicks = _phaseClock.ElapsedTicks;
+    }
+
+    private static void MarkFixedEnd()
+    {
+        _fixedTicksThisFrame += _phaseClock.ElapsedTicks - _fixedStartTicks;
+        _fixedStepsThisFrame++;
+    }
+
     public static void MarkSimulationStart()
     {
+        _simulationStartTicks = _phaseClock.ElapsedTicks;
+        _fixedTicksThisFrame = 0;
+        _fixedStepsThisFrame = 0;
 #if UNITY_STANDALONE_WIN && !UNITY_EDITOR
         if (!_reflexEnabled) return;
         try { GraphicsDevice.device?.SetReflexMarker(ReflexMarker.SimulationStart); }
@@ -439,6 +544,9 @@ public class FrameRateOptimizer : MonoBehaviour
 
     public static void MarkSimulationEnd()
     {
+        SimulationMs = TicksToMs(_phaseClock.ElapsedTicks - _simulationStartTicks);
+        FixedUpdateMs = TicksToMs(_fixedTicksThisFrame);
+        FixedStepsLastFrame = _fixedStepsThisFrame;
 #if UNITY_STANDALONE_WIN && !UNITY_EDITOR
         if (!_reflexEnabled) return;
         try { GraphicsDevice.device?.SetReflexMarker(ReflexMarker.SimulationEnd); }
@@ -448,6 +556,7 @@ public class FrameRateOptimizer : MonoBehaviour
 
     public static void MarkRenderStart()
     {
+        _renderStartTicks = _phaseClock.ElapsedTicks;
 #if UNITY_STANDALONE_WIN && !UNITY_EDITOR
         if (!_reflexEnabled) return;
         try { GraphicsDevice.device?.SetReflexMarker(ReflexMarker.RenderSubmitStart); }
@@ -457,6 +566,7 @@ public class FrameRateOptimizer : MonoBehaviour
 
     public static void MarkRenderEnd()
     {
+        RenderSubmitMs = TicksToMs(_phaseClock.ElapsedTicks - _renderStartTicks);
 #if UNITY_STANDALONE_WIN && !UNITY_EDITOR
         if (!_reflexEnabled) return;
         try { GraphicsDevice.device?.SetReflexMarker(ReflexMarker.RenderSubmitEnd); }
@@ -478,6 +588,8 @@ VSync: {(QualitySettings.vSyncCount == 0 ? "OFF ✓" : "ON ✗")}
 Target FPS: {Application.targetFrameRate}
 Max Queued Frames: {QualitySettings.maxQueuedFrames}
 Physics Rate: {(1f / Time.fixedDeltaTime):F0}Hz
+Input Update: {(InputSampler.ManualUpdates ? "Before FixedUpdate ✓" : "Dynamic")}
+Input→Motion: {InputSampler.AverageLatencyMs:F1}ms
 NVIDIA Reflex: {(_reflexEnabled ? "ENABLED ✓" : "N/A")}
 Metal Optimized: {(_metalOptimized ? "YES ✓" : "N/A")}
 Graphics API: {SystemInfo.graphicsDeviceType}";
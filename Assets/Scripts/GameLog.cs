@@ -0,0 +1,200 @@
+using System.Text;
+using UnityEngine;
+
+/// <summary>
+/// Subsystem a GameLog message belongs to; each can be muted at runtime (GameLog.SetEnabled)
+/// </summary>
+public enum LogCategory
+{
+    General,
+    Enemies,
+    Waves,
+    Player,
+    Input,
+    UI,
+    Audio,
+    Rendering,
+    Performance,
+    Content,
+    Count
+}
+
+public enum LogLevel
+{
+    Verbose,
+    Info,
+    Warning,
+    Error
+}
+
+/// <summary>
+/// Logging facade for gameplay code. Every message goes into a ring buffer of recent entries
+/// (the pause menu dumps it with F4); whether it also reaches the console depends on the level:
+/// - Verbose: per-event messages on hot paths (enemy deaths, spawns, pickups). The calls are
+///   [Conditional] - compiled out of release builds together with their string formatting - and
+///   only exist in the editor, development builds, or with BROCOLI_VERBOSE_LOGS defined.
+/// - Info: occasional state changes. Console in the editor and development builds; release builds
+///   keep them in the ring buffer only, since every console line is slow to reach the browser on WebGL.
+/// - Warning / Error: always logged to the console.
+/// Debug.Log calls from code not using the facade are captured into the buffer too (as General).
+/// </summary>
+public static class GameLog
+{
+    private const int BufferSize = 256;
+
+#if UNITY_EDITOR || DEVELOPMENT_BUILD
+    private static readonly bool InfoToConsole = true;
+#else
+    private static readonly bool InfoToConsole = false;
+#endif
+
+    private struct Entry
+    {
+        public float time;
+        public int frame;
+        public LogCategory category;
+        public LogLevel level;
+        public string message;
+    }
+
+    private static readonly Entry[] buffer = new Entry[BufferSize];
+    private static readonly bool[] enabled = CreateEnabled();
+    private static int head;
+    private static int count;
+    private static bool forwarding;     // Set while the facade itself writes to the console
+
+    /// <summary>
+    /// Entries currently held in the ring buffer
+    /// </summary>
+    public static int BufferedCount => count;
+
+    [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.SubsystemRegistration)]
+    private static void Initialize()
+    {
+        head = 0;
+        count = 0;
+        Application.logMessageReceived -= HandleLogMessage;
+        Application.logMessageReceived += HandleLogMessage;
+    }
+
+    private static bool[] CreateEnabled()
+    {
+        var flags = new bool[(int)LogCategory.Count];
+        for (int i = 0; i < flags.Length; i++) flags[i] = true;
+        return flags;
+    }
+
+    public static bool IsEnabled(LogCategory category) => enabled[(int)category];
+
+    /// <summary>
+    /// Mute or unmute a category's Verbose and Info messages (warnings and errors always pass)
+    /// </summary>
+    public static void SetEnabled(LogCategory category, bool on)
+    {
+        enabled[(int)category] = on;
+    }
+
+    [System.Diagnostics.Conditional("UNITY_EDITOR"), System.Diagnostics.Conditional("DEVELOPMENT_BUILD"),
+     System.Diagnostics.Conditional("BROCOLI_VERBOSE_LOGS")]
+    public static void Verbose(LogCategory category, string message)
+    {
+        if (!enabled[(int)category]) return;
+
+        Record(category, LogLevel.Verbose, message);
+        Forward(LogType.Log, category, message);
+    }
+
+    public static void Info(LogCategory category, string message)
+    {
+        if (!enabled[(int)category]) return;
+
+        Record(category, LogLevel.Info, message);
+        if (InfoToConsole) Forward(LogType.Log, category, message);
+    }
+
+    public static void Warning(LogCategory category, string message)
+    {
+        Record(category, LogLevel.Warning, message);
+        Forward(LogType.Warning, category, message);
+    }
+
+    public static void Error(LogCategory category, string message)
+    {
+        Record(category, LogLevel.Error, message);
+        Forward(LogType.Error, category, message);
+    }
+
+    /// <summary>
+    /// The buffered entries, oldest first, one per line
+    /// </summary>
+    public static string Dump()
+    {
+        var text = new StringBuilder(count * 64);
+        int start = (head - count + BufferSize) % BufferSize;
+        for (int i = 0; i < count; i++)
+        {
+            Entry entry = buffer[(start + i) % BufferSize];
+            text.Append(entry.time.ToString("F2")).Append("s #").Append(entry.frame)
+                .Append(' ').Append(entry.level).Append(" [").Append(entry.category).Append("] ")
+                .Append(entry.message).Append('\n');
+        }
+        return text.ToString();
+    }
+
+    /// <summary>
+    /// Write the buffer to the console as one message and copy it to the clipboard
+    /// </summary>
+    public static void DumpToConsole()
+    {
+        string dump = Dump();
+        GUIUtility.systemCopyBuffer = dump;
+
+        forwarding = true;
+        try
+        {
+            Debug.Log($"[GameLog] Last {count} log entries:\n{dump}");
+        }
+        finally
+        {
+            forwarding = false;
+        }
+    }
+
+    private static void Record(LogCategory category, LogLevel level, string message)
+    {
+        buffer[head] = new Entry
+        {
+            time = Time.realtimeSinceStartup,
+            frame = Time.frameCount,
+            category = category,
+            level = level,
+            message = message
+        };
+        head = (head + 1) % BufferSize;
+        if (count < BufferSize) count++;
+    }
+
+    private static void Forward(LogType type, LogCategory category, string message)
+    {
+        forwarding = true;
+        try
+        {
+            string line = $"[{category}] {message}";
+            if (type == LogType.Error) Debug.LogError(line);
+            else if (type == LogType.Warning) Debug.LogWarning(line);
+            else Debug.Log(line);
+        }
+        finally
+        {
+            forwarding = false;
+        }
+    }
+
+    private static void HandleLogMessage(string condition, string stackTrace, LogType type)
+    {
+        if (forwarding) return;
+
+        LogLevel level = type == LogType.Log ? LogLevel.Info : type == LogType.Warning ? LogLevel.Warning : LogLevel.Error;
+        Record(LogCategory.General, level, condition);
+    }
+}
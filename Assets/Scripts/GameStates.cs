@@ -15,6 +15,14 @@ public class GameStates : MonoBehaviour
     {
         score = 0;
         gameTime = 0f;
+
+        // Debounced saves wait for safe points (level-up, pause, game over) during a run
+        SaveService.SetGameplayActive(true);
+    }
+
+    void OnDestroy()
+    {
+        SaveService.SetGameplayActive(false);
     }
 
     void Update()
@@ -0,0 +1,167 @@
+using System.Collections;
+using UnityEngine;
+
+/// <summary>
+/// Pays the first-use costs of gameplay rendering before wave 1 instead of during it.
+/// Behind the main menu, the build's shader variants (ShaderWarmupBuilder) are compiled a few per
+/// frame. During the first PreWaveCountdown the remaining variants are finished and one frame of
+/// the spray, every enemy mesh of the wave and the level-up panel is drawn off-screen - into a
+/// small render texture far from the play area - so pipeline states, particle buffers and UI
+/// meshes exist before they are needed. Procedural audio renders its clip sets from Awake
+/// (ProceduralClipCache), which the countdown's pool prewarm triggers for the wave's enemies.
+/// </summary>
+public class GameWarmup : MonoBehaviour
+{
+    public const string VariantCollectionName = "WarmupVariants";
+
+    // Compiling a variant can take several ms on WebGL; keep the menu responsive
+    private const int VariantsPerFrame = 2;
+
+    private const int WarmupTextureSize = 64;
+    private const int SprayBurstCount = 24;
+    private static readonly Vector3 WarmupOrigin = new Vector3(0f, 50000f, 0f);
+
+    private static GameWarmup instance;
+
+    private ShaderVariantCollection variants;
+    private Coroutine variantRoutine;
+    private bool variantsWarm;
+    private bool gameplayStarted;
+
+    /// <summary>
+    /// True once the variant collection is compiled (or there is none)
+    /// </summary>
+    public static bool ShadersWarm => instance != null && instance.variantsWarm;
+
+    /// <summary>
+    /// True once the off-screen gameplay frame has been drawn
+    /// </summary>
+    public static bool GameplayWarm { get; private set; }
+
+    private static GameWarmup EnsureInstance()
+    {
+        if (instance == null)
+        {
+            GameObject obj = new GameObject("GameWarmup");
+            DontDestroyOnLoad(obj);
+            instance = obj.AddComponent<GameWarmup>();
+        }
+        return instance;
+    }
+
+    /// <summary>
+    /// Start compiling the shader variant collection in the background (MainMenu)
+    /// </summary>
+    public static void BeginShaderWarmup()
+    {
+        EnsureInstance().StartVariants();
+    }
+
+    /// <summary>
+    /// Finish the shaders and draw the off-screen gameplay frame for the first wave
+    /// (WaveGenerator.PreWaveCountdown). Runs once per session.
+    /// </summary>
+    public static void WarmUpGameplay(WaveConfig config)
+    {
+        GameWarmup warmup = EnsureInstance();
+        if (warmup.gameplayStarted) return;
+
+        warmup.gameplayStarted = true;
+        warmup.StartVariants();
+        warmup.StartCoroutine(warmup.WarmUpGameplayRoutine(config));
+    }
+
+    private void StartVariants()
+    {
+        if (variantsWarm || variantRoutine != null) return;
+        variantRoutine = StartCoroutine(WarmUpVariants());
+    }
+
+    private IEnumerator WarmUpVariants()
+    {
+        variants = BakedAssets.Load<ShaderVariantCollection>(VariantCollectionName);
+        if (variants != null)
+        {
+            float start = Time.realtimeSinceStartup;
+            while (!variants.WarmUpProgressively(VariantsPerFrame))
+                yield return null;
+
+            GameLog.Info(LogCategory.Rendering, $"[GameWarmup] {variants.variantCount} shader variant(s) warmed in {Time.realtimeSinceStartup - start:F1}s");
+        }
+
+        variantsWarm = true;
+        variantRoutine = null;
+    }
+
+    private IEnumerator WarmUpGameplayRoutine(WaveConfig config)
+    {
+        while (!variantsWarm)
+            yield return null;
+
+        float start = Time.realtimeSinceStartup;
+
+        GameObject root = new GameObject("GameWarmupFrame");
+        root.transform.SetParent(transform);
+        root.transform.position = WarmupOrigin;
+
+        var target = new RenderTexture(WarmupTextureSize, WarmupTextureSize, 16);
+        Camera camera = CreateCamera(root.transform, target);
+
+        var spray = new SprayParticleLayers(root.transform);
+        spray.CreateAllLayers();
+        spray.SetDirectionAndPosition(Vector2.right, WarmupOrigin);
+        spray.PlayBurst(SprayBurstCount);
+
+        LevelUpScreen levelUpScreen = FindFirstObjectByType<LevelUpScreen>(FindObjectsInactive.Include);
+        if (levelUpScreen != null) levelUpScreen.WarmUp();
+
+        // Two frames: the burst emits in the first, instanced draws are queued per frame
+        int meshes = 0;
+        for (int frame = 0; frame < 2; frame++)
+        {
+            meshes = DrawEnemies(config, camera);
+            camera.enabled = true;
+            yield return null;
+        }
+
+        spray.Destroy();
+        camera.targetTexture = null;
+        Destroy(target);
+        Destroy(root);
+
+        GameplayWarm = true;
+        GameLog.Info(LogCategory.Rendering, $"[GameWarmup] Gameplay frame drawn off-screen ({meshes} enemy mesh(es)) in {(Time.realtimeSinceStartup - start) * 1000f:F0}ms");
+    }
+
+    private static Camera CreateCamera(Transform parent, RenderTexture target)
+    {
+        GameObject obj = new GameObject("GameWarmupCamera");
+        obj.transform.SetParent(parent);
+        obj.transform.position = WarmupOrigin + new Vector3(0f, 0f, -10f);
+
+        Camera camera = obj.AddComponent<Camera>();
+        camera.enabled = false;
+        camera.orthographic = true;
+        camera.orthographicSize = 3f;
+        camera.clearFlags = CameraClearFlags.SolidColor;
+        camera.backgroundColor = Color.clear;
+        camera.targetTexture = target;
+        camera.depth = -100f;
+        return camera;
+    }
+
+    private static int DrawEnemies(WaveConfig config, Camera camera)
+    {
+        if (config == null || config.enemyPrefabs == null) return 0;
+
+        int drawn = 0;
+        foreach (GameObject prefab in config.enemyPrefabs)
+            drawn += EnemyRenderManager.WarmUp(prefab, camera, WarmupOrigin);
+        return drawn;
+    }
+
+    void OnDestroy()
+    {
+        if (instance == this) instance = null;
+    }
+}
@@ -1,11 +1,12 @@
 using UnityEngine;
 using UnityEngine.UI;
+using UnityEngine.SceneManagement;
 using System.Collections.Generic;
-using System.Reflection;
 
 /// <summary>
 /// Fixes MissingReferenceException in GraphicRaycaster by cleaning up destroyed Graphics from Unity's registry.
 /// Attach this to a GameObject that persists (like a manager object) or the Canvas.
+/// Canvases are found through TrackedCanvas, attached once per scene load.
 /// </summary>
 public class GraphicRegistryCleaner : MonoBehaviour
 {
@@ -14,6 +15,7 @@ public class GraphicRegistryCleaner : MonoBehaviour
     
     private float lastCleanupTime;
     private static GraphicRegistryCleaner instance;
+    private static readonly List<Graphic> graphicBuffer = new List<Graphic>(64);
 
     void Awake()
     {
@@ -24,6 +26,14 @@ public class GraphicRegistryCleaner : MonoBehaviour
             return;
         }
         instance = this;
+        
+        TrackedCanvas.AttachAll();
+        SceneManager.sceneLoaded += OnSceneLoaded;
+    }
+
+    private static void OnSceneLoaded(Scene scene, LoadSceneMode mode)
+    {
+        TrackedCanvas.AttachAll();
     }
 
     void Update()
@@ -39,119 +49,65 @@ public class GraphicRegistryCleaner : MonoBehaviour
     /// <summary>
     /// Removes destroyed Graphics from all Canvas graphic lists.
     /// This prevents MissingReferenceException in GraphicRaycaster.Raycast.
+    /// Walks TrackedCanvas.Active, so a cleanup allocates nothing.
     /// </summary>
     public static void CleanupDestroyedGraphics()
     {
-        // Find all canvases
-        Canvas[] canvases = FindObjectsByType<Canvas>(FindObjectsInactive.Include, FindObjectsSortMode.None);
-        
-        foreach (Canvas canvas in canvases)
+        var canvases = TrackedCanvas.Active;
+        for (int i = 0; i < canvases.Count; i++)
         {
-            if (canvas == null) continue;
-            
-            // Get all graphics registered to this canvas using reflection
-            // GraphicRegistry is internal, so we need to access it via GraphicRaycaster
-            GraphicRaycaster raycaster = canvas.GetComponent<GraphicRaycaster>();
-            if (raycaster == null) continue;
+            TrackedCanvas tracked = canvases[i];
             
             // Force the raycaster to rebuild by toggling it
             // This clears destroyed references
-            if (raycaster.enabled)
+            GraphicRaycaster raycaster = tracked.Raycaster;
+            if (raycaster != null && raycaster.enabled)
             {
                 raycaster.enabled = false;
                 raycaster.enabled = true;
             }
+            
+            // Also clean up the canvas's entries in the Graphic registry
+            CleanupGraphicRegistry(tracked.Canvas);
         }
-        
-        // Also clean up via the Graphic registry directly
-        CleanupGraphicRegistry();
     }
 
     /// <summary>
-    /// Uses reflection to clean up Unity's internal GraphicRegistry.
+    /// If Unity's GraphicRegistry still lists a destroyed Graphic for this canvas, re-register
+    /// the canvas's graphics.
     /// </summary>
-    private static void CleanupGraphicRegistry()
+    private static void CleanupGraphicRegistry(Canvas canvas)
     {
-        try
+        if (canvas == null) return;
+        
+        if (!HasDestroyedGraphic(GraphicRegistry.GetGraphicsForCanvas(canvas))
+            && !HasDestroyedGraphic(GraphicRegistry.GetRaycastableGraphicsForCanvas(canvas)))
         {
-            // Get the GraphicRegistry type
-            System.Type registryType = typeof(Graphic).Assembly.GetType("UnityEngine.UI.GraphicRegistry");
-            if (registryType == null) return;
-
-            // Get the instance
-            PropertyInfo instanceProp = registryType.GetProperty("instance", BindingFlags.Static | BindingFlags.NonPublic | BindingFlags.Public);
-            if (instanceProp == null) return;
-            
-            object registryInstance = instanceProp.GetValue(null);
-            if (registryInstance == null) return;
-
-            // Get the m_Graphics dictionary field
-            FieldInfo graphicsField = registryType.GetField("m_Graphics", BindingFlags.Instance | BindingFlags.NonPublic);
-            if (graphicsField == null) return;
-
-            // The dictionary is Dictionary<Canvas, IndexedSet<Graphic>>
-            object graphicsDict = graphicsField.GetValue(registryInstance);
-            if (graphicsDict == null) return;
-
-            // Get the dictionary as IDictionary to iterate
-            var dict = graphicsDict as System.Collections.IDictionary;
-            if (dict == null) return;
-
-            // Collect canvases with null graphics to clean
-            List<Canvas> canvasesToClean = new List<Canvas>();
-            
-            foreach (System.Collections.DictionaryEntry entry in dict)
-            {
-                Canvas canvas = entry.Key as Canvas;
-                if (canvas == null)
-                {
-                    continue; // Canvas itself is destroyed
-                }
-                
-                // Check if any graphics in this canvas's list are destroyed
-                var indexedSet = entry.Value;
-                if (indexedSet == null) continue;
-
-                // Get the list inside IndexedSet
-                FieldInfo listField = indexedSet.GetType().GetField("m_List", BindingFlags.Instance | BindingFlags.NonPublic);
-                if (listField == null) continue;
-
-                var list = listField.GetValue(indexedSet) as System.Collections.IList;
-                if (list == null) continue;
-
-                foreach (var item in list)
-                {
-                    Graphic graphic = item as Graphic;
-                    // Check if graphic is destroyed (Unity overloads == for null check on destroyed objects)
-                    if (graphic == null)
-                    {
-                        canvasesToClean.Add(canvas);
-                        break;
-                    }
-                }
-            }
-
-            // For each canvas with destroyed graphics, force re-registration
-            foreach (Canvas canvas in canvasesToClean)
+            return;
+        }
+        
+        // Disable and re-enable all graphics on this canvas to force re-registration
+        canvas.GetComponentsInChildren(true, graphicBuffer);
+        foreach (Graphic g in graphicBuffer)
+        {
+            if (g != null && g.enabled)
             {
-                if (canvas == null) continue;
-                
-                // Disable and re-enable all graphics on this canvas to force re-registration
-                Graphic[] graphics = canvas.GetComponentsInChildren<Graphic>(true);
-                foreach (Graphic g in graphics)
-                {
-                    if (g != null && g.enabled)
-                    {
-                        g.enabled = false;
-                        g.enabled = true;
-                    }
-                }
+                g.enabled = false;
+                g.enabled = true;
             }
         }
-        catch (System.Exception e)
+        graphicBuffer.Clear();
+    }
+
+    private static bool HasDestroyedGraphic(IList<Graphic> graphics)
+    {
+        // Index loop: IList enumeration would box an enumerator
+        for (int i = 0; i < graphics.Count; i++)
         {
-            Debug.LogWarning($"[GraphicRegistryCleaner] Reflection cleanup failed: {e.Message}");
+            // Unity overloads == so destroyed graphics compare equal to null
+            if (graphics[i] == null) return true;
         }
+        return false;
     }
 
     void OnDestroy()
@@ -159,6 +115,7 @@ public class GraphicRegistryCleaner : MonoBehaviour
         if (instance == this)
         {
             instance = null;
+            SceneManager.sceneLoaded -= OnSceneLoaded;
         }
     }
 }
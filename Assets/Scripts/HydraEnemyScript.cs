@@ -3,6 +3,8 @@ using UnityEngine;
 /// <summary>
 /// Hydra enemy that splits into smaller copies when killed.
 /// Each generation is smaller and weaker until minimum generation is reached.
+/// Pooled hydras hand their splits to HydraSplitScheduler, which spreads them over frames and
+/// caps the number of live descendants.
 /// </summary>
 [RequireComponent(typeof(Rigidbody2D))]
 [RequireComponent(typeof(Collider2D))]
@@ -43,14 +45,25 @@ public class HydraEnemyScript : EnemyBase
     [Header("Melee Audio")]
     [SerializeField] private ProceduralEnemyMeleeAudio meleeAudio;
     
-    private static bool isQuitting = false;
     private bool hasSpawnedChildren = false;
     private GameStates gameStates;
 
+    /// <summary>
+    /// Slot in HydraSplitScheduler while alive as a descendant (-1 otherwise)
+    /// </summary>
+    public int DescendantIndex { get; set; } = -1;
+
+    // Prefab defaults restored when a pooled hydra is reused
+    private int spawnGeneration;
+    private float spawnMeleeRange;
+
     protected override void Awake()
     {
         base.Awake();
         
+        spawnGeneration = currentGeneration;
+        spawnMeleeRange = meleeRange;
+        
         if (meleeAudio == null)
             meleeAudio = GetComponent<ProceduralEnemyMeleeAudio>();
         
@@ -68,33 +81,11 @@ public class HydraEnemyScript : EnemyBase
         }
     }
 
-    protected override void FixedUpdate()
-    {
-        if (player == null) return;
-        
-        if (isKnockedBack)
-        {
-            base.FixedUpdate();
-            return;
-        }
-
-        Vector2 dir = (Vector2)player.position - rb.position;
-        float distToPlayer = dir.magnitude;
-        
-        if (distToPlayer < 0.0001f) return;
-
-        dir.Normalize();
-        Vector2 targetVel = dir * Speed;
-        rb.linearVelocity = Vector2.MoveTowards(rb.linearVelocity, targetVel, acceleration * Time.fixedDeltaTime);
-        
-        base.FixedUpdate();
-    }
-
-    public override void Update()
+    public override void SimulationUpdate(float deltaTime)
     {
-        base.Update();
+        base.SimulationUpdate(deltaTime);
         
-        UpdateAttackAnimation();
+        UpdateAttackAnimation(deltaTime);
         
         if (player != null && !isAttacking)
         {
@@ -106,10 +97,59 @@ public class HydraEnemyScript : EnemyBase
         }
     }
     
+    public override void ResetForSpawn()
+    {
+        base.ResetForSpawn();
+        
+        currentGeneration = spawnGeneration;
+        meleeRange = spawnMeleeRange;
+        hasSpawnedChildren = false;
+        nextMeleeAttackTime = 0f;
+        CancelAttackAnimation();
+    }
+    
+    public override void OnDespawned()
+    {
+        CancelAttackAnimation();
+        base.OnDespawned();
+    }
+
+    protected override void OnDisable()
+    {
+        HydraSplitScheduler.Unregister(this);
+        base.OnDisable();
+    }
+
+    /// <summary>
+    /// Pool instances for a number of spawns of this prefab: the hydras plus every generation
+    /// they can split into, limited by the live descendant cap
+    /// </summary>
+    public override int PrewarmCount(int spawns)
+    {
+        int perHydra = 0;
+        int generationSize = 1;
+        for (int g = currentGeneration; g < maxGenerations; g++)
+        {
+            generationSize *= splitCount;
+            perHydra += generationSize;
+        }
+        return spawns + Mathf.Min(spawns * perHydra, HydraSplitScheduler.MaxLiveDescendants);
+    }
+
+    /// <summary>
+    /// Take over a split that was merged away at the descendant cap
+    /// </summary>
+    public void AbsorbSplit(float health, int score)
+    {
+        MaxHealth += health;
+        Health += health;
+        ScoreValue += score;
+    }
+    
     /// <summary>
     /// Initialize this hydra as a child of another hydra
     /// </summary>
-    public void InitAsChild(int generation, float parentHealth, float parentDamage, float parentSpeed, Vector3 parentScale)
+    public void InitAsChild(int generation, float parentHealth, float parentDamage, float parentSpeed, Vector3 parentScale, int parentScoreValue)
     {
         currentGeneration = generation;
         
@@ -128,16 +168,14 @@ public class HydraEnemyScript : EnemyBase
         transform.localScale = parentScale * childScaleMultiplier;
         
         // Reduce score value for smaller enemies
-        ScoreValue = Mathf.Max(10, ScoreValue / 2);
+        ScoreValue = Mathf.Max(10, parentScoreValue / 2);
         
-        // Update melee range based on scale
-        meleeRange *= childScaleMultiplier;
+        // Update melee range based on scale (pooled children start from the prefab range)
+        meleeRange = spawnMeleeRange * scaleMult;
     }
 
-    void OnDestroy()
+    protected override void OnDied()
     {
-        if (isQuitting) return;
-        if (!gameObject.scene.isLoaded) return;
         if (hasSpawnedChildren) return;
         
         // Spawn children if we haven't reached max generations
@@ -147,15 +185,17 @@ public class HydraEnemyScript : EnemyBase
         }
     }
     
-    void OnApplicationQuit()
-    {
-        isQuitting = true;
-    }
-    
     private void SpawnChildren()
     {
         hasSpawnedChildren = true;
+
+        if (PoolPrefab != null)
+        {
+            QueueChildren();
+            return;
+        }
         
+        // Not pooled (placed in a scene): clone ourselves right away, the pool can't supply copies
         for (int i = 0; i < splitCount; i++)
         {
             // Calculate spawn position in a circle around death position
@@ -166,8 +206,6 @@ public class HydraEnemyScript : EnemyBase
             ) * splitSpawnRadius;
             
             Vector3 spawnPos = transform.position + (Vector3)offset;
-            
-            // Instantiate a copy of this prefab
             GameObject child = Instantiate(gameObject, spawnPos, Quaternion.identity);
             
             // Get the hydra component and initialize it as a child
@@ -180,7 +218,8 @@ public class HydraEnemyScript : EnemyBase
                     MaxHealth,
                     Damage,
                     Speed,
-                    transform.localScale
+                    transform.localScale,
+                    ScoreValue
                 );
             }
             
@@ -193,6 +232,50 @@ public class HydraEnemyScript : EnemyBase
         }
     }
 
+    private void QueueChildren()
+    {
+        float childHealth = MaxHealth * childHealthMultiplier;
+        int childScore = Mathf.Max(10, ScoreValue / 2);
+
+        for (int i = 0; i < splitCount; i++)
+        {
+            // Spawn positions in a circle around the death position
+            float angle = (360f / splitCount) * i + Random.Range(-15f, 15f);
+            Vector2 direction = new Vector2(Mathf.Cos(angle * Mathf.Deg2Rad), Mathf.Sin(angle * Mathf.Deg2Rad));
+
+            HydraSplitScheduler.Enqueue(new HydraSplitScheduler.SplitRequest
+            {
+                prefab = PoolPrefab,
+                position = transform.position + (Vector3)(direction * splitSpawnRadius),
+                direction = direction,
+                generation = currentGeneration + 1,
+                parentHealth = MaxHealth,
+                parentDamage = Damage,
+                parentSpeed = Speed,
+                parentScale = transform.localScale,
+                parentScoreValue = ScoreValue
+            }, childHealth, childScore);
+        }
+    }
+
+    /// <summary>
+    /// Snap the visual back to rest if an attack is in progress
+    /// </summary>
+    private void CancelAttackAnimation()
+    {
+        if (isAttacking)
+        {
+            visualTransform.localPosition = attackStartPos;
+        }
+        
+        isAttacking = false;
+        attackPhase = 0;
+        attackTimer = 0f;
+        visualTransform.localScale = baseLocalScale;
+        if (spriteRenderer != null)
+            spriteRenderer.color = originalColor;
+    }
+    
     private void StartAttackAnimation()
     {
         if (player == null) return;
@@ -206,11 +289,11 @@ public class HydraEnemyScript : EnemyBase
         attackTargetPos = attackStartPos + (Vector3)(toPlayer * attackLungeDistance);
     }
     
-    private void UpdateAttackAnimation()
+    private void UpdateAttackAnimation(float deltaTime)
     {
         if (!isAttacking) return;
         
-        attackTimer += Time.deltaTime;
+        attackTimer += deltaTime;
         
         switch (attackPhase)
         {
@@ -288,7 +371,7 @@ public class HydraEnemyScript : EnemyBase
     {
         if (player == null) return;
         
-        var playerController = player.GetComponent<PlayerController>();
+        PlayerController playerController = GetPlayerController();
         if (playerController != null)
         {
             Vector2 knockbackDir = ((Vector2)player.position - (Vector2)transform.position).normalized;
@@ -305,9 +388,9 @@ public class HydraEnemyScript : EnemyBase
         }
     }
 
-    void OnTriggerEnter2D(Collider2D other)
+    public override void OnPlayerContact()
     {
-        if (other.CompareTag("Player") && Time.time >= nextMeleeAttackTime && !isAttacking)
+        if (Time.time >= nextMeleeAttackTime && !isAttacking)
         {
             StartAttackAnimation();
         }
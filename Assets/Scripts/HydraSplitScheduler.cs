@@ -0,0 +1,191 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+/// <summary>
+/// Spawns hydra children for HydraEnemyScript. Splits are queued on death and released a few per
+/// frame from the enemy pool (prewarmed per generation by EnemySpawner), so a chain of deaths
+/// never clones a burst of hierarchies in one frame.
+/// Live plus queued descendants are capped; a split past the cap isn't spawned but merges its
+/// health and score into the newest queued split (or else the nearest live descendant), which
+/// comes out tougher instead.
+/// </summary>
+public class HydraSplitScheduler : MonoBehaviour
+{
+    /// <summary>
+    /// Cap on live + queued hydra descendants (generation 1 and up)
+    /// </summary>
+    public const int MaxLiveDescendants = 64;
+
+    [SerializeField] private int maxSplitsPerFrame = 4;
+
+    private static HydraSplitScheduler instance;
+
+    public struct SplitRequest
+    {
+        public GameObject prefab;
+        public Vector3 position;
+        public Vector2 direction;
+        public int generation;
+        public float parentHealth;
+        public float parentDamage;
+        public float parentSpeed;
+        public Vector3 parentScale;
+        public int parentScoreValue;
+
+        // Folded in from splits past the cap
+        public float bonusHealth;
+        public int bonusScore;
+    }
+
+    // Queued splits, oldest at queueHead
+    private readonly List<SplitRequest> queue = new List<SplitRequest>(MaxLiveDescendants);
+    private int queueHead;
+
+    // Live descendants (indexed by HydraEnemyScript.DescendantIndex)
+    private readonly List<HydraEnemyScript> descendants = new List<HydraEnemyScript>(MaxLiveDescendants);
+
+    /// <summary>
+    /// Hydra descendants alive or waiting to spawn
+    /// </summary>
+    public static int DescendantCount => instance != null ? instance.descendants.Count + instance.QueuedCount : 0;
+
+    private int QueuedCount => queue.Count - queueHead;
+
+    private static HydraSplitScheduler GetOrCreate()
+    {
+        if (instance == null && Application.isPlaying)
+        {
+            GameObject obj = new GameObject("HydraSplitScheduler");
+            instance = obj.AddComponent<HydraSplitScheduler>();
+        }
+        return instance;
+    }
+
+    /// <summary>
+    /// Queue a child split, or merge it into an existing descendant when the cap is reached.
+    /// childHealth is the health the child would have had.
+    /// </summary>
+    public static void Enqueue(SplitRequest request, float childHealth, int childScore)
+    {
+        HydraSplitScheduler scheduler = GetOrCreate();
+        if (scheduler == null || request.prefab == null) return;
+
+        if (DescendantCount < MaxLiveDescendants)
+        {
+            scheduler.queue.Add(request);
+            return;
+        }
+
+        scheduler.Merge(request.position, childHealth, childScore);
+    }
+
+    public static void Register(HydraEnemyScript hydra)
+    {
+        HydraSplitScheduler scheduler = GetOrCreate();
+        if (scheduler == null || hydra == null || hydra.DescendantIndex >= 0) return;
+
+        hydra.DescendantIndex = scheduler.descendants.Count;
+        scheduler.descendants.Add(hydra);
+    }
+
+    public static void Unregister(HydraEnemyScript hydra)
+    {
+        // Never create a scheduler here - this runs during scene teardown
+        HydraSplitScheduler scheduler = instance;
+        if (scheduler == null || hydra == null) return;
+
+        int index = hydra.DescendantIndex;
+        if (index < 0 || index >= scheduler.descendants.Count || scheduler.descendants[index] != hydra) return;
+
+        int last = scheduler.descendants.Count - 1;
+        HydraEnemyScript moved = scheduler.descendants[last];
+        scheduler.descendants[index] = moved;
+        moved.DescendantIndex = index;
+        scheduler.descendants.RemoveAt(last);
+
+        hydra.DescendantIndex = -1;
+    }
+
+    void Awake()
+    {
+        if (instance != null && instance != this)
+        {
+            Destroy(this);
+            return;
+        }
+        instance = this;
+    }
+
+    void OnDestroy()
+    {
+        if (instance != this) return;
+        instance = null;
+
+        foreach (HydraEnemyScript hydra in descendants)
+        {
+            if (hydra != null) hydra.DescendantIndex = -1;
+        }
+    }
+
+    void Update()
+    {
+        for (int i = 0; i < maxSplitsPerFrame && QueuedCount > 0; i++)
+            Spawn(queue[queueHead++]);
+
+        if (queueHead == queue.Count)
+        {
+            queue.Clear();
+            queueHead = 0;
+        }
+    }
+
+    private void Spawn(in SplitRequest request)
+    {
+        EnemyBase pooled = EnemyPool.Spawn(request.prefab, request.position, Quaternion.identity);
+        if (pooled == null) return;
+
+        if (pooled is HydraEnemyScript child)
+        {
+            child.InitAsChild(request.generation, request.parentHealth, request.parentDamage,
+                request.parentSpeed, request.parentScale, request.parentScoreValue);
+            if (request.bonusHealth > 0f || request.bonusScore > 0)
+                child.AbsorbSplit(request.bonusHealth, request.bonusScore);
+            Register(child);
+        }
+
+        // Give child a small impulse away from the split point
+        if (pooled.rb != null)
+            pooled.rb.linearVelocity = request.direction * 3f;
+    }
+
+    private void Merge(Vector3 position, float health, int score)
+    {
+        // Prefer a child that hasn't spawned yet: the newest queued request is the cheapest to toughen
+        if (QueuedCount > 0)
+        {
+            int last = queue.Count - 1;
+            SplitRequest request = queue[last];
+            request.bonusHealth += health;
+            request.bonusScore += score;
+            queue[last] = request;
+            return;
+        }
+
+        HydraEnemyScript nearest = null;
+        float bestSqr = float.MaxValue;
+        foreach (HydraEnemyScript hydra in descendants)
+        {
+            if (hydra == null || hydra.IsDead) continue;
+
+            float sqr = ((Vector2)(hydra.transform.position - position)).sqrMagnitude;
+            if (sqr < bestSqr)
+            {
+                bestSqr = sqr;
+                nearest = hydra;
+            }
+        }
+
+        if (nearest != null)
+            nearest.AbsorbSplit(health, score);
+    }
+}
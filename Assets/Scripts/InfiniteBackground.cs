@@ -1,17 +1,61 @@
 using UnityEngine;
 
 /// <summary>
-/// Creates an infinite tiling background that follows the player using a 3x3 grid.
-/// Attach to the existing background GameObject with a SpriteRenderer.
+/// Creates an infinite tiling background. Attach to the existing background GameObject with a
+/// SpriteRenderer.
+/// ScrollingQuad (default) draws one quad with the ScrollingBackground shader, which fits it to the
+/// camera view on the ground plane and repeats the sprite in world space: one draw, no overlapping
+/// tiles and no per-frame transform work. A noise variation and an optional parallax layer hide
+/// the tiling; the quad is lit in the forward pass like the rest of the scene. TileGrid keeps the original 3x3 grid of sprite clones that follows the player, and
+/// is used as the fallback when the shader is unsupported or the sprite is packed in an atlas.
+/// With a streamed sprite name set, the SpriteRenderer is left empty in the scene and the sprite
+/// comes from a ContentBundles bundle; the ground is built once it arrives.
 /// </summary>
 public class InfiniteBackground : MonoBehaviour
 {
+    public enum BackgroundMode
+    {
+        ScrollingQuad,
+        TileGrid
+    }
+
+    public const string ShaderPath = "Shaders/ScrollingBackground";
+
     [SerializeField] private Transform _target;
-    
+    [SerializeField] private BackgroundMode _mode = BackgroundMode.ScrollingQuad;
+    [Tooltip("Load the sprite from this ContentBundles bundle instead of the SpriteRenderer")]
+    [SerializeField] private string _streamedBundle = ContentBundles.GameplayArt;
+    [SerializeField] private string _streamedSprite;
+
+    [Header("Scrolling Quad")]
+    [Tooltip("Brightness variation from world-space noise; 0 disables it")]
+    [SerializeField, Range(0f, 0.5f)] private float _noiseStrength = 0.08f;
+    [Tooltip("Noise feature size in world units - keep it unrelated to the tile size")]
+    [SerializeField] private float _noiseScale = 23f;
+    [Tooltip("Optional texture drawn over the ground, scrolling at a different rate")]
+    [SerializeField] private Texture2D _parallaxTexture;
+    [SerializeField] private float _parallaxTileSize = 20f;
+    [Tooltip("0 = fixed to the ground, 1 = fixed to the camera")]
+    [SerializeField, Range(0f, 1f)] private float _parallaxFactor = 0.3f;
+    [SerializeField, Range(0f, 1f)] private float _parallaxStrength = 0.5f;
+
+    private static readonly int MainTexId = Shader.PropertyToID("_MainTex");
+    private static readonly int ColorId = Shader.PropertyToID("_Color");
+    private static readonly int SpriteRectId = Shader.PropertyToID("_SpriteRect");
+    private static readonly int TileParamsId = Shader.PropertyToID("_TileParams");
+    private static readonly int NoiseParamsId = Shader.PropertyToID("_NoiseParams");
+    private static readonly int DetailTexId = Shader.PropertyToID("_DetailTex");
+    private static readonly int DetailParamsId = Shader.PropertyToID("_DetailParams");
+
     private SpriteRenderer _spriteRenderer;
     private SpriteRenderer[] _tiles;
     private Vector2 _tileSize;
     private const int GridSize = 3;
+
+    // ScrollingQuad
+    private GameObject _quad;
+    private Mesh _quadMesh;
+    private Material _quadMaterial;
     
     private void Awake()
     {
@@ -24,20 +68,91 @@ public class InfiniteBackground : MonoBehaviour
                 _target = player.transform;
         }
         
-        if (_spriteRenderer != null && _spriteRenderer.sprite != null)
-        {
-            CreateTileGrid();
-        }
+        if (_spriteRenderer == null) return;
+
+        if (_spriteRenderer.sprite == null && !string.IsNullOrEmpty(_streamedSprite))
+            ContentBundles.Load<Sprite>(_streamedBundle, _streamedSprite, OnSpriteLoaded);
+        else
+            CreateBackground();
     }
-    
-    private void CreateTileGrid()
+
+    private void OnSpriteLoaded(Sprite sprite)
+    {
+        // The scene may have been left while the bundle was downloading
+        if (this == null || sprite == null) return;
+
+        _spriteRenderer.sprite = sprite;
+        CreateBackground();
+    }
+
+    private void CreateBackground()
     {
         var sprite = _spriteRenderer.sprite;
+        if (sprite == null) return;
+
         _tileSize = new Vector2(
             sprite.bounds.size.x * transform.localScale.x,
             sprite.bounds.size.y * transform.localScale.y
         );
-        
+
+        if (_mode != BackgroundMode.ScrollingQuad || !CreateScrollingQuad())
+            CreateTileGrid();
+    }
+
+    /// <summary>
+    /// Replace the sprite with one camera-fitted quad. Returns false when this platform or sprite
+    /// can't use the shader.
+    /// </summary>
+    private bool CreateScrollingQuad()
+    {
+        var sprite = _spriteRenderer.sprite;
+        Shader shader = Resources.Load<Shader>(ShaderPath);
+        if (shader == null || !shader.isSupported || sprite.packed) return false;
+
+        // Corners in NDC; the vertex shader moves them onto the ground plane
+        _quadMesh = new Mesh { name = "ScrollingBackgroundQuad" };
+        _quadMesh.vertices = new[]
+        {
+            new Vector3(-1f, -1f, 0f), new Vector3(1f, -1f, 0f),
+            new Vector3(-1f, 1f, 0f), new Vector3(1f, 1f, 0f)
+        };
+        _quadMesh.triangles = new[] { 0, 2, 1, 1, 2, 3 };
+        _quadMesh.bounds = new Bounds(Vector3.zero, Vector3.one * 100000f);   // Always in view
+
+        Texture2D texture = sprite.texture;
+        Rect rect = sprite.textureRect;
+        _quadMaterial = new Material(shader) { name = "ScrollingBackground (Instance)" };
+        _quadMaterial.SetTexture(MainTexId, texture);
+        _quadMaterial.SetColor(ColorId, _spriteRenderer.color);
+        _quadMaterial.SetVector(SpriteRectId, new Vector4(
+            rect.x / texture.width, rect.y / texture.height, rect.width / texture.width, rect.height / texture.height));
+        _quadMaterial.SetVector(TileParamsId, new Vector4(_tileSize.x, _tileSize.y, transform.position.x, transform.position.y));
+        _quadMaterial.SetVector(NoiseParamsId, new Vector4(Mathf.Max(0.01f, _noiseScale), _noiseStrength, 0f, 0f));
+        if (_parallaxTexture != null)
+        {
+            _quadMaterial.SetTexture(DetailTexId, _parallaxTexture);
+            _quadMaterial.SetVector(DetailParamsId, new Vector4(Mathf.Max(0.01f, _parallaxTileSize), _parallaxFactor, _parallaxStrength, 0f));
+        }
+
+        _quad = new GameObject("BackgroundQuad");
+        _quad.transform.SetParent(transform.parent);
+        _quad.transform.position = transform.position;   // World z is the ground plane
+        _quad.AddComponent<MeshFilter>().sharedMesh = _quadMesh;
+
+        var quadRenderer = _quad.AddComponent<MeshRenderer>();
+        quadRenderer.sharedMaterial = _quadMaterial;
+        quadRenderer.shadowCastingMode = UnityEngine.Rendering.ShadowCastingMode.Off;
+        quadRenderer.receiveShadows = false;
+        quadRenderer.sortingLayerID = _spriteRenderer.sortingLayerID;
+        quadRenderer.sortingOrder = _spriteRenderer.sortingOrder;
+
+        _spriteRenderer.enabled = false;
+        enabled = false;   // Nothing to do per frame
+        return true;
+    }
+    
+    private void CreateTileGrid()
+    {
         _tiles = new SpriteRenderer[GridSize * GridSize];
         
         // Create 3x3 grid of tiles
@@ -101,6 +216,10 @@ public class InfiniteBackground : MonoBehaviour
     
     private void OnDestroy()
     {
+        if (_quad != null) Destroy(_quad);
+        if (_quadMesh != null) Destroy(_quadMesh);
+        if (_quadMaterial != null) Destroy(_quadMaterial);
+
         // Clean up created tiles (skip center which is original)
         if (_tiles == null) return;
         
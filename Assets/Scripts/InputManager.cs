@@ -45,6 +45,9 @@ public class InputManager : Singleton<InputManager>
 
     private TouchAction touchAction;
 
+    // Found once (it starts inactive in scene); InputSampler reads it through VirtualController.Instance
+    private VirtualController virtualController;
+
     private void Awake() {
         touchAction = new TouchAction();
         mainCamera = Camera.main;
@@ -139,7 +142,7 @@ public class InputManager : Singleton<InputManager>
         if (isMobile)
         {
             // Find the VirtualController (it starts inactive in scene)
-            var vc = FindObjectOfType<VirtualController>(true); // true = include inactive
+            var vc = FindVirtualController();
             if (vc != null)
             {
                 vc.gameObject.SetActive(true);
@@ -178,16 +181,23 @@ public class InputManager : Singleton<InputManager>
             
             if (shouldActivate)
             {
-                var vc = FindObjectOfType<VirtualController>(true);
+                var vc = FindVirtualController();
                 if (vc != null && !vc.gameObject.activeInHierarchy)
                 {
                     vc.gameObject.SetActive(true);
-                    Debug.Log($"[InputManager] VirtualController re-activated in Update frame {10 - mobileCheckFrames}");
+                    GameLog.Info(LogCategory.Input, $"[InputManager] VirtualController re-activated in Update frame {10 - mobileCheckFrames}");
                 }
             }
         }
     }
 
+    private VirtualController FindVirtualController()
+    {
+        if (virtualController == null)
+            virtualController = FindFirstObjectByType<VirtualController>(FindObjectsInactive.Include);
+        return virtualController;
+    }
+
     private void StartTouchPrimary(InputAction.CallbackContext context) {
         if (OnStartTouch != null) OnStartTouch(Utils.ScreenToWorld(mainCamera, touchAction.Touch.PrimaryPosition.ReadValue<Vector2>()), (float)context.startTime);
     }
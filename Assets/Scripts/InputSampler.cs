@@ -0,0 +1,204 @@
+using UnityEngine;
+using UnityEngine.InputSystem;
+using UnityEngine.LowLevel;
+
+/// <summary>
+/// One frame of input, sampled once by InputSampler before FixedUpdate
+/// </summary>
+public struct InputSnapshot
+{
+    public int frame;
+    public double time;         // Time.realtimeSinceStartupAsDouble when sampled
+
+    // Player movement: keyboard, else the virtual joystick (magnitude 0-1)
+    public Vector2 move;
+    public double moveTime;     // Timestamp of the input event that last changed move
+
+    // Virtual joystick on its own (VirtualControllerMenuNavigation)
+    public Vector2 joystick;
+
+    // Menus: digital direction (-1/0/1 per axis) from keyboard, overridden by gamepad d-pad or stick
+    public Vector2 navigate;
+    public bool submit;         // Return / Space / gamepad South pressed this frame
+    public bool back;           // Gamepad East pressed this frame
+}
+
+/// <summary>
+/// The single input sampling stage. A PlayerLoop system at the end of EarlyUpdate - before
+/// FixedUpdate - condenses keyboard, gamepad and the virtual joystick into one InputSnapshot, so
+/// PlayerController.FixedUpdate and the menu navigators read the same timestamped values instead of
+/// each polling devices. VirtualController processes its touches here rather than in Update.
+/// Under FrameRateOptimizer's latency mode the Input System is pumped here as well (manual update
+/// mode): a touch that arrives before the frame starts then moves the player in that frame's physics
+/// step instead of the next frame's.
+/// Input-to-motion latency (event timestamp to the FixedUpdate that applied it) is tracked for
+/// PerformanceHud.
+/// </summary>
+public static class InputSampler
+{
+    private const float LatencySmoothing = 0.1f;
+
+    // Changes older than this are a timeline mismatch or a stall, not input latency
+    private const float MaxLatencyMs = 1000f;
+
+    // PlayerLoop system type for the sampling stage
+    private struct SampleStage { }
+
+    private static InputSnapshot current;
+    private static bool manualUpdates;
+    private static bool motionPending;
+
+    /// <summary>
+    /// This frame's input
+    /// </summary>
+    public static InputSnapshot Current => current;
+
+    /// <summary>
+    /// True when the Input System is pumped by the sampling stage (FrameRateOptimizer latency mode)
+    /// </summary>
+    public static bool ManualUpdates => manualUpdates;
+
+    /// <summary>
+    /// Input-to-motion latency of the last movement change in ms
+    /// </summary>
+    public static float LastLatencyMs { get; private set; }
+
+    /// <summary>
+    /// Smoothed input-to-motion latency in ms
+    /// </summary>
+    public static float AverageLatencyMs { get; private set; }
+
+    [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.BeforeSceneLoad)]
+    private static void Initialize()
+    {
+        Install();
+    }
+
+    /// <summary>
+    /// Add the sampling stage to the player loop. Safe to call more than once.
+    /// </summary>
+    public static void Install()
+    {
+        PlayerLoopSystem loop = PlayerLoop.GetCurrentPlayerLoop();
+        if (loop.subSystemList == null || FrameRateOptimizer.ContainsSystem(loop, typeof(SampleStage))) return;
+
+        for (int i = 0; i < loop.subSystemList.Length; i++)
+        {
+            ref PlayerLoopSystem phase = ref loop.subSystemList[i];
+            if (phase.type == typeof(UnityEngine.PlayerLoop.EarlyUpdate))
+                phase.subSystemList = FrameRateOptimizer.Insert(phase.subSystemList, false, typeof(SampleStage), Sample);
+        }
+
+        PlayerLoop.SetPlayerLoop(loop);
+    }
+
+    /// <summary>
+    /// Process Input System events from the sampling stage instead of PreUpdate, which runs after
+    /// FixedUpdate
+    /// </summary>
+    public static void UseManualUpdates()
+    {
+        Install();
+        InputSystem.settings.updateMode = InputSettings.UpdateMode.ProcessEventsManually;
+        manualUpdates = true;
+    }
+
+    /// <summary>
+    /// Called once the movement in Current has been applied to the player (PlayerController.FixedUpdate)
+    /// </summary>
+    public static void ReportMotionApplied()
+    {
+        if (!motionPending) return;
+        motionPending = false;
+
+        float ms = (float)((Time.realtimeSinceStartupAsDouble - current.moveTime) * 1000.0);
+        if (ms < 0f || ms > MaxLatencyMs) return;
+
+        LastLatencyMs = ms;
+        AverageLatencyMs = AverageLatencyMs > 0f ? Mathf.Lerp(AverageLatencyMs, ms, LatencySmoothing) : ms;
+    }
+
+    private static void Sample()
+    {
+        if (manualUpdates)
+            InputSystem.Update();
+
+        InputSnapshot next = default;
+        next.frame = Time.frameCount;
+        next.time = Time.realtimeSinceStartupAsDouble;
+
+        // Virtual joystick (mobile) - only touches of this frame's input update
+        double joystickTime = 0d;
+        VirtualController virtualController = VirtualController.Instance;
+        if (virtualController != null && virtualController.isActiveAndEnabled)
+            next.joystick = virtualController.SampleJoystick(out joystickTime);
+
+        // Keyboard movement, normalized if it exceeds the unit circle (diagonals)
+        Vector2 keyboardMove = new Vector2(Input.GetAxisRaw("Horizontal"), Input.GetAxisRaw("Vertical"));
+        if (keyboardMove.sqrMagnitude > 1f)
+            keyboardMove = keyboardMove.normalized;
+        double keyboardTime = Keyboard.current != null ? Keyboard.current.lastUpdateTime : 0d;
+
+        // Prioritize keyboard over virtual controller
+        double sourceTime;
+        if (keyboardMove.sqrMagnitude > 0.01f)
+        {
+            next.move = keyboardMove;
+            sourceTime = keyboardTime;
+        }
+        else if (next.joystick.sqrMagnitude > 0.01f)
+        {
+            next.move = next.joystick;
+            sourceTime = joystickTime;
+        }
+        else
+        {
+            sourceTime = System.Math.Max(keyboardTime, joystickTime);
+        }
+
+        if (next.move != current.move)
+        {
+            next.moveTime = sourceTime > 0d && sourceTime <= next.time ? sourceTime : next.time;
+            motionPending = true;
+        }
+        else
+        {
+            next.moveTime = current.moveTime;
+        }
+
+        SampleNavigation(ref next);
+        current = next;
+    }
+
+    private static void SampleNavigation(ref InputSnapshot next)
+    {
+        Vector2 nav = Vector2.zero;
+
+        // Keyboard
+        if (Input.GetKey(KeyCode.LeftArrow) || Input.GetKey(KeyCode.A)) nav.x = -1f;
+        else if (Input.GetKey(KeyCode.RightArrow) || Input.GetKey(KeyCode.D)) nav.x = 1f;
+        if (Input.GetKey(KeyCode.UpArrow) || Input.GetKey(KeyCode.W)) nav.y = 1f;
+        else if (Input.GetKey(KeyCode.DownArrow) || Input.GetKey(KeyCode.S)) nav.y = -1f;
+
+        next.submit = Input.GetKeyDown(KeyCode.Return) || Input.GetKeyDown(KeyCode.Space);
+
+        // Gamepad
+        Gamepad gamepad = Gamepad.current;
+        if (gamepad != null)
+        {
+            Vector2 dpad = gamepad.dpad.ReadValue();
+            Vector2 stick = gamepad.leftStick.ReadValue();
+
+            if (Mathf.Abs(dpad.x) > 0.5f) nav.x = Mathf.Sign(dpad.x);
+            else if (Mathf.Abs(stick.x) > 0.5f) nav.x = Mathf.Sign(stick.x);
+
+            if (Mathf.Abs(dpad.y) > 0.5f) nav.y = Mathf.Sign(dpad.y);
+            else if (Mathf.Abs(stick.y) > 0.5f) nav.y = Mathf.Sign(stick.y);
+
+            next.submit |= gamepad.buttonSouth.wasPressedThisFrame;
+            next.back = gamepad.buttonEast.wasPressedThisFrame;
+        }
+
+        next.navigate = nav;
+    }
+}
@@ -42,6 +42,7 @@ public class LevelUpScreen : MonoBehaviour
     // Visual components
     private Outline[] buttonOutlines = new Outline[3];
     private Vector3[] originalScales = new Vector3[3];
+    private RectTransform[] buttonRects = new RectTransform[3];
 
     void Awake()
     {
@@ -73,6 +74,7 @@ public class LevelUpScreen : MonoBehaviour
             if (choiceButtons[i] == null) continue;
             
             RectTransform rt = choiceButtons[i].GetComponent<RectTransform>();
+            buttonRects[i] = rt;
             if (rt != null)
             {
                 originalScales[i] = rt.localScale;
@@ -144,7 +146,7 @@ public class LevelUpScreen : MonoBehaviour
 
         if (levelText != null)
         {
-            levelText.text = $"LEVEL {newLevel}";
+            levelText.SetText("LEVEL {0}", newLevel);
         }
 
         // Generate 3 upgrade options - one might be a troll upgrade
@@ -169,6 +171,7 @@ public class LevelUpScreen : MonoBehaviour
         levelUpPanel.SetActive(true);
         levelUpPanel.transform.SetAsLastSibling();
         Time.timeScale = 0f;
+        SaveService.Flush();
 
         // Select first button for controller/keyboard navigation
         if (choiceButtons[0] != null)
@@ -225,7 +228,7 @@ public class LevelUpScreen : MonoBehaviour
         }
     }
 
-    private void SelectUpgrade(int index)
+    public void SelectUpgrade(int index)
     {
         if (index < 0 || index >= currentOptions.Length) return;
         if (currentOptions[index] == null) return;
@@ -251,6 +254,19 @@ public class LevelUpScreen : MonoBehaviour
 
     public bool IsShowing() => isShowing;
 
+    /// <summary>
+    /// Build the panel's layout, text meshes and glyphs once while hidden, so the first level-up
+    /// doesn't pay for them (GameWarmup). Active only for the duration of the call, never rendered.
+    /// </summary>
+    public void WarmUp()
+    {
+        if (levelUpPanel == null || isShowing || levelUpPanel.activeSelf) return;
+
+        levelUpPanel.SetActive(true);
+        Canvas.ForceUpdateCanvases();
+        levelUpPanel.SetActive(false);
+    }
+
     void Update()
     {
         if (!isShowing) return;
@@ -281,21 +297,9 @@ public class LevelUpScreen : MonoBehaviour
         // Rate limit navigation
         if (Time.unscaledTime - lastNavTime < NavRepeatDelay) return;
         
-        float horizontal = 0f;
-        
-        // Keyboard arrows
-        if (Input.GetKey(KeyCode.LeftArrow) || Input.GetKey(KeyCode.A)) horizontal = -1f;
-        else if (Input.GetKey(KeyCode.RightArrow) || Input.GetKey(KeyCode.D)) horizontal = 1f;
-        
-        // Gamepad
-        if (Gamepad.current != null)
-        {
-            Vector2 dpad = Gamepad.current.dpad.ReadValue();
-            Vector2 stick = Gamepad.current.leftStick.ReadValue();
-            
-            if (Mathf.Abs(dpad.x) > 0.5f) horizontal = Mathf.Sign(dpad.x);
-            else if (Mathf.Abs(stick.x) > 0.5f) horizontal = Mathf.Sign(stick.x);
-        }
+        // Keyboard arrows, then gamepad d-pad / stick (InputSampler)
+        InputSnapshot input = InputSampler.Current;
+        float horizontal = input.navigate.x;
         
         // Navigate
         if (Mathf.Abs(horizontal) > 0.1f)
@@ -307,11 +311,7 @@ public class LevelUpScreen : MonoBehaviour
         }
         
         // Submit with Enter/Space/Gamepad A
-        bool submit = Input.GetKeyDown(KeyCode.Return) || Input.GetKeyDown(KeyCode.Space);
-        if (Gamepad.current != null && Gamepad.current.buttonSouth.wasPressedThisFrame)
-        {
-            submit = true;
-        }
+        bool submit = input.submit;
         
         if (submit)
         {
@@ -352,8 +352,8 @@ public class LevelUpScreen : MonoBehaviour
                 buttonOutlines[i].enabled = isSelected;
             }
             
-            // Animate scale
-            RectTransform rt = choiceButtons[i].GetComponent<RectTransform>();
+            // Animate scale (rects cached in SetupSelectionVisuals)
+            RectTransform rt = i < buttonRects.Length ? buttonRects[i] : null;
             if (rt != null && i < originalScales.Length)
             {
                 float targetScale = isSelected ? selectedScale : normalScale;
@@ -51,6 +51,13 @@ public class MainMenu : MonoBehaviour
         
         PWAHelper.LogStatus();
         
+        // Stream gameplay art and music/ambience while the player is still in the menu
+        ContentBundles.Prefetch(ContentBundles.GameplayArt);
+        ContentBundles.Prefetch(ContentBundles.GameplayAudio);
+        
+        // Compile gameplay shaders a few at a time while the menu is up
+        GameWarmup.BeginShaderWarmup();
+        
         // Setup controller navigation
         SetupControllerNavigation();
     }
@@ -158,8 +165,7 @@ public class MainMenu : MonoBehaviour
     {
         ProceduralUIAudio.PlaySelect();
         Debug.Log("Play Game has been pressed - Virtual Controller HIDDEN");
-        PlayerPrefs.SetInt("ShowVirtualController", 0);
-        PlayerPrefs.Save();
+        SaveService.SetInt(SaveService.ShowVirtualControllerKey, 0);     // Written on the scene change
         SceneManager.LoadScene(SceneManager.GetActiveScene().buildIndex + 1);
     }
     
@@ -167,8 +173,7 @@ public class MainMenu : MonoBehaviour
     {
         ProceduralUIAudio.PlaySelect();
         Debug.Log("Play Game (Mobile) has been pressed - Virtual Controller SHOWN");
-        PlayerPrefs.SetInt("ShowVirtualController", 1);
-        PlayerPrefs.Save();
+        SaveService.SetInt(SaveService.ShowVirtualControllerKey, 1);
         SceneManager.LoadScene(SceneManager.GetActiveScene().buildIndex + 1);
     }
 
@@ -216,21 +221,9 @@ public class MainMenu : MonoBehaviour
         // Rate limit
         if (Time.unscaledTime - lastNavTime < NavRepeatDelay) return;
         
-        float vertical = 0f;
-        
-        // Keyboard
-        if (Input.GetKey(KeyCode.UpArrow) || Input.GetKey(KeyCode.W)) vertical = 1f;
-        else if (Input.GetKey(KeyCode.DownArrow) || Input.GetKey(KeyCode.S)) vertical = -1f;
-        
-        // Gamepad
-        if (Gamepad.current != null)
-        {
-            Vector2 dpad = Gamepad.current.dpad.ReadValue();
-            Vector2 stick = Gamepad.current.leftStick.ReadValue();
-            
-            if (Mathf.Abs(dpad.y) > 0.5f) vertical = Mathf.Sign(dpad.y);
-            else if (Mathf.Abs(stick.y) > 0.5f) vertical = Mathf.Sign(stick.y);
-        }
+        // Keyboard, then gamepad d-pad / stick (InputSampler)
+        InputSnapshot input = InputSampler.Current;
+        float vertical = input.navigate.y;
         
         // Navigate (up = previous, down = next)
         if (Mathf.Abs(vertical) > 0.1f)
@@ -245,11 +238,7 @@ public class MainMenu : MonoBehaviour
         }
         
         // Submit with Enter/Space/Gamepad A
-        bool submit = Input.GetKeyDown(KeyCode.Return) || Input.GetKeyDown(KeyCode.Space);
-        if (Gamepad.current != null && Gamepad.current.buttonSouth.wasPressedThisFrame)
-        {
-            submit = true;
-        }
+        bool submit = input.submit;
         
         if (submit && selectedIndex >= 0 && selectedIndex < menuButtons.Length)
         {
@@ -17,6 +17,8 @@ public class PauseMenu : MonoBehaviour
     public GameObject pauseButton;
     public Button resumeButton;
     public Button mainMenuButton;
+    public Button perfHudButton;
+    public Button logDumpButton;    // Optional: dumps GameLog's recent entries
     
     [Header("Stats Display")]
     public TextMeshProUGUI statsText;
@@ -26,6 +28,7 @@ public class PauseMenu : MonoBehaviour
     private EventSystem eventSystem;
     private Canvas mainCanvas;
     private PlayerStats playerStats;
+    private int statsTextVersion = -1;  // PlayerStats.Version the stats text was built from
     
     // Controller navigation
     private Button[] menuButtons;
@@ -200,6 +203,25 @@ public class PauseMenu : MonoBehaviour
                 {
                     mainMenuButton = btn;
                 }
+                if (perfHudButton == null && (name.Contains("perf") || name.Contains("profil")))
+                {
+                    perfHudButton = btn;
+                }
+            }
+        }
+        
+        // No dedicated button in the scene - clone the main menu button below itself
+        if (perfHudButton == null && mainMenuButton != null)
+        {
+            perfHudButton = Instantiate(mainMenuButton, mainMenuButton.transform.parent);
+            perfHudButton.gameObject.name = "PerfHudButton";
+            perfHudButton.transform.SetSiblingIndex(mainMenuButton.transform.GetSiblingIndex() + 1);
+            
+            RectTransform source = mainMenuButton.GetComponent<RectTransform>();
+            RectTransform clone = perfHudButton.GetComponent<RectTransform>();
+            if (source != null && clone != null && source.parent.GetComponent<LayoutGroup>() == null)
+            {
+                clone.anchoredPosition = source.anchoredPosition - new Vector2(0f, source.rect.height * 1.2f);
             }
         }
         
@@ -226,6 +248,48 @@ public class PauseMenu : MonoBehaviour
         {
             Debug.LogError("[PauseMenu] MainMenu button not found!");
         }
+        
+        // Connect Perf HUD button
+        if (perfHudButton != null)
+        {
+            perfHudButton.onClick.RemoveAllListeners();
+            perfHudButton.onClick.AddListener(TogglePerformanceHud);
+            UpdatePerfHudLabel();
+        }
+        
+        // Connect log dump button
+        if (logDumpButton != null)
+        {
+            logDumpButton.onClick.RemoveAllListeners();
+            logDumpButton.onClick.AddListener(DumpRecentLogs);
+        }
+    }
+    
+    /// <summary>
+    /// Write GameLog's recent entries to the console (and clipboard) for bug reports
+    /// </summary>
+    public void DumpRecentLogs()
+    {
+        ProceduralUIAudio.PlaySelect();
+        GameLog.DumpToConsole();
+    }
+    
+    public void TogglePerformanceHud()
+    {
+        ProceduralUIAudio.PlaySelect();
+        PerformanceHud.Toggle();
+        UpdatePerfHudLabel();
+    }
+    
+    private void UpdatePerfHudLabel()
+    {
+        if (perfHudButton == null) return;
+        
+        TextMeshProUGUI label = perfHudButton.GetComponentInChildren<TextMeshProUGUI>(true);
+        if (label != null)
+        {
+            label.text = PerformanceHud.IsVisible ? "Perf HUD: On" : "Perf HUD: Off";
+        }
     }
 
     void Update()
@@ -242,6 +306,19 @@ public class PauseMenu : MonoBehaviour
             TogglePause();
         }
         
+        // F3 toggles the performance overlay at any time
+        if (Input.GetKeyDown(KeyCode.F3))
+        {
+            PerformanceHud.Toggle();
+            UpdatePerfHudLabel();
+        }
+        
+        // F4 dumps recent logs while paused
+        if (isPaused && Input.GetKeyDown(KeyCode.F4))
+        {
+            DumpRecentLogs();
+        }
+        
         // Handle controller navigation when paused
         if (isPaused)
         {
@@ -257,21 +334,9 @@ public class PauseMenu : MonoBehaviour
         // Rate limit
         if (Time.unscaledTime - lastNavTime < NavRepeatDelay) return;
         
-        float vertical = 0f;
-        
-        // Keyboard
-        if (Input.GetKey(KeyCode.UpArrow) || Input.GetKey(KeyCode.W)) vertical = 1f;
-        else if (Input.GetKey(KeyCode.DownArrow) || Input.GetKey(KeyCode.S)) vertical = -1f;
-        
-        // Gamepad
-        if (Gamepad.current != null)
-        {
-            Vector2 dpad = Gamepad.current.dpad.ReadValue();
-            Vector2 stick = Gamepad.current.leftStick.ReadValue();
-            
-            if (Mathf.Abs(dpad.y) > 0.5f) vertical = Mathf.Sign(dpad.y);
-            else if (Mathf.Abs(stick.y) > 0.5f) vertical = Mathf.Sign(stick.y);
-        }
+        // Keyboard, then gamepad d-pad / stick (InputSampler)
+        InputSnapshot input = InputSampler.Current;
+        float vertical = input.navigate.y;
         
         // Navigate (up = previous, down = next)
         if (Mathf.Abs(vertical) > 0.1f)
@@ -286,11 +351,7 @@ public class PauseMenu : MonoBehaviour
         }
         
         // Submit with Enter/Space/Gamepad A
-        bool submit = Input.GetKeyDown(KeyCode.Return) || Input.GetKeyDown(KeyCode.Space);
-        if (Gamepad.current != null && Gamepad.current.buttonSouth.wasPressedThisFrame)
-        {
-            submit = true;
-        }
+        bool submit = input.submit;
         
         if (submit && selectedButtonIndex >= 0 && selectedButtonIndex < menuButtons.Length)
         {
@@ -302,7 +363,7 @@ public class PauseMenu : MonoBehaviour
         }
         
         // B button to resume (back)
-        if (Gamepad.current != null && Gamepad.current.buttonEast.wasPressedThisFrame)
+        if (input.back)
         {
             Resume();
         }
@@ -452,8 +513,9 @@ public class PauseMenu : MonoBehaviour
         // Pause game
         Time.timeScale = 0f;
         isPaused = true;
+        SaveService.Flush();
         
-        Debug.Log("[PauseMenu] Game PAUSED");
+        GameLog.Info(LogCategory.UI, "[PauseMenu] Game PAUSED");
     }
     
     /// <summary>
@@ -502,12 +564,12 @@ public class PauseMenu : MonoBehaviour
         Time.timeScale = 1f;
         isPaused = false;
         
-        Debug.Log("[PauseMenu] Game RESUMED");
+        GameLog.Info(LogCategory.UI, "[PauseMenu] Game RESUMED");
     }
 
     public void GoToMainMenu()
     {
-        Debug.Log("[PauseMenu] Going to MainMenuScene");
+        GameLog.Info(LogCategory.UI, "[PauseMenu] Going to MainMenuScene");
         
         // Reset time before loading
         Time.timeScale = 1f;
@@ -549,6 +611,10 @@ public class PauseMenu : MonoBehaviour
                 return;
         }
         
+        // Pausing again with nothing changed keeps the previous text
+        if (playerStats.Version == statsTextVersion) return;
+        statsTextVersion = playerStats.Version;
+        
         // Base values for comparison
         float baseMaxHealth = 100f, baseDamage = 10f, baseSpeed = 4f;
         float baseAttackSpeed = 0.6f, baseDetection = 12f;
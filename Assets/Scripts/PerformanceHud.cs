@@ -0,0 +1,418 @@
+using System.Text;
+using TMPro;
+using Unity.Profiling;
+using UnityEngine;
+using UnityEngine.UI;
+
+/// <summary>
+/// In-game performance overlay: frame time graph with p50/p99, the simulation / render-submit
+/// split from FrameRateOptimizer's frame markers, GC allocations, live entity counts and
+/// input-to-motion latency from InputSampler.
+/// Toggled from the pause menu (or F3); the choice is remembered across sessions.
+/// Creates itself programmatically and survives scene loads. While hidden it records nothing.
+/// Text and graph are rebuilt in place so the HUD itself doesn't add to the allocations it reports.
+/// </summary>
+public class PerformanceHud : MonoBehaviour
+{
+    private const int HistoryLength = 240;        // Frames in the graph and percentiles (~2-4s)
+    private const int GraphHeight = 64;
+    private const float GraphMaxMs = 50f;         // Top of the graph
+    private const float GraphRefreshInterval = 0.1f;
+    private const float TextRefreshInterval = 0.25f;
+
+    private static readonly float[] BudgetLinesMs = { 8.33f, 16.67f, 33.33f };   // 120 / 60 / 30 FPS
+
+    private static readonly Color32 BackgroundColor = new Color32(0, 0, 0, 150);
+    private static readonly Color32 GoodColor = new Color32(80, 255, 80, 255);
+    private static readonly Color32 WarnColor = new Color32(255, 210, 60, 255);
+    private static readonly Color32 BadColor = new Color32(255, 70, 70, 255);
+    private static readonly Color32 BudgetLineColor = new Color32(255, 255, 255, 70);
+
+    private static PerformanceHud instance;
+
+    // Frame time history (ring buffer) and a reused scratch copy for percentiles
+    private readonly float[] frameTimes = new float[HistoryLength];
+    private readonly float[] sortedTimes = new float[HistoryLength];
+    private int frameHead;
+    private int frameCount;
+
+    private ProfilerRecorder mainThreadRecorder;
+    private ProfilerRecorder gcAllocRecorder;
+    private ProfilerRecorder gcReservedRecorder;
+    private ProfilerRecorder batchesRecorder;
+    private ProfilerRecorder setPassRecorder;
+    private long lastTotalMemory;
+    private long fallbackAllocBytes;
+
+    private GameObject canvasObj;
+    private TextMeshProUGUI label;
+    private Texture2D graphTexture;
+    private Color32[] graphPixels;
+    private readonly StringBuilder text = new StringBuilder(512);
+    private float nextGraphRefresh;
+    private float nextTextRefresh;
+
+    /// <summary>
+    /// Whether the overlay is currently shown
+    /// </summary>
+    public static bool IsVisible => instance != null && instance.canvasObj != null && instance.canvasObj.activeSelf;
+
+    [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.AfterSceneLoad)]
+    private static void RestoreVisibility()
+    {
+        if (SaveService.GetInt(SaveService.PerfHudVisibleKey, 0) == 1)
+            SetVisible(true);
+    }
+
+    public static void Toggle()
+    {
+        SetVisible(!IsVisible);
+    }
+
+    public static void SetVisible(bool visible)
+    {
+        SaveService.SetInt(SaveService.PerfHudVisibleKey, visible ? 1 : 0);
+
+        if (!visible && instance == null) return;
+
+        PerformanceHud hud = GetOrCreate();
+        if (hud == null) return;
+
+        if (visible) hud.Show();
+        else hud.Hide();
+    }
+
+    private static PerformanceHud GetOrCreate()
+    {
+        if (instance == null && Application.isPlaying)
+        {
+            GameObject obj = new GameObject("PerformanceHud");
+            DontDestroyOnLoad(obj);
+            instance = obj.AddComponent<PerformanceHud>();
+        }
+        return instance;
+    }
+
+    void Awake()
+    {
+        if (instance != null && instance != this)
+        {
+            Destroy(gameObject);
+            return;
+        }
+        instance = this;
+        BuildOverlay();
+        canvasObj.SetActive(false);
+    }
+
+    void OnDestroy()
+    {
+        StopRecorders();
+        if (graphTexture != null) Destroy(graphTexture);
+        if (instance == this) instance = null;
+    }
+
+    private void Show()
+    {
+        if (canvasObj.activeSelf) return;
+
+        // The HUD is the only consumer of the phase split when the optimizer isn't in the scene
+        FrameRateOptimizer.InstallFrameMarkers();
+        StartRecorders();
+
+        frameHead = 0;
+        frameCount = 0;
+        lastTotalMemory = System.GC.GetTotalMemory(false);
+        nextGraphRefresh = 0f;
+        nextTextRefresh = 0f;
+        canvasObj.SetActive(true);
+    }
+
+    private void Hide()
+    {
+        if (!canvasObj.activeSelf) return;
+
+        StopRecorders();
+        canvasObj.SetActive(false);
+    }
+
+    private void StartRecorders()
+    {
+        mainThreadRecorder = ProfilerRecorder.StartNew(ProfilerCategory.Internal, "Main Thread", 1);
+        gcAllocRecorder = ProfilerRecorder.StartNew(ProfilerCategory.Memory, "GC Allocated In Frame", 1);
+        gcReservedRecorder = ProfilerRecorder.StartNew(ProfilerCategory.Memory, "GC Reserved Memory", 1);
+        batchesRecorder = ProfilerRecorder.StartNew(ProfilerCategory.Render, "Batches Count", 1);
+        setPassRecorder = ProfilerRecorder.StartNew(ProfilerCategory.Render, "SetPass Calls Count", 1);
+    }
+
+    private void StopRecorders()
+    {
+        mainThreadRecorder.Dispose();
+        gcAllocRecorder.Dispose();
+        gcReservedRecorder.Dispose();
+        batchesRecorder.Dispose();
+        setPassRecorder.Dispose();
+    }
+
+    void Update()
+    {
+        if (!canvasObj.activeSelf) return;
+
+        // Track allocations ourselves where the profiler counter isn't available (release players)
+        long totalMemory = System.GC.GetTotalMemory(false);
+        fallbackAllocBytes = System.Math.Max(0L, totalMemory - lastTotalMemory);
+        lastTotalMemory = totalMemory;
+
+        frameTimes[frameHead] = Time.unscaledDeltaTime * 1000f;
+        frameHead = (frameHead + 1) % HistoryLength;
+        if (frameCount < HistoryLength) frameCount++;
+
+        float now = Time.unscaledTime;
+        if (now >= nextGraphRefresh)
+        {
+            nextGraphRefresh = now + GraphRefreshInterval;
+            RedrawGraph();
+        }
+        if (now >= nextTextRefresh)
+        {
+            nextTextRefresh = now + TextRefreshInterval;
+            RebuildText();
+        }
+    }
+
+    // ==================== TEXT ====================
+
+    private void RebuildText()
+    {
+        System.Array.Copy(frameTimes, sortedTimes, HistoryLength);
+        System.Array.Sort(sortedTimes, 0, frameCount);
+        float p50 = Percentile(0.5f);
+        float p99 = Percentile(0.99f);
+        float last = frameTimes[(frameHead + HistoryLength - 1) % HistoryLength];
+
+        text.Length = 0;
+        text.Append("<b>FPS</b> ");
+        AppendNumber(last > 0f ? 1000f / last : 0f, 0);
+        text.Append("   <b>ms</b> ");
+        AppendNumber(last, 1);
+        text.Append("  p50 ");
+        AppendNumber(p50, 1);
+        text.Append("  p99 ");
+        AppendNumber(p99, 1);
+
+        text.Append("\n<b>CPU</b> main ");
+        AppendRecorderMs(mainThreadRecorder);
+        text.Append("  sim ");
+        AppendNumber(FrameRateOptimizer.SimulationMs, 2);
+        text.Append(" (fixed ");
+        AppendNumber(FrameRateOptimizer.FixedUpdateMs, 2);
+        text.Append(')');
+        text.Append("  render ");
+        AppendNumber(FrameRateOptimizer.RenderSubmitMs, 2);
+
+        text.Append("\n<b>GC</b> alloc ");
+        long allocBytes = gcAllocRecorder.Valid ? gcAllocRecorder.LastValue : fallbackAllocBytes;
+        AppendNumber(allocBytes / 1024f, 1);
+        text.Append(" KB/f  heap ");
+        long heapBytes = gcReservedRecorder.Valid ? gcReservedRecorder.LastValue : lastTotalMemory;
+        AppendNumber(heapBytes / (1024f * 1024f), 1);
+        text.Append(" MB  gen0 ");
+        AppendInt(System.GC.CollectionCount(0));
+
+        text.Append("\n<b>Quality</b> L");
+        AppendInt(QualityGovernor.Level);
+        text.Append("  physics ");
+        AppendNumber(1f / Time.fixedDeltaTime, 0);
+        text.Append("Hz");
+
+        text.Append("\n<b>Draw</b> batches ");
+        AppendRecorderCount(batchesRecorder);
+        text.Append("  setpass ");
+        AppendRecorderCount(setPassRecorder);
+        TextureMemoryReport.RefreshIfChanged();
+        text.Append("  tex ");
+        AppendNumber(TextureMemoryReport.ToMB(TextureMemoryReport.TotalBytes), 0);
+        text.Append('/');
+        AppendNumber(TextureMemoryReport.ToMB(TextureMemoryReport.BudgetBytes), 0);
+        text.Append(" MB");
+
+        text.Append("\n<b>Live</b> enemies ");
+        AppendInt(EnemySimulationManager.EnemyCount);
+        text.Append("  xp ");
+        AppendInt(ExpGainManager.ActiveCount);
+        text.Append("  shots ");
+        AppendInt(ProjectileManager.ActiveCount);
+        text.Append("  voices ");
+        AppendInt(AudioVoiceManager.ActiveVoiceCount);
+
+        text.Append("\n<b>Input</b> motion ");
+        AppendNumber(InputSampler.LastLatencyMs, 1);
+        text.Append(" ms  avg ");
+        AppendNumber(InputSampler.AverageLatencyMs, 1);
+        text.Append(InputSampler.ManualUpdates ? " ms  (pre-fixed)" : " ms  (dynamic)");
+
+        label.SetText(text);
+    }
+
+    private float Percentile(float p)
+    {
+        if (frameCount == 0) return 0f;
+        int index = Mathf.Clamp(Mathf.CeilToInt(p * frameCount) - 1, 0, frameCount - 1);
+        return sortedTimes[index];
+    }
+
+    private void AppendRecorderMs(ProfilerRecorder recorder)
+    {
+        if (recorder.Valid) AppendNumber(recorder.LastValue * 1e-6f, 2);   // Recorded in ns
+        else text.Append("n/a");
+    }
+
+    private void AppendRecorderCount(ProfilerRecorder recorder)
+    {
+        if (recorder.Valid) AppendInt(recorder.LastValue);
+        else text.Append("n/a");
+    }
+
+    /// <summary>
+    /// Append a fixed-point number without going through ToString (which allocates)
+    /// </summary>
+    private void AppendNumber(float value, int decimals)
+    {
+        if (float.IsNaN(value) || float.IsInfinity(value))
+        {
+            text.Append('-');
+            return;
+        }
+
+        if (value < 0f)
+        {
+            text.Append('-');
+            value = -value;
+        }
+
+        long scale = 1;
+        for (int i = 0; i < decimals; i++) scale *= 10;
+
+        long scaled = (long)(value * scale + 0.5f);
+        AppendInt(scaled / scale);
+        if (decimals == 0) return;
+
+        text.Append('.');
+        long fraction = scaled % scale;
+        for (long digit = scale / 10; digit > 0; digit /= 10)
+        {
+            text.Append((char)('0' + fraction / digit));
+            fraction %= digit;
+        }
+    }
+
+    private void AppendInt(long value)
+    {
+        if (value < 0)
+        {
+            text.Append('-');
+            value = -value;
+        }
+
+        long digit = 1;
+        while (value / digit >= 10) digit *= 10;
+        for (; digit > 0; digit /= 10)
+        {
+            text.Append((char)('0' + value / digit));
+            value %= digit;
+        }
+    }
+
+    // ==================== GRAPH ====================
+
+    private void RedrawGraph()
+    {
+        for (int i = 0; i < graphPixels.Length; i++)
+            graphPixels[i] = BackgroundColor;
+
+        // Oldest frame on the left, newest on the right
+        int start = frameHead - frameCount + HistoryLength;
+        int offset = HistoryLength - frameCount;
+        for (int i = 0; i < frameCount; i++)
+        {
+            float ms = frameTimes[(start + i) % HistoryLength];
+            int height = Mathf.Clamp(Mathf.CeilToInt(ms / GraphMaxMs * GraphHeight), 1, GraphHeight);
+            Color32 color = ms <= BudgetLinesMs[1] ? GoodColor : ms <= BudgetLinesMs[2] ? WarnColor : BadColor;
+
+            int x = offset + i;
+            for (int y = 0; y < height; y++)
+                graphPixels[y * HistoryLength + x] = color;
+        }
+
+        foreach (float budget in BudgetLinesMs)
+        {
+            int y = Mathf.Min(GraphHeight - 1, Mathf.RoundToInt(budget / GraphMaxMs * GraphHeight));
+            for (int x = 0; x < HistoryLength; x++)
+            {
+                int index = y * HistoryLength + x;
+                if (graphPixels[index].Equals(BackgroundColor))
+                    graphPixels[index] = BudgetLineColor;
+            }
+        }
+
+        graphTexture.SetPixels32(graphPixels);
+        graphTexture.Apply(false);
+    }
+
+    // ==================== UI ====================
+
+    private void BuildOverlay()
+    {
+        canvasObj = new GameObject("PerformanceHudCanvas");
+        canvasObj.transform.SetParent(transform, false);
+        Canvas canvas = canvasObj.AddComponent<Canvas>();
+        canvasObj.AddComponent<TrackedCanvas>();
+        canvas.renderMode = RenderMode.ScreenSpaceOverlay;
+        canvas.sortingOrder = 500; // Above gameplay UI and menus
+        CanvasScaler scaler = canvasObj.AddComponent<CanvasScaler>();
+        scaler.uiScaleMode = CanvasScaler.ScaleMode.ScaleWithScreenSize;
+        scaler.referenceResolution = new Vector2(1920f, 1080f);
+        scaler.matchWidthOrHeight = 0.5f;
+
+        // Panel anchored top-left; no raycast target so it never eats input
+        GameObject panel = new GameObject("Panel");
+        panel.transform.SetParent(canvasObj.transform, false);
+        RectTransform panelRect = panel.AddComponent<RectTransform>();
+        panelRect.anchorMin = panelRect.anchorMax = panelRect.pivot = new Vector2(0f, 1f);
+        panelRect.anchoredPosition = new Vector2(12f, -12f);
+        panelRect.sizeDelta = new Vector2(HistoryLength * 2f, 294f);
+        Image background = panel.AddComponent<Image>();
+        background.color = new Color(0f, 0f, 0f, 0.45f);
+        background.raycastTarget = false;
+
+        graphTexture = new Texture2D(HistoryLength, GraphHeight, TextureFormat.RGBA32, false);
+        graphTexture.filterMode = FilterMode.Point;
+        graphTexture.wrapMode = TextureWrapMode.Clamp;
+        graphPixels = new Color32[HistoryLength * GraphHeight];
+
+        GameObject graphObj = new GameObject("FrameGraph");
+        graphObj.transform.SetParent(panel.transform, false);
+        RectTransform graphRect = graphObj.AddComponent<RectTransform>();
+        graphRect.anchorMin = new Vector2(0f, 0f);
+        graphRect.anchorMax = new Vector2(1f, 0f);
+        graphRect.pivot = new Vector2(0.5f, 0f);
+        graphRect.sizeDelta = new Vector2(0f, GraphHeight * 2f);
+        RawImage graph = graphObj.AddComponent<RawImage>();
+        graph.texture = graphTexture;
+        graph.raycastTarget = false;
+
+        GameObject textObj = new GameObject("Stats");
+        textObj.transform.SetParent(panel.transform, false);
+        RectTransform textRect = textObj.AddComponent<RectTransform>();
+        textRect.anchorMin = new Vector2(0f, 0f);
+        textRect.anchorMax = new Vector2(1f, 1f);
+        textRect.offsetMin = new Vector2(8f, GraphHeight * 2f + 4f);
+        textRect.offsetMax = new Vector2(-8f, -6f);
+        label = textObj.AddComponent<TextMeshProUGUI>();
+        label.fontSize = 18f;
+        label.color = Color.white;
+        label.alignment = TextAlignmentOptions.TopLeft;
+        label.textWrappingMode = TextWrappingModes.NoWrap;
+        label.raycastTarget = false;
+    }
+}
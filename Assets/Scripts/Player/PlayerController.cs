@@ -9,6 +9,7 @@ using UnityEngine;
 /// - PlayerMovement: Physics, knockback, animation
 /// - PlayerCombat: Enemy detection, targeting, weapons
 /// - PlayerDamageHandler: Damage, invincibility, death
+/// - PlayerContactHandler: Enemy contacts and pickups, resolved once per physics step
 /// - PlayerAudioHandler: All audio playback
 /// </summary>
 [RequireComponent(typeof(PlayerInputHandler))]
@@ -38,6 +39,7 @@ public class PlayerController : MonoBehaviour
     private PlayerMovement _movement;
     private PlayerCombat _combat;
     private PlayerDamageHandler _damageHandler;
+    private PlayerContactHandler _contactHandler;
     private PlayerAudioHandler _audioHandler;
     private PlayerStats _playerStats;
 
@@ -65,6 +67,8 @@ public class PlayerController : MonoBehaviour
         _movement = GetComponent<PlayerMovement>();
         _combat = GetComponent<PlayerCombat>();
         _damageHandler = GetComponent<PlayerDamageHandler>();
+        if (!TryGetComponent(out _contactHandler))
+            _contactHandler = gameObject.AddComponent<PlayerContactHandler>();
         _audioHandler = GetComponent<PlayerAudioHandler>();
         _playerStats = GetComponent<PlayerStats>();
         animator = GetComponent<Animator>();
@@ -97,6 +101,9 @@ public class PlayerController : MonoBehaviour
     {
         if (_damageHandler != null && _damageHandler.IsGameOver) return;
 
+        // Enemy contacts and pickups from the last physics step
+        _contactHandler?.ResolveContacts();
+
         // Handle combat (enemy detection and attacking)
         _combat?.HandleCombat();
 
@@ -107,6 +114,10 @@ public class PlayerController : MonoBehaviour
         Vector2 input = _inputHandler?.RawInput ?? Vector2.zero;
         _movement?.ProcessMovement(input);
 
+        // Input-to-motion latency for PerformanceHud (scripted input isn't player latency)
+        if (_inputHandler != null && !_inputHandler.InputOverride.HasValue)
+            InputSampler.ReportMotionApplied();
+
         // Update lava ambient based on Y position
         if (_movement != null && _audioHandler != null)
         {
@@ -114,12 +125,6 @@ public class PlayerController : MonoBehaviour
         }
     }
 
-    private void OnTriggerEnter2D(Collider2D other)
-    {
-        Debug.Log("Collided with " + other.name);
-        _damageHandler?.HandleCollision(other);
-    }
-
     private void SpawnAtCenter()
     {
         Camera mainCam = Camera.main;
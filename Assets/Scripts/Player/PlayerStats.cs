@@ -13,6 +13,10 @@ using System.Collections.Generic;
 /// - Armor: Flat damage reduction applied before taking damage
 /// - Health Regen: HP restored per second
 /// - Life Steal: % of damage dealt returned as health (0-100)
+///
+/// Every mutation bumps Version and raises StatsChanged, so dependents cache derived values and
+/// recompute only on change instead of polling each frame. Temporary boosts sit in a min-heap
+/// keyed by expiry time; Update only peeks the earliest deadline.
 /// </summary>
 public class PlayerStats : MonoBehaviour
 {
@@ -58,28 +62,45 @@ public class PlayerStats : MonoBehaviour
     // Health regen timer
     private float _regenTimer;
     
-    // Temporary boost tracking
+    // Temporary boost tracking - min-heap on expireTime (earliest at index 0)
     private struct ActiveBoost
     {
         public TemporaryBoostType type;
         public float amount;
-        public float remainingTime;
+        public float expireTime;
     }
-    private List<ActiveBoost> _activeBoosts = new List<ActiveBoost>();
+    private readonly List<ActiveBoost> _activeBoosts = new List<ActiveBoost>();
     
     // Temporary boost bonuses (added on top of base stats)
     private float _tempMovementSpeedBonus;
     private float _tempDamageBonus;
     private float _tempAttackSpeedMultiplier;
     private float _tempHealthRegenBonus;
+    private float _magnetRadius;
+    private bool _magnetActive;
 
 // UI references - discovered dynamically
     private Bar _healthBar;
     private Bar _experienceBar;
     private LevelUpScreen _levelUpScreen;
 
+    /// <summary>
+    /// Raised after any stat, health, experience or boost change
+    /// </summary>
+    public event System.Action<PlayerStats> StatsChanged;
+
+    /// <summary>
+    /// Incremented on every change - compare against a cached value to skip unchanged rebuilds
+    /// </summary>
+    public int Version { get; private set; }
+
     // Public read-only properties (include temporary bonuses)
     public bool IsAlive => _currentHealth > 0f;
+
+    /// <summary>
+    /// Ignore all incoming damage (used by WaveBenchmark so runs always finish)
+    /// </summary>
+    public bool Invulnerable { get; set; }
     public float CurrentHealth => _currentHealth;
     public float CurrentMaxHealth => _currentMaxHealth;
     public float CurrentAttackSpeed => _currentAttackSpeed * (1f - _tempAttackSpeedMultiplier); // Lower = faster
@@ -124,43 +145,72 @@ public class PlayerStats : MonoBehaviour
                 float healAmount = totalRegen;
                 _currentHealth = Mathf.Min(_currentHealth + healAmount, _currentMaxHealth);
                 _healthBar?.UpdateBar(_currentHealth, _currentMaxHealth);
+                NotifyStatsChanged();
             }
         }
         
-        // Update temporary boosts
-        UpdateTemporaryBoosts();
+        // Expire temporary boosts - only the earliest deadline is checked each frame
+        if (_activeBoosts.Count > 0 && _activeBoosts[0].expireTime <= Time.time)
+        {
+            ExpireTemporaryBoosts();
+        }
+    }
+    
+    private void NotifyStatsChanged()
+    {
+        Version++;
+        StatsChanged?.Invoke(this);
     }
     
     /// <summary>
-    /// Update and expire temporary boosts
+    /// Pop every boost whose deadline has passed, then recalculate once
     /// </summary>
-    private void UpdateTemporaryBoosts()
+    private void ExpireTemporaryBoosts()
     {
-        if (_activeBoosts.Count == 0) return;
-        
-        bool needsRecalculate = false;
+        float now = Time.time;
+        while (_activeBoosts.Count > 0 && _activeBoosts[0].expireTime <= now)
+        {
+            GameLog.Verbose(LogCategory.Player, $"Temporary boost expired: {_activeBoosts[0].type}");
+            PopEarliestBoost();
+        }
         
-        for (int i = _activeBoosts.Count - 1; i >= 0; i--)
+        RecalculateTemporaryBonuses();
+        NotifyStatsChanged();
+    }
+    
+    private void PushBoost(ActiveBoost boost)
+    {
+        _activeBoosts.Add(boost);
+        int i = _activeBoosts.Count - 1;
+        while (i > 0)
         {
-            var boost = _activeBoosts[i];
-            boost.remainingTime -= Time.deltaTime;
-            
-            if (boost.remainingTime <= 0f)
-            {
-                _activeBoosts.RemoveAt(i);
-                needsRecalculate = true;
-                Debug.Log($"Temporary boost expired: {boost.type}");
-            }
-            else
-            {
-                _activeBoosts[i] = boost;
-            }
+            int parent = (i - 1) / 2;
+            if (_activeBoosts[parent].expireTime <= boost.expireTime) break;
+            _activeBoosts[i] = _activeBoosts[parent];
+            i = parent;
         }
+        _activeBoosts[i] = boost;
+    }
+    
+    private void PopEarliestBoost()
+    {
+        int last = _activeBoosts.Count - 1;
+        ActiveBoost moved = _activeBoosts[last];
+        _activeBoosts.RemoveAt(last);
+        if (last == 0) return;
         
-        if (needsRecalculate)
+        // Sift the former last element down from the root
+        int i = 0;
+        while (true)
         {
-            RecalculateTemporaryBonuses();
+            int child = i * 2 + 1;
+            if (child >= last) break;
+            if (child + 1 < last && _activeBoosts[child + 1].expireTime < _activeBoosts[child].expireTime) child++;
+            if (moved.expireTime <= _activeBoosts[child].expireTime) break;
+            _activeBoosts[i] = _activeBoosts[child];
+            i = child;
         }
+        _activeBoosts[i] = moved;
     }
     
     /// <summary>
@@ -172,6 +222,8 @@ public class PlayerStats : MonoBehaviour
         _tempDamageBonus = 0f;
         _tempAttackSpeedMultiplier = 0f;
         _tempHealthRegenBonus = 0f;
+        _magnetRadius = 0f;
+        _magnetActive = false;
         
         foreach (var boost in _activeBoosts)
         {
@@ -189,6 +241,11 @@ public class PlayerStats : MonoBehaviour
                 case TemporaryBoostType.HealthRegen:
                     _tempHealthRegenBonus += boost.amount;
                     break;
+                case TemporaryBoostType.Magnet:
+                    // Overlapping magnets don't stack - the widest one wins
+                    _magnetActive = true;
+                    _magnetRadius = Mathf.Max(_magnetRadius, boost.amount);
+                    break;
             }
         }
     }
@@ -199,17 +256,18 @@ public class PlayerStats : MonoBehaviour
     public void ApplyTemporaryBoost(TemporaryBoostType type, float amount, float duration)
     {
         // Add the boost
-        _activeBoosts.Add(new ActiveBoost
+        PushBoost(new ActiveBoost
         {
             type = type,
             amount = amount,
-            remainingTime = duration
+            expireTime = Time.time + duration
         });
         
         // Immediately recalculate bonuses
         RecalculateTemporaryBonuses();
+        NotifyStatsChanged();
         
-        Debug.Log($"Applied temporary boost: {type} +{amount} for {duration}s");
+        GameLog.Verbose(LogCategory.Player, $"Applied temporary boost: {type} +{amount} for {duration}s");
     }
     
     /// <summary>
@@ -225,25 +283,14 @@ public class PlayerStats : MonoBehaviour
     }
     
     /// <summary>
-    /// True if player currently has magnet effect active
+    /// True if player currently has magnet effect active (cached on boost change)
     /// </summary>
-    public bool HasMagnetActive => HasActiveBoost(TemporaryBoostType.Magnet);
+    public bool HasMagnetActive => _magnetActive;
     
     /// <summary>
-    /// Get the magnet radius (amount stored in boost)
+    /// Get the magnet radius (amount stored in the widest active magnet boost)
     /// </summary>
-    public float MagnetRadius
-    {
-        get
-        {
-            foreach (var boost in _activeBoosts)
-            {
-                if (boost.type == TemporaryBoostType.Magnet)
-                    return boost.amount;
-            }
-            return 0f;
-        }
-    }
+    public float MagnetRadius => _magnetRadius;
 
     /// <summary>
     /// Discover UI Bar components by GameObject name.
@@ -267,11 +314,11 @@ public class PlayerStats : MonoBehaviour
 
         if (_healthBar == null)
         {
-            Debug.LogWarning("PlayerStats: Could not find HealthBar in scene");
+            GameLog.Warning(LogCategory.Player, "PlayerStats: Could not find HealthBar in scene");
         }
         if (_experienceBar == null)
         {
-            Debug.LogWarning("PlayerStats: Could not find ExperienceBar in scene");
+            GameLog.Warning(LogCategory.Player, "PlayerStats: Could not find ExperienceBar in scene");
         }
     }
 
@@ -308,9 +355,12 @@ public class PlayerStats : MonoBehaviour
         _tempDamageBonus = 0f;
         _tempAttackSpeedMultiplier = 0f;
         _tempHealthRegenBonus = 0f;
+        _magnetRadius = 0f;
+        _magnetActive = false;
 
         _healthBar?.UpdateBar(_currentHealth, _currentMaxHealth);
         _experienceBar?.UpdateBar(_currentExperience, _currentMaxExperience);
+        NotifyStatsChanged();
     }
 
     /// <summary>
@@ -345,7 +395,7 @@ public class PlayerStats : MonoBehaviour
                 AddSprayWidth(sprayWidthBoost.Amount);
                 break;
             default:
-                Debug.LogWarning("Unknown boost type applied.");
+                GameLog.Warning(LogCategory.Player, "Unknown boost type applied.");
                 break;
         }
     }
@@ -355,6 +405,8 @@ public class PlayerStats : MonoBehaviour
     /// </summary>
     public void ApplyDamage(float damage)
     {
+        if (Invulnerable) return;
+
         // Check dodge
         if (_currentDodgeChance > 0f && Random.value * 100f < _currentDodgeChance)
         {
@@ -390,6 +442,7 @@ public class PlayerStats : MonoBehaviour
 
         _healthBar?.UpdateBar(_currentHealth, _currentMaxHealth);
         _experienceBar?.UpdateBar(_currentExperience, _currentMaxExperience);
+        NotifyStatsChanged();
 
         // Show level up screen with upgrade choices
         if (_levelUpScreen == null)
@@ -406,21 +459,25 @@ public class PlayerStats : MonoBehaviour
     {
         _currentHealth = Mathf.Min(_currentHealth + amount, _currentMaxHealth);
         _healthBar?.UpdateBar(_currentHealth, _currentMaxHealth);
+        NotifyStatsChanged();
     }
 
     private void AddAttackSpeed(float amount)
     {
         _currentAttackSpeed *= amount;
+        NotifyStatsChanged();
     }
 
     private void AddDamage(float amount)
     {
         _currentDamage += amount;
+        NotifyStatsChanged();
     }
 
     private void AddMovementSpeed(float amount)
     {
         _currentMovementSpeed += amount;
+        NotifyStatsChanged();
     }
 
     private void AddExperience(float amount)
@@ -433,27 +490,32 @@ public class PlayerStats : MonoBehaviour
         else
         {
             _experienceBar?.UpdateBar(_currentExperience, _currentMaxExperience);
+            NotifyStatsChanged();
         }
     }
 
     private void AddDetectionRadius(float amount)
     {
         _currentDetectionRadius += amount;
+        NotifyStatsChanged();
     }
 
     public void AddSprayRange(float amount)
     {
         _currentSprayRange += amount;
+        NotifyStatsChanged();
     }
 
     public void AddSprayWidth(float amount)
     {
         _currentSprayWidth = Mathf.Clamp(_currentSprayWidth + amount, 5f, 60f);
+        NotifyStatsChanged();
     }
 
     public void AddSprayDamageMultiplier(float amount)
     {
         _currentSprayDamageMultiplier += amount;
+        NotifyStatsChanged();
     }
 
     // Public methods for upgrade system
@@ -462,57 +524,68 @@ public class PlayerStats : MonoBehaviour
         _currentMaxHealth += amount;
         _currentHealth += amount; // Also heal by that amount
         _healthBar?.UpdateBar(_currentHealth, _currentMaxHealth);
+        NotifyStatsChanged();
     }
 
     public void AddDamagePublic(float amount)
     {
         _currentDamage += amount;
+        NotifyStatsChanged();
     }
 
     public void AddSpeedPublic(float amount)
     {
         _currentMovementSpeed += amount;
+        NotifyStatsChanged();
     }
 
     public void AddAttackSpeedPublic(float amount)
     {
         _currentAttackSpeed *= (1f + amount);
+        NotifyStatsChanged();
     }
 
     public void AddDetectionRadiusPublic(float amount)
     {
         _currentDetectionRadius += amount;
+        NotifyStatsChanged();
     }
     
     // Roguelike stat modifiers
     public void AddCritChance(float amount)
     {
         _currentCritChance = Mathf.Clamp(_currentCritChance + amount, 0f, 100f);
+        NotifyStatsChanged();
     }
     
     public void AddCritDamage(float amount)
     {
         _currentCritDamage += amount;
+        NotifyStatsChanged();
     }
     
     public void AddDodgeChance(float amount)
     {
         _currentDodgeChance = Mathf.Clamp(_currentDodgeChance + amount, 0f, 75f); // Cap at 75%
+        NotifyStatsChanged();
     }
     
     public void AddArmor(float amount)
     {
         _currentArmor += amount;
+        NotifyStatsChanged();
     }
     
     public void AddHealthRegen(float amount)
     {
         _currentHealthRegen += amount;
+        NotifyStatsChanged();
     }
     
     public void AddLifeSteal(float amount)
     {
         _currentLifeSteal = Mathf.Clamp(_currentLifeSteal + amount, 0f, 100f);
+        NotifyStatsChanged();
     }
     
     /// <summary>
@@ -540,6 +613,7 @@ public class PlayerStats : MonoBehaviour
             float healAmount = damageDealt * (_currentLifeSteal / 100f);
             _currentHealth = Mathf.Min(_currentHealth + healAmount, _currentMaxHealth);
             _healthBar?.UpdateBar(_currentHealth, _currentMaxHealth);
+            NotifyStatsChanged();
         }
     }
 }
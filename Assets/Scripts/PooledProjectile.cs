@@ -0,0 +1,92 @@
+using UnityEngine;
+
+/// <summary>
+/// Base for projectiles owned by ProjectileManager.
+/// The manager pools them, moves them and hit-tests them as circles, so their colliders and
+/// rigidbodies are switched off and subclasses only react to hits and animate their visuals.
+/// </summary>
+public abstract class PooledProjectile : MonoBehaviour
+{
+    /// <summary>
+    /// Slot in ProjectileManager while in flight (-1 when not launched)
+    /// </summary>
+    public int SimulationIndex { get; set; } = -1;
+
+    /// <summary>
+    /// Prefab this projectile was pooled from (null if it was not spawned through the manager)
+    /// </summary>
+    public GameObject PoolPrefab { get; set; }
+
+    /// <summary>
+    /// Radius of the hit circle in world units, taken from the prefab's collider
+    /// </summary>
+    public float HitRadius { get; private set; }
+
+    protected virtual void Awake()
+    {
+        HitRadius = MeasureHitRadius();
+
+        // Hits are tested by the manager - keep the projectile out of the physics scene
+        foreach (Collider2D col in GetComponents<Collider2D>())
+            col.enabled = false;
+
+        Rigidbody2D body = GetComponent<Rigidbody2D>();
+        if (body != null)
+            body.simulated = false;
+    }
+
+    protected virtual void OnDisable()
+    {
+        ProjectileManager.Unregister(this);
+    }
+
+    /// <summary>
+    /// Start flying. Hostile projectiles hit the player, the others hit enemies.
+    /// </summary>
+    protected void Launch(Vector2 velocity, float lifeTime, bool hostile)
+    {
+        ProjectileManager.Launch(this, velocity, lifeTime, hostile);
+    }
+
+    /// <summary>
+    /// Per-frame visual update while in flight, called by the manager after moving the projectile
+    /// </summary>
+    public virtual void SimulationUpdate(float timeAlive, float deltaTime)
+    {
+    }
+
+    /// <summary>
+    /// A hostile projectile reached the player. Return true to despawn it.
+    /// </summary>
+    public virtual bool OnHitPlayer(PlayerStats stats)
+    {
+        return false;
+    }
+
+    /// <summary>
+    /// A friendly projectile reached an enemy. Return true to despawn it.
+    /// </summary>
+    public virtual bool OnHitEnemy(EnemyBase enemy)
+    {
+        return false;
+    }
+
+    private float MeasureHitRadius()
+    {
+        Vector3 scale = transform.lossyScale;
+        float maxScale = Mathf.Max(Mathf.Abs(scale.x), Mathf.Abs(scale.y));
+
+        CircleCollider2D circle = GetComponent<CircleCollider2D>();
+        if (circle != null)
+            return circle.radius * maxScale;
+
+        Collider2D col = GetComponent<Collider2D>();
+        if (col != null)
+        {
+            Vector3 extents = col.bounds.extents;
+            return Mathf.Max(extents.x, extents.y);
+        }
+
+        return 0.25f * maxScale;
+    }
+}
@@ -0,0 +1,507 @@
+using System;
+using System.Threading;
+using UnityEngine;
+
+/// <summary>
+/// What a streaming voice plays
+/// </summary>
+public enum ProceduralVoiceKind : byte
+{
+    Samples,    // A pre-rendered buffer (ProceduralClipSet variation or a fixed UI sound)
+    Footstep,   // Synthesized while playing by ProceduralFootstepAudio.NextSample
+    Pickup      // Synthesized while playing by ProceduralXPPickupAudio.NextSample
+}
+
+/// <summary>
+/// Parameters and running state of a sound synthesized on the audio thread.
+/// The generator fills in length and parameters when it posts the trigger and the mixer advances
+/// the state sample by sample; what each field means is up to the generator.
+/// </summary>
+public struct ProceduralStreamState
+{
+    public int length;      // Samples to render
+    public float p0, p1, p2, p3, p4;
+    public float s0, s1, s2, s3, s4, s5, s6;
+    public uint rng;        // Must be non-zero
+
+    /// <summary>
+    /// White noise in [-1, 1) from a per-voice xorshift (UnityEngine.Random is main-thread only)
+    /// </summary>
+    public float NextNoise()
+    {
+        uint x = rng;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        rng = x;
+        return (x >> 8) * (2f / 16777216f) - 1f;
+    }
+}
+
+/// <summary>
+/// A sound posted by gameplay code for the audio thread to start
+/// </summary>
+public struct ProceduralTrigger
+{
+    public ProceduralVoiceKind kind;
+    public AudioVoiceCategory category;
+    public float[] samples;
+    public ProceduralStreamState stream;
+    public float pitch;
+    public float gainLeft;
+    public float gainRight;
+    public float priority;
+    public long startFrame;
+}
+
+/// <summary>
+/// Fixed-size single-producer/single-consumer trigger queue: the main thread pushes, the audio
+/// thread pops. Each index is only written by one side, so neither side ever locks or waits.
+/// </summary>
+public sealed class ProceduralTriggerRing
+{
+    private readonly ProceduralTrigger[] items;
+    private readonly int mask;
+    private int head;   // Next slot to write (main thread)
+    private int tail;   // Next slot to read (audio thread)
+
+    public ProceduralTriggerRing(int capacity)
+    {
+        int size = Mathf.NextPowerOfTwo(Mathf.Max(2, capacity));
+        items = new ProceduralTrigger[size];
+        mask = size - 1;
+    }
+
+    /// <summary>
+    /// Queue a trigger. Returns false, dropping it, when the audio thread has fallen a full ring behind.
+    /// </summary>
+    public bool TryPush(in ProceduralTrigger trigger)
+    {
+        int h = head;
+        if (h - Volatile.Read(ref tail) >= items.Length) return false;
+
+        items[h & mask] = trigger;
+        Volatile.Write(ref head, h + 1);
+        return true;
+    }
+
+    public bool TryPop(out ProceduralTrigger trigger)
+    {
+        int t = tail;
+        if (t == Volatile.Read(ref head))
+        {
+            trigger = default;
+            return false;
+        }
+
+        int slot = t & mask;
+        trigger = items[slot];
+        items[slot].samples = null;   // Don't keep the buffer alive from the ring
+        Volatile.Write(ref tail, t + 1);
+        return true;
+    }
+}
+
+/// <summary>
+/// Streaming mixer for procedural one-shots. Gameplay code posts lightweight triggers into a
+/// lock-free ring; OnAudioFilterRead drains it on the audio thread and mixes every voice block by
+/// block into one AudioSource, so playing a sound never creates an AudioClip or claims an AudioSource.
+/// Pre-rendered variations (ProceduralClipCache) and the UI sounds stream from their sample
+/// buffers; footsteps and XP pickups are synthesized sample by sample while they play.
+/// Each trigger is stamped against a steady estimate of the DSP clock and starts on that exact
+/// sample one buffer later, so rapid-fire shots keep their spacing instead of snapping to audio
+/// block boundaries. Voice caps and stealing follow AudioVoiceManager's categories.
+/// WebGL has no OnAudioFilterRead, so there every sound keeps playing through AudioVoiceManager.
+/// </summary>
+[RequireComponent(typeof(AudioSource))]
+public class ProceduralAudioMixer : MonoBehaviour
+{
+#if UNITY_WEBGL && !UNITY_EDITOR
+    private static readonly bool supported = false;   // No OnAudioFilterRead on WebGL
+#else
+    private static readonly bool supported = true;
+#endif
+
+    private const int RingCapacity = 128;
+
+    // Triggers this late (the source was paused or the app suspended) are dropped, not bunched up
+    private const float MaxLateSeconds = 0.1f;
+
+    // Positional falloff, matching the linear rolloff of the AudioVoiceManager voices
+    private const float MinDistance = 1f;
+
+    private struct Voice
+    {
+        public bool active;
+        public ProceduralVoiceKind kind;
+        public AudioVoiceCategory category;
+        public float priority;
+        public long startFrame;
+        public int length;      // Output frames the voice lasts
+        public int played;      // Output frames rendered so far
+        public float gainLeft;
+        public float gainRight;
+
+        // Samples
+        public float[] samples;
+        public double position;
+        public float step;
+
+        // Footstep / Pickup
+        public ProceduralStreamState stream;
+    }
+
+    private static ProceduralAudioMixer instance;
+    private static readonly ProceduralTriggerRing triggers = new ProceduralTriggerRing(RingCapacity);
+    private static int activeVoiceCount;
+
+    private int sampleRate;
+    private int bufferFrames;
+    private long maxLateFrames;
+    private Transform listener;
+
+    // Audio thread only
+    private Voice[] voices;
+    private float[] scratch;
+    private long renderedFrames;
+
+    // Written by the audio thread after each block, read by the main thread to stamp triggers
+    private long clockFrame;
+    private long clockTicks;
+
+    /// <summary>
+    /// True when one-shots should be posted here instead of played through AudioVoiceManager
+    /// </summary>
+    public static bool Supported => supported;
+
+    /// <summary>
+    /// Number of voices the mixer played in its last block
+    /// </summary>
+    public static int ActiveVoiceCount => instance != null ? Volatile.Read(ref activeVoiceCount) : 0;
+
+    /// <summary>
+    /// Stream a sample buffer as a 2D one-shot. Volume doubles as priority (see AudioVoiceManager.Play).
+    /// Returns false if the trigger couldn't be queued.
+    /// </summary>
+    public static bool Play(float[] samples, AudioVoiceCategory category, float volume, float pitch = 1f)
+    {
+        if (samples == null || samples.Length == 0 || volume <= 0.001f) return false;
+
+        ProceduralTrigger trigger = new ProceduralTrigger
+        {
+            kind = ProceduralVoiceKind.Samples,
+            samples = samples,
+            pitch = pitch,
+            gainLeft = volume,
+            gainRight = volume
+        };
+        return Post(ref trigger, category, AudioVoiceManager.GetPriority(category, volume));
+    }
+
+    /// <summary>
+    /// Stream a sample buffer at a world position with partial 3D falloff and panning
+    /// (see AudioVoiceManager.PlayAt)
+    /// </summary>
+    public static bool PlayAt(float[] samples, AudioVoiceCategory category, Vector3 position, float volume, float pitch = 1f, float spatialBlend = 0.5f)
+    {
+        if (samples == null || samples.Length == 0 || volume <= 0.001f || !EnsureInstance()) return false;
+
+        ProceduralTrigger trigger = new ProceduralTrigger
+        {
+            kind = ProceduralVoiceKind.Samples,
+            samples = samples,
+            pitch = pitch
+        };
+        instance.Spatialize(position, spatialBlend, volume, out trigger.gainLeft, out trigger.gainRight);
+        return Post(ref trigger, category, AudioVoiceManager.GetPriorityAt(category, position, volume));
+    }
+
+    /// <summary>
+    /// Synthesize a 2D one-shot on the audio thread, starting from state
+    /// </summary>
+    public static bool PlayStream(ProceduralVoiceKind kind, in ProceduralStreamState state, AudioVoiceCategory category, float volume)
+    {
+        if (state.length <= 0 || volume <= 0.001f) return false;
+
+        ProceduralTrigger trigger = new ProceduralTrigger
+        {
+            kind = kind,
+            stream = state,
+            pitch = 1f,
+            gainLeft = volume,
+            gainRight = volume
+        };
+        if (trigger.stream.rng == 0) trigger.stream.rng = 0x9E3779B9u;
+        return Post(ref trigger, category, AudioVoiceManager.GetPriority(category, volume));
+    }
+
+    private static bool Post(ref ProceduralTrigger trigger, AudioVoiceCategory category, float priority)
+    {
+        if (!EnsureInstance()) return false;
+
+        trigger.category = category;
+        trigger.priority = priority;
+        trigger.startFrame = instance.EstimateStartFrame();
+        return triggers.TryPush(trigger);
+    }
+
+    private static bool EnsureInstance()
+    {
+        if (instance != null) return true;
+        if (!supported || !Application.isPlaying) return false;
+
+        GameObject obj = new GameObject("ProceduralAudioMixer");
+        DontDestroyOnLoad(obj);
+        instance = obj.AddComponent<ProceduralAudioMixer>();
+        return true;
+    }
+
+    void Awake()
+    {
+        sampleRate = AudioSettings.outputSampleRate;
+        AudioSettings.GetDSPBufferSize(out bufferFrames, out _);
+        bufferFrames = Mathf.Max(1, bufferFrames);
+        maxLateFrames = (long)(MaxLateSeconds * sampleRate);
+
+        voices = new Voice[AudioVoiceManager.VoiceCount];
+        scratch = new float[Mathf.Max(bufferFrames, 1024)];
+
+        // A silent looping clip keeps the source - and so OnAudioFilterRead - running
+        AudioSource source = GetComponent<AudioSource>();
+        source.clip = AudioClip.Create("ProceduralAudioMixer", sampleRate, 1, sampleRate, false);
+        source.loop = true;
+        source.playOnAwake = false;
+        source.spatialBlend = 0f;
+        source.priority = 0;
+        source.Play();
+    }
+
+    void OnDestroy()
+    {
+        if (instance == this) instance = null;
+    }
+
+    /// <summary>
+    /// Output frame a trigger posted now should start on: the DSP clock extrapolated with wall time
+    /// since the last block, plus one buffer of latency so the frame is always still ahead
+    /// </summary>
+    private long EstimateStartFrame()
+    {
+        // The two reads can straddle a block; that is off by one block at most and then self-corrects
+        long frame = Interlocked.Read(ref clockFrame);
+        long ticks = Interlocked.Read(ref clockTicks);
+        long elapsed = (System.Diagnostics.Stopwatch.GetTimestamp() - ticks) * sampleRate / System.Diagnostics.Stopwatch.Frequency;
+        elapsed = Math.Min(Math.Max(elapsed, 0L), bufferFrames);
+        return frame + elapsed + bufferFrames;
+    }
+
+    private void Spatialize(Vector3 position, float spatialBlend, float volume, out float left, out float right)
+    {
+        if (listener == null)
+        {
+            AudioListener found = FindAnyObjectByType<AudioListener>();
+            listener = found != null ? found.transform : null;
+        }
+
+        float gain = 1f;
+        float pan = 0f;
+        if (listener != null)
+        {
+            Vector3 local = listener.InverseTransformPoint(position);
+            float dist = local.magnitude;
+            float rolloff = Mathf.Clamp01((AudioVoiceManager.MaxPriorityDistance - dist) /
+                (AudioVoiceManager.MaxPriorityDistance - MinDistance));
+            gain = Mathf.Lerp(1f, rolloff, spatialBlend);
+            if (dist > 0.001f) pan = Mathf.Clamp(local.x / dist, -1f, 1f) * spatialBlend;
+        }
+
+        left = volume * gain * Mathf.Min(1f, 1f - pan);
+        right = volume * gain * Mathf.Min(1f, 1f + pan);
+    }
+
+    // =============== AUDIO THREAD ===============
+
+    void OnAudioFilterRead(float[] data, int channels)
+    {
+        int frames = data.Length / channels;
+        long blockStart = renderedFrames;
+
+        // First block bigger than expected: grow once rather than clip voices
+        if (scratch.Length < frames) scratch = new float[frames];
+
+        while (triggers.TryPop(out ProceduralTrigger trigger))
+        {
+            if (trigger.startFrame >= blockStart - maxLateFrames)
+                StartVoice(ref trigger);
+        }
+
+        int active = 0;
+        for (int i = 0; i < voices.Length; i++)
+        {
+            ref Voice v = ref voices[i];
+            if (!v.active) continue;
+
+            int offset = (int)Math.Max(0L, v.startFrame - blockStart);
+            if (offset < frames)
+                v.active = Mix(ref v, data, channels, offset, frames - offset);
+            if (v.active) active++;
+        }
+        Volatile.Write(ref activeVoiceCount, active);
+
+        renderedFrames = blockStart + frames;
+        Interlocked.Exchange(ref clockTicks, System.Diagnostics.Stopwatch.GetTimestamp());
+        Interlocked.Exchange(ref clockFrame, renderedFrames);
+    }
+
+    /// <summary>
+    /// Give a trigger a voice, stealing the weakest one when its category (or the whole mixer) is
+    /// full - the same rules as AudioVoiceManager - or dropping it if it is weaker still
+    /// </summary>
+    private void StartVoice(ref ProceduralTrigger trigger)
+    {
+        int inCategory = 0;
+        int free = -1;
+        int weakest = -1;
+        int weakestInCategory = -1;
+        float weakestScore = float.MaxValue;
+        float weakestCategoryScore = float.MaxValue;
+
+        for (int i = 0; i < voices.Length; i++)
+        {
+            ref Voice v = ref voices[i];
+            if (!v.active)
+            {
+                if (free < 0) free = i;
+                continue;
+            }
+
+            float score = v.priority * (1f - (float)v.played / v.length);
+            if (score < weakestScore)
+            {
+                weakestScore = score;
+                weakest = i;
+            }
+
+            if (v.category == trigger.category)
+            {
+                inCategory++;
+                if (score < weakestCategoryScore)
+                {
+                    weakestCategoryScore = score;
+                    weakestInCategory = i;
+                }
+            }
+        }
+
+        int slot;
+        if (inCategory >= AudioVoiceManager.GetCategoryCap(trigger.category))
+        {
+            if (trigger.priority <= weakestCategoryScore) return;
+            slot = weakestInCategory;
+        }
+        else if (free >= 0)
+        {
+            slot = free;
+        }
+        else
+        {
+            if (trigger.priority <= weakestScore) return;
+            slot = weakest;
+        }
+
+        ref Voice voice = ref voices[slot];
+        voice.active = true;
+        voice.kind = trigger.kind;
+        voice.category = trigger.category;
+        voice.priority = trigger.priority;
+        voice.startFrame = trigger.startFrame;
+        voice.played = 0;
+        voice.gainLeft = trigger.gainLeft;
+        voice.gainRight = trigger.gainRight;
+
+        if (trigger.kind == ProceduralVoiceKind.Samples)
+        {
+            voice.samples = trigger.samples;
+            voice.position = 0d;
+            voice.step = Mathf.Max(0.01f, Mathf.Abs(trigger.pitch));
+            voice.length = Mathf.Max(1, (int)Math.Ceiling(trigger.samples.Length / voice.step));
+        }
+        else
+        {
+            voice.samples = null;
+            voice.stream = trigger.stream;
+            voice.length = trigger.stream.length;
+        }
+    }
+
+    /// <summary>
+    /// Add up to count frames of a voice into data from frame offset. Returns false once it has finished.
+    /// </summary>
+    private bool Mix(ref Voice v, float[] data, int channels, int offset, int count)
+    {
+        count = Math.Min(count, v.length - v.played);
+
+        switch (v.kind)
+        {
+            case ProceduralVoiceKind.Samples:
+                ReadSamples(ref v, count);
+                break;
+            case ProceduralVoiceKind.Footstep:
+                for (int n = 0; n < count; n++)
+                    scratch[n] = ProceduralFootstepAudio.NextSample(ref v.stream, v.played + n, sampleRate);
+                break;
+            case ProceduralVoiceKind.Pickup:
+                for (int n = 0; n < count; n++)
+                    scratch[n] = ProceduralXPPickupAudio.NextSample(ref v.stream, v.played + n, sampleRate);
+                break;
+        }
+
+        int index = offset * channels;
+        if (channels == 1)
+        {
+            float gain = (v.gainLeft + v.gainRight) * 0.5f;
+            for (int n = 0; n < count; n++)
+                data[index + n] += scratch[n] * gain;
+        }
+        else
+        {
+            for (int n = 0; n < count; n++, index += channels)
+            {
+                data[index] += scratch[n] * v.gainLeft;
+                data[index + 1] += scratch[n] * v.gainRight;
+            }
+        }
+
+        v.played += count;
+        if (v.played < v.length) return true;
+
+        v.samples = null;
+        return false;
+    }
+
+    /// <summary>
+    /// Resample the next count frames of a buffer voice into scratch (linear interpolation for pitch)
+    /// </summary>
+    private void ReadSamples(ref Voice v, int count)
+    {
+        float[] src = v.samples;
+        int last = src.Length - 1;
+        double position = v.position;
+
+        for (int n = 0; n < count; n++, position += v.step)
+        {
+            int i = (int)position;
+            if (i < last)
+            {
+                float frac = (float)(position - i);
+                scratch[n] = src[i] + (src[i + 1] - src[i]) * frac;
+            }
+            else
+            {
+                scratch[n] = i == last ? src[last] : 0f;
+            }
+        }
+
+        v.position = position;
+    }
+}
@@ -0,0 +1,285 @@
+using System.Collections.Generic;
+using System.Threading.Tasks;
+using UnityEngine;
+
+/// <summary>
+/// Renders one variation of a procedural sound into a new sample buffer.
+/// May run on a worker thread: use the given rng instead of UnityEngine.Random and don't touch Unity APIs.
+/// </summary>
+public delegate float[] ProceduralClipRenderer(System.Random rng);
+
+/// <summary>
+/// Shared cache of pre-rendered procedural sound variations.
+/// Generators request a set per preset once (e.g. "ProceduralGunAudio/Shotgun") and then just pick a
+/// random clip on play, applying pitch/volume variation on the voice instead of re-synthesizing.
+/// Variations render on a background worker where threads exist; on WebGL they render on the main
+/// thread, one per frame, so building a set never costs more than one clip in a single frame.
+/// Where ProceduralAudioMixer is supported the sets keep plain sample buffers and play by posting a
+/// trigger to the mixer; otherwise they become AudioClips played through AudioVoiceManager.
+/// </summary>
+public class ProceduralClipCache : MonoBehaviour
+{
+    public const int DefaultVariations = 4;
+
+#if UNITY_WEBGL && !UNITY_EDITOR
+    private static readonly bool useWorkerThread = false;   // No threads on WebGL
+#else
+    private static readonly bool useWorkerThread = true;
+#endif
+
+    private static ProceduralClipCache instance;
+    private static readonly Dictionary<string, ProceduralClipSet> sets = new Dictionary<string, ProceduralClipSet>();
+    private static readonly List<ProceduralClipSet> pending = new List<ProceduralClipSet>();
+
+    // Worker renders run one after another so generators never render concurrently with themselves
+    private static Task workerChain = Task.CompletedTask;
+
+    /// <summary>
+    /// True when variations render on a background worker instead of the main thread
+    /// </summary>
+    public static bool UsesWorkerThread => useWorkerThread;
+
+    /// <summary>
+    /// Get the variation set for a key, starting to render it on first request.
+    /// The renderer is only used for the first request of a key; later callers share the clips.
+    /// </summary>
+    public static ProceduralClipSet GetSet(string key, ProceduralClipRenderer renderer, int variations = DefaultVariations)
+    {
+        if (sets.TryGetValue(key, out ProceduralClipSet set)) return set;
+
+        EnsureInstance();
+
+        set = new ProceduralClipSet(key, Mathf.Max(1, variations), renderer, Random.Range(int.MinValue, int.MaxValue));
+        sets[key] = set;
+        pending.Add(set);
+
+        if (useWorkerThread)
+        {
+            ProceduralClipSet workerSet = set;
+            workerChain = workerChain.ContinueWith(_ => workerSet.RenderRemaining(), TaskScheduler.Default);
+        }
+
+        return set;
+    }
+
+    /// <summary>
+    /// Play a random variation through AudioVoiceManager with per-play pitch and volume variation.
+    /// Does nothing if no variation of the set is ready yet.
+    /// </summary>
+    public static void Play(ProceduralClipSet set, AudioVoiceCategory category, float volume, float pitchVariation, float volumeVariation = 0.1f)
+    {
+        if (set == null) return;
+
+        if (ProceduralAudioMixer.Supported)
+        {
+            float[] samples = set.GetRandomSamples();
+            if (samples == null) return;
+
+            ProceduralAudioMixer.Play(samples, category, volume * (1f - Random.Range(0f, volumeVariation)),
+                1f + Random.Range(-pitchVariation, pitchVariation));
+            return;
+        }
+
+        AudioClip clip = set.GetRandomClip();
+        if (clip == null) return;
+
+        AudioVoiceManager.Play(clip, category, volume * (1f - Random.Range(0f, volumeVariation)),
+            1f + Random.Range(-pitchVariation, pitchVariation));
+    }
+
+    /// <summary>
+    /// Positional version of Play (see AudioVoiceManager.PlayAt)
+    /// </summary>
+    public static void PlayAt(ProceduralClipSet set, AudioVoiceCategory category, Vector3 position, float volume, float pitchVariation, float volumeVariation = 0.1f)
+    {
+        if (set == null) return;
+
+        if (ProceduralAudioMixer.Supported)
+        {
+            float[] samples = set.GetRandomSamples();
+            if (samples == null) return;
+
+            ProceduralAudioMixer.PlayAt(samples, category, position, volume * (1f - Random.Range(0f, volumeVariation)),
+                1f + Random.Range(-pitchVariation, pitchVariation));
+            return;
+        }
+
+        AudioClip clip = set.GetRandomClip();
+        if (clip == null) return;
+
+        AudioVoiceManager.PlayAt(clip, category, position, volume * (1f - Random.Range(0f, volumeVariation)),
+            1f + Random.Range(-pitchVariation, pitchVariation));
+    }
+
+    private static void EnsureInstance()
+    {
+        if (instance != null) return;
+
+        GameObject obj = new GameObject("ProceduralClipCache");
+        DontDestroyOnLoad(obj);
+        instance = obj.AddComponent<ProceduralClipCache>();
+    }
+
+    void Update()
+    {
+        // Upload finished variations (AudioClip APIs are main-thread only) and, without a worker,
+        // render the next missing variation of the oldest pending set
+        for (int i = pending.Count - 1; i >= 0; i--)
+        {
+            ProceduralClipSet set = pending[i];
+            if (!useWorkerThread && i == 0)
+                set.RenderNext();
+
+            set.UploadRendered();
+            if (set.IsComplete)
+                pending.RemoveAt(i);
+        }
+    }
+}
+
+/// <summary>
+/// A fixed number of pre-rendered variations of one procedural sound. Owned by ProceduralClipCache.
+/// </summary>
+public class ProceduralClipSet
+{
+    public string Key { get; }
+
+    private readonly AudioClip[] clips;     // Without ProceduralAudioMixer
+    private readonly float[][] samples;     // With ProceduralAudioMixer
+    private readonly float[][] rendered;    // Written by the renderer, consumed by UploadRendered
+    private readonly System.Random rng;
+    private readonly int sampleRate;
+    private ProceduralClipRenderer renderer;
+    private int nextToRender;
+    private int uploadedCount;
+
+    public ProceduralClipSet(string key, int variations, ProceduralClipRenderer renderer, int seed)
+    {
+        Key = key;
+        clips = new AudioClip[variations];
+        samples = new float[variations][];
+        rendered = new float[variations][];
+        rng = new System.Random(seed);
+        sampleRate = AudioSettings.outputSampleRate;
+        this.renderer = renderer;
+    }
+
+    /// <summary>
+    /// Number of variations ready to play
+    /// </summary>
+    public int ReadyCount => uploadedCount;
+
+    public bool IsComplete => uploadedCount == clips.Length;
+
+    /// <summary>
+    /// Random ready variation, or null while none has finished rendering
+    /// </summary>
+    public AudioClip GetRandomClip()
+    {
+        if (!EnsureReady()) return null;
+        return clips[Random.Range(0, uploadedCount)];
+    }
+
+    /// <summary>
+    /// Random ready variation as a sample buffer for ProceduralAudioMixer, or null while none is ready
+    /// </summary>
+    public float[] GetRandomSamples()
+    {
+        if (!EnsureReady()) return null;
+        return samples[Random.Range(0, uploadedCount)];
+    }
+
+    /// <summary>
+    /// Upload finished variations and report whether any is ready.
+    /// On WebGL the first variation is rendered synchronously so the first play is never silent.
+    /// </summary>
+    private bool EnsureReady()
+    {
+        UploadRendered();
+
+        if (uploadedCount == 0 && renderer != null && nextToRender == 0 && !ProceduralClipCache.UsesWorkerThread)
+        {
+            RenderNext();
+            UploadRendered();
+        }
+
+        return uploadedCount > 0;
+    }
+
+    /// <summary>
+    /// Render every remaining variation (worker thread)
+    /// </summary>
+    public void RenderRemaining()
+    {
+        while (RenderNext()) { }
+    }
+
+    /// <summary>
+    /// Render one variation. Returns false when there was nothing left to render.
+    /// </summary>
+    public bool RenderNext()
+    {
+        ProceduralClipRenderer r = renderer;
+        if (r == null || nextToRender >= clips.Length) return false;
+
+        int index = nextToRender;
+        float[] data = null;
+        try
+        {
+            data = r(rng);
+        }
+        catch (System.Exception e)
+        {
+            Debug.LogException(e);
+        }
+
+        lock (rendered)
+        {
+            // A failed render still counts as one silent sample so the set can complete
+            rendered[index] = data != null && data.Length > 0 ? data : new float[1];
+            nextToRender = index + 1;
+            if (nextToRender >= clips.Length)
+                renderer = null;   // Release the generator that created this set
+        }
+        return true;
+    }
+
+    /// <summary>
+    /// Turn finished sample buffers into AudioClips, or hand them to the mixer as they are (main thread)
+    /// </summary>
+    public void UploadRendered()
+    {
+        if (uploadedCount == clips.Length) return;
+
+        lock (rendered)
+        {
+            while (uploadedCount < clips.Length && rendered[uploadedCount] != null)
+            {
+                float[] data = rendered[uploadedCount];
+                if (ProceduralAudioMixer.Supported)
+                {
+                    samples[uploadedCount] = data;
+                }
+                else
+                {
+                    AudioClip clip = AudioClip.Create(Key, data.Length, 1, sampleRate, false);
+                    clip.SetData(data, 0);
+                    clips[uploadedCount] = clip;
+                }
+                rendered[uploadedCount] = null;
+                uploadedCount++;
+            }
+        }
+    }
+}
+
+/// <summary>
+/// UnityEngine.Random-style helpers for System.Random, used by renderers that can run off the main thread
+/// </summary>
+public static class ProceduralRandomExtensions
+{
+    public static float Range(this System.Random rng, float min, float max)
+    {
+        return min + (float)rng.NextDouble() * (max - min);
+    }
+}
@@ -0,0 +1,225 @@
+using System;
+using System.Numerics;
+
+/// <summary>
+/// Allocation-free DSP building blocks shared by the Procedural*Audio generators.
+/// Everything here is plain managed math on float[] so it runs unchanged on the clip cache worker
+/// thread and on WebGL; block operations use System.Numerics.Vector&lt;float&gt; where the platform
+/// has SIMD and fall back to a scalar loop for the remainder.
+/// </summary>
+public static class ProceduralDsp
+{
+    private const float TwoPi = 2f * (float)Math.PI;
+
+    /// <summary>
+    /// One-pole lowpass. state holds the previous output.
+    /// </summary>
+    public static float OnePoleLowpass(ref float state, float input, float cutoff, float sampleRate)
+    {
+        float rc = 1f / (TwoPi * cutoff);
+        float dt = 1f / sampleRate;
+        float alpha = dt / (rc + dt);
+        state += alpha * (input - state);
+        return state;
+    }
+
+    /// <summary>
+    /// One-pole highpass. prevInput/prevOutput hold the last input and output sample.
+    /// </summary>
+    public static float OnePoleHighpass(ref float prevInput, ref float prevOutput, float input, float cutoff, float sampleRate)
+    {
+        float rc = 1f / (TwoPi * cutoff);
+        float dt = 1f / sampleRate;
+        float alpha = rc / (rc + dt);
+        prevOutput = alpha * (prevOutput + input - prevInput);
+        prevInput = input;
+        return prevOutput;
+    }
+
+    /// <summary>
+    /// Resonant two-pole bandpass (the filter the gun generators use for their body tone).
+    /// y1/y2 hold the last two outputs.
+    /// </summary>
+    public static float ResonantBandpass(ref float y1, ref float y2, float input, float centerFreq, float q, float sampleRate)
+    {
+        float w0 = TwoPi * centerFreq / sampleRate;
+        float alpha = (float)Math.Sin(w0) / (2f * q);
+        float cosW0 = (float)Math.Cos(w0);
+
+        float b0 = alpha;
+        float a0 = 1f + alpha;
+        float a1 = -2f * cosW0;
+        float a2 = 1f - alpha;
+
+        float output = (b0 * input - a1 * y1 - a2 * y2) / a0;
+        y2 = y1;
+        y1 = output;
+        return output;
+    }
+
+    /// <summary>
+    /// Largest absolute sample in buffer[0..count)
+    /// </summary>
+    public static float Peak(float[] buffer, int count)
+    {
+        count = Math.Min(count, buffer.Length);
+
+        int i = 0;
+        float peak = 0f;
+        int width = Vector<float>.Count;
+        if (Vector.IsHardwareAccelerated && count >= width)
+        {
+            Vector<float> max = Vector<float>.Zero;
+            for (; i <= count - width; i += width)
+                max = Vector.Max(max, Vector.Abs(new Vector<float>(buffer, i)));
+
+            for (int lane = 0; lane < width; lane++)
+                peak = Math.Max(peak, max[lane]);
+        }
+
+        for (; i < count; i++)
+            peak = Math.Max(peak, Math.Abs(buffer[i]));
+        return peak;
+    }
+
+    /// <summary>
+    /// Multiply buffer[0..count) by gain in place
+    /// </summary>
+    public static void Scale(float[] buffer, int count, float gain)
+    {
+        count = Math.Min(count, buffer.Length);
+
+        int i = 0;
+        int width = Vector<float>.Count;
+        if (Vector.IsHardwareAccelerated && count >= width)
+        {
+            Vector<float> g = new Vector<float>(gain);
+            for (; i <= count - width; i += width)
+                (new Vector<float>(buffer, i) * g).CopyTo(buffer, i);
+        }
+
+        for (; i < count; i++)
+            buffer[i] *= gain;
+    }
+
+    /// <summary>
+    /// Scale buffer[0..count) so its peak hits targetPeak.
+    /// Near-silent buffers (peak at or below minPeak) are left alone so noise isn't blown up.
+    /// </summary>
+    public static void NormalizePeak(float[] buffer, int count, float targetPeak, float minPeak = 0.01f)
+    {
+        float peak = Peak(buffer, count);
+        if (peak > minPeak)
+            Scale(buffer, count, targetPeak / peak);
+    }
+
+    /// <summary>
+    /// Quadratic fade-out over the last fadeSamples of buffer[0..count)
+    /// </summary>
+    public static void FadeOutQuadratic(float[] buffer, int count, int fadeSamples)
+    {
+        count = Math.Min(count, buffer.Length);
+        fadeSamples = Math.Min(fadeSamples, count);
+        if (fadeSamples <= 0) return;
+
+        // Gain runs from 1 down to exactly 0 on the last sample
+        float step = 1f / fadeSamples;
+        for (int i = 0; i < fadeSamples; i++)
+        {
+            float fade = i * step;
+            buffer[count - 1 - i] *= fade * fade;
+        }
+    }
+}
+
+/// <summary>
+/// Schroeder reverb: parallel feedback combs into series allpasses.
+/// Delay lines are allocated once; Clear() resets them between renders.
+/// </summary>
+public sealed class SchroederReverb
+{
+    private readonly float[][] combBuffers;
+    private readonly int[] combIndices;
+    private readonly float[] combFeedback;
+    private readonly float[][] allpassBuffers;
+    private readonly int[] allpassIndices;
+    private readonly float allpassFeedback;
+    private readonly float combScale;
+
+    public SchroederReverb(int[] combDelays, float[] combFeedback, int[] allpassDelays, float allpassFeedback = 0.5f)
+    {
+        combBuffers = new float[combDelays.Length][];
+        combIndices = new int[combDelays.Length];
+        this.combFeedback = (float[])combFeedback.Clone();
+        for (int i = 0; i < combDelays.Length; i++)
+            combBuffers[i] = new float[combDelays[i]];
+
+        allpassBuffers = new float[allpassDelays.Length][];
+        allpassIndices = new int[allpassDelays.Length];
+        this.allpassFeedback = allpassFeedback;
+        for (int i = 0; i < allpassDelays.Length; i++)
+            allpassBuffers[i] = new float[allpassDelays[i]];
+
+        combScale = combDelays.Length > 0 ? 1f / combDelays.Length : 0f;
+    }
+
+    public void Clear()
+    {
+        for (int i = 0; i < combBuffers.Length; i++)
+        {
+            Array.Clear(combBuffers[i], 0, combBuffers[i].Length);
+            combIndices[i] = 0;
+        }
+        for (int i = 0; i < allpassBuffers.Length; i++)
+        {
+            Array.Clear(allpassBuffers[i], 0, allpassBuffers[i].Length);
+            allpassIndices[i] = 0;
+        }
+    }
+
+    /// <summary>
+    /// Wet output for one input sample
+    /// </summary>
+    public float Process(float input)
+    {
+        // Parallel comb filters
+        float combOut = 0f;
+        for (int i = 0; i < combBuffers.Length; i++)
+        {
+            float[] line = combBuffers[i];
+            int idx = combIndices[i];
+            float delayed = line[idx];
+            line[idx] = input + delayed * combFeedback[i];
+            combIndices[i] = ++idx == line.Length ? 0 : idx;
+            combOut += delayed;
+        }
+
+        // Series allpass filters for diffusion
+        float output = combOut * combScale;
+        for (int i = 0; i < allpassBuffers.Length; i++)
+        {
+            float[] line = allpassBuffers[i];
+            int idx = allpassIndices[i];
+            float delayed = line[idx];
+            float temp = -allpassFeedback * output + delayed;
+            line[idx] = output + allpassFeedback * temp;
+            allpassIndices[i] = ++idx == line.Length ? 0 : idx;
+            output = temp;
+        }
+
+        return output;
+    }
+
+    /// <summary>
+    /// Run buffer[0..count) through the reverb in place: out = in * dry + reverb(in) * wet
+    /// </summary>
+    public void ProcessBlock(float[] buffer, int count, float wet, float dry)
+    {
+        count = Math.Min(count, buffer.Length);
+        for (int i = 0; i < count; i++)
+        {
+            float input = buffer[i];
+            buffer[i] = input * dry + Process(input) * wet;
+        }
+    }
+}
@@ -4,7 +4,6 @@ using UnityEngine;
 /// Procedural gun audio for enemies - distinct from player weapon sounds.
 /// Features alien/organic/corrupted weapon sounds with different tonal characteristics.
 /// </summary>
-[RequireComponent(typeof(AudioSource))]
 public class ProceduralEnemyGunAudio : MonoBehaviour
 {
     public enum EnemyGunSoundType
@@ -66,21 +65,19 @@ public class ProceduralEnemyGunAudio : MonoBehaviour
         public bool hasGlitch;
     }
 
-    private EnemyGunPreset currentPreset;
-    private AudioSource audioSource;
     private int sampleRate;
     private float[] audioBuffer;
 
+    // Pre-rendered variations per sound type, shared by every instance (see ProceduralClipCache)
+    private static readonly ProceduralClipSet[] clipSets = new ProceduralClipSet[System.Enum.GetValues(typeof(EnemyGunSoundType)).Length];
+
     // Filter states
     private float[] lpState = new float[4];
     private float[] hpState = new float[2];
     private float[] bpState = new float[4];
 
     // Reverb
-    private float[][] allpassBuffers;
-    private int[] allpassIndices;
-    private float[][] combBuffers;
-    private int[] combIndices;
+    private SchroederReverb reverb;
     
     // Distance-based volume attenuation
     private static Transform playerTransform;
@@ -89,15 +86,10 @@ public class ProceduralEnemyGunAudio : MonoBehaviour
 
     void Awake()
     {
-        audioSource = GetComponent<AudioSource>();
-        audioSource.playOnAwake = false;
-        audioSource.loop = false;
-
         sampleRate = AudioSettings.outputSampleRate;
-        int maxSamples = Mathf.CeilToInt(1.2f * sampleRate);
-        audioBuffer = new float[maxSamples];
 
-        InitializeReverb();
+        // Render the default sound's variations while the scene loads instead of on the first shot
+        GetClipSet(soundType);
         
         if (playerTransform == null)
         {
@@ -108,32 +100,11 @@ public class ProceduralEnemyGunAudio : MonoBehaviour
 
     private void InitializeReverb()
     {
-        int[] allpassDelays = { 281, 89, 31, 47 };
-        int[] combDelays = { 1423, 1361, 1847, 1993, 1531, 1721 };
-
-        allpassBuffers = new float[allpassDelays.Length][];
-        allpassIndices = new int[allpassDelays.Length];
-        for (int i = 0; i < allpassDelays.Length; i++)
-        {
-            allpassBuffers[i] = new float[allpassDelays[i]];
-            allpassIndices[i] = 0;
-        }
-
-        combBuffers = new float[combDelays.Length][];
-        combIndices = new int[combDelays.Length];
-        for (int i = 0; i < combDelays.Length; i++)
-        {
-            combBuffers[i] = new float[combDelays[i]];
-            combIndices[i] = 0;
-        }
-    }
-
-    private void ClearReverb()
-    {
-        for (int i = 0; i < allpassBuffers.Length; i++)
-            System.Array.Clear(allpassBuffers[i], 0, allpassBuffers[i].Length);
-        for (int i = 0; i < combBuffers.Length; i++)
-            System.Array.Clear(combBuffers[i], 0, combBuffers[i].Length);
+        reverb = new SchroederReverb(
+            new[] { 1423, 1361, 1847, 1993, 1531, 1721 },
+            new[] { 0.82f, 0.80f, 0.79f, 0.77f, 0.76f, 0.75f },
+            new[] { 281, 89, 31, 47 },
+            0.5f);
     }
 
     private EnemyGunPreset GetPreset(EnemyGunSoundType type)
@@ -325,34 +296,33 @@ public class ProceduralEnemyGunAudio : MonoBehaviour
         return Mathf.Sqrt(attenuation);
     }
 
+    /// <summary>
+    /// Pre-rendered variations for a sound type, rendered on first request
+    /// </summary>
+    private ProceduralClipSet GetClipSet(EnemyGunSoundType type)
+    {
+        int index = (int)type;
+        if (clipSets[index] == null)
+        {
+            EnemyGunPreset preset = GetPreset(type);
+            clipSets[index] = ProceduralClipCache.GetSet("ProceduralEnemyGunAudio/" + type, rng => RenderGunClip(preset, rng));
+        }
+        return clipSets[index];
+    }
+
     public void PlayGunSound()
     {
-        float distAtten = GetDistanceAttenuation();
-        if (distAtten < 0.01f) return;
-        
-        currentPreset = GetPreset(soundType);
-        AudioClip clip = GenerateGunClip();
-        audioSource.PlayOneShot(clip, volume * distAtten);
+        PlayGunSound(soundType, 1f);
     }
 
     public void PlayGunSound(float volumeMultiplier)
     {
-        float distAtten = GetDistanceAttenuation();
-        if (distAtten < 0.01f) return;
-        
-        currentPreset = GetPreset(soundType);
-        AudioClip clip = GenerateGunClip();
-        audioSource.PlayOneShot(clip, volume * volumeMultiplier * distAtten);
+        PlayGunSound(soundType, volumeMultiplier);
     }
     
     public void PlayGunSound(EnemyGunSoundType overrideSoundType)
     {
-        float distAtten = GetDistanceAttenuation();
-        if (distAtten < 0.01f) return;
-        
-        currentPreset = GetPreset(overrideSoundType);
-        AudioClip clip = GenerateGunClip();
-        audioSource.PlayOneShot(clip, volume * distAtten);
+        PlayGunSound(overrideSoundType, 1f);
     }
     
     public void PlayGunSound(EnemyGunSoundType overrideSoundType, float volumeMultiplier)
@@ -360,18 +330,21 @@ public class ProceduralEnemyGunAudio : MonoBehaviour
         float distAtten = GetDistanceAttenuation();
         if (distAtten < 0.01f) return;
         
-        currentPreset = GetPreset(overrideSoundType);
-        AudioClip clip = GenerateGunClip();
-        audioSource.PlayOneShot(clip, volume * volumeMultiplier * distAtten);
+        ProceduralClipCache.Play(GetClipSet(overrideSoundType), AudioVoiceCategory.EnemyWeapon, volume * volumeMultiplier * distAtten, randomization * 0.5f);
     }
 
-    private AudioClip GenerateGunClip()
+    private float[] RenderGunClip(EnemyGunPreset p, System.Random rng)
     {
-        EnemyGunPreset p = currentPreset;
+        // Scratch buffers are only needed by the instance that renders a set
+        if (audioBuffer == null)
+            audioBuffer = new float[Mathf.CeilToInt(1.2f * sampleRate)];
+        if (reverb == null)
+            InitializeReverb();
+
         float rnd = randomization;
 
-        float dur = p.duration * (1f + Random.Range(-rnd * 0.3f, rnd * 0.3f));
-        float roomR = p.roomSize * (1f + Random.Range(-rnd, rnd));
+        float dur = p.duration * (1f + rng.Range(-rnd * 0.3f, rnd * 0.3f));
+        float roomR = p.roomSize * (1f + rng.Range(-rnd, rnd));
 
         int numSamples = Mathf.CeilToInt(dur * sampleRate);
         int totalSamples = Mathf.CeilToInt((dur + roomR * 0.4f) * sampleRate);
@@ -381,19 +354,19 @@ public class ProceduralEnemyGunAudio : MonoBehaviour
         System.Array.Clear(lpState, 0, lpState.Length);
         System.Array.Clear(hpState, 0, hpState.Length);
         System.Array.Clear(bpState, 0, bpState.Length);
-        ClearReverb();
+        reverb.Clear();
 
         float phase1 = 0f, phase2 = 0f;
         float phaseSub = 0f, phaseMid = 0f;
         float phaseMod = 0f, phaseRes = 0f;
         float noiseState = 0f;
 
-        float freqOffset1 = Random.Range(0.9f, 1.1f);
-        float freqOffset2 = Random.Range(0.88f, 1.12f);
+        float freqOffset1 = rng.Range(0.9f, 1.1f);
+        float freqOffset2 = rng.Range(0.88f, 1.12f);
 
         // Glitch timing
-        float glitchTime1 = Random.Range(0.02f, 0.06f);
-        float glitchTime2 = Random.Range(0.08f, 0.14f);
+        float glitchTime1 = rng.Range(0.02f, 0.06f);
+        float glitchTime2 = rng.Range(0.08f, 0.14f);
 
         for (int i = 0; i < totalSamples; i++)
         {
@@ -418,8 +391,8 @@ public class ProceduralEnemyGunAudio : MonoBehaviour
                     if ((t > glitchTime1 && t < glitchTime1 + 0.008f) ||
                         (t > glitchTime2 && t < glitchTime2 + 0.012f))
                     {
-                        glitchMod = Random.Range(0.1f, 0.4f);
-                        pitchMod *= Random.Range(0.7f, 1.4f);
+                        glitchMod = rng.Range(0.1f, 0.4f);
+                        pitchMod *= rng.Range(0.7f, 1.4f);
                     }
                 }
 
@@ -475,7 +448,7 @@ public class ProceduralEnemyGunAudio : MonoBehaviour
                 // ===== NOISE =====
                 float noiseEnv = GetNoiseEnvelope(t, dur, p.noiseDecay);
                 
-                float whiteNoise = Random.Range(-1f, 1f);
+                float whiteNoise = rng.Range(-1f, 1f);
                 noiseState = noiseState * (0.95f + p.noiseColor * 0.04f) + whiteNoise * (0.05f - p.noiseColor * 0.04f);
                 float coloredNoise = noiseState * p.noiseColor + whiteNoise * (1f - p.noiseColor);
                 
@@ -492,44 +465,25 @@ public class ProceduralEnemyGunAudio : MonoBehaviour
                 sample *= glitchMod;
             }
 
-            // Reverb
-            float wet = ProcessReverb(sample) * roomR;
-            sample = sample * (1f - roomR * 0.3f) + wet;
-
-            // Limit
-            sample = FinalLimit(sample);
-
             audioBuffer[i] = sample;
         }
 
-        // Fade out
-        int fadeOutSamples = Mathf.Min(totalSamples / 5, sampleRate / 12);
-        for (int i = 0; i < fadeOutSamples; i++)
-        {
-            int idx = totalSamples - 1 - i;
-            float fade = (float)i / fadeOutSamples;
-            fade = fade * fade;
-            audioBuffer[idx] *= fade;
-        }
+        // Reverb
+        reverb.ProcessBlock(audioBuffer, totalSamples, roomR, 1f - roomR * 0.3f);
 
-        // Normalize with headroom to prevent clipping
-        float maxAmp = 0f;
+        // Limit
         for (int i = 0; i < totalSamples; i++)
-            maxAmp = Mathf.Max(maxAmp, Mathf.Abs(audioBuffer[i]));
+            audioBuffer[i] = FinalLimit(audioBuffer[i]);
 
-        if (maxAmp > 0.01f)
-        {
-            float normalize = 0.7f / maxAmp;  // Leave more headroom
-            for (int i = 0; i < totalSamples; i++)
-                audioBuffer[i] *= normalize;
-        }
+        // Fade out
+        ProceduralDsp.FadeOutQuadratic(audioBuffer, totalSamples, Mathf.Min(totalSamples / 5, sampleRate / 12));
+
+        // Normalize with headroom to prevent clipping
+        ProceduralDsp.NormalizePeak(audioBuffer, totalSamples, 0.7f);
 
-        AudioClip clip = AudioClip.Create("EnemyGunShot", totalSamples, 1, sampleRate, false);
         float[] clipData = new float[totalSamples];
         System.Array.Copy(audioBuffer, clipData, totalSamples);
-        clip.SetData(clipData, 0);
-
-        return clip;
+        return clipData;
     }
 
     // =============== ENVELOPES ===============
@@ -605,34 +559,12 @@ public class ProceduralEnemyGunAudio : MonoBehaviour
 
     private float LowpassFilter(float input, float cutoff, int stateIndex)
     {
-        float rc = 1f / (2f * Mathf.PI * cutoff);
-        float dt = 1f / sampleRate;
-        float alpha = dt / (rc + dt);
-        alpha = Mathf.Clamp01(alpha);
-
-        lpState[stateIndex] += alpha * (input - lpState[stateIndex]);
-        return lpState[stateIndex];
+        return ProceduralDsp.OnePoleLowpass(ref lpState[stateIndex], input, cutoff, sampleRate);
     }
 
     private float BandpassFilter(float input, float centerFreq, float q, int stateIndex)
     {
-        float w0 = 2f * Mathf.PI * centerFreq / sampleRate;
-        float alpha = Mathf.Sin(w0) / (2f * q);
-
-        float b0 = alpha;
-        float a1 = -2f * Mathf.Cos(w0);
-        float a2 = 1f - alpha;
-        float norm = 1f + alpha;
-
-        b0 /= norm;
-        a1 /= norm;
-        a2 /= norm;
-
-        float output = b0 * input - a1 * bpState[stateIndex] - a2 * bpState[stateIndex + 1];
-        bpState[stateIndex + 1] = bpState[stateIndex];
-        bpState[stateIndex] = output;
-
-        return output;
+        return ProceduralDsp.ResonantBandpass(ref bpState[stateIndex], ref bpState[stateIndex + 1], input, centerFreq, q, sampleRate);
     }
 
     private float Distort(float x, float amount)
@@ -649,36 +581,6 @@ public class ProceduralEnemyGunAudio : MonoBehaviour
             return (-1f + Mathf.Exp(x * 1.4f)) / 1.1f;
     }
 
-    private float ProcessReverb(float input)
-    {
-        float combOut = 0f;
-        float[] combFeedback = { 0.82f, 0.80f, 0.79f, 0.77f, 0.76f, 0.75f };
-
-        for (int i = 0; i < combBuffers.Length; i++)
-        {
-            int idx = combIndices[i];
-            float delayed = combBuffers[i][idx];
-            combBuffers[i][idx] = input + delayed * combFeedback[i];
-            combIndices[i] = (idx + 1) % combBuffers[i].Length;
-            combOut += delayed;
-        }
-        combOut /= combBuffers.Length;
-
-        float allpassOut = combOut;
-        float allpassFeedback = 0.5f;
-
-        for (int i = 0; i < allpassBuffers.Length; i++)
-        {
-            int idx = allpassIndices[i];
-            float delayed = allpassBuffers[i][idx];
-            float temp = -allpassFeedback * allpassOut + delayed;
-            allpassBuffers[i][idx] = allpassOut + allpassFeedback * temp;
-            allpassIndices[i] = (idx + 1) % allpassBuffers[i].Length;
-            allpassOut = temp;
-        }
-
-        return allpassOut;
-    }
 
     private float FinalLimit(float x)
     {
@@ -4,7 +4,6 @@ using UnityEngine;
 /// Procedural melee attack audio for enemies.
 /// Generates distinct sounds for different melee attack types.
 /// </summary>
-[RequireComponent(typeof(AudioSource))]
 public class ProceduralEnemyMeleeAudio : MonoBehaviour
 {
     public enum MeleeSoundType
@@ -59,11 +58,12 @@ public class ProceduralEnemyMeleeAudio : MonoBehaviour
         public float metallicAmount;
     }
 
-    private MeleePreset currentPreset;
-    private AudioSource audioSource;
     private int sampleRate;
     private float[] audioBuffer;
 
+    // Pre-rendered variations per sound type, shared by every instance (see ProceduralClipCache)
+    private static readonly ProceduralClipSet[] clipSets = new ProceduralClipSet[System.Enum.GetValues(typeof(MeleeSoundType)).Length];
+
     private float[] lpState = new float[4];
     private float[] hpState = new float[2];
     
@@ -74,13 +74,10 @@ public class ProceduralEnemyMeleeAudio : MonoBehaviour
 
     void Awake()
     {
-        audioSource = GetComponent<AudioSource>();
-        audioSource.playOnAwake = false;
-        audioSource.loop = false;
-
         sampleRate = AudioSettings.outputSampleRate;
-        int maxSamples = Mathf.CeilToInt(0.8f * sampleRate);
-        audioBuffer = new float[maxSamples];
+
+        // Render the default sound's variations while the scene loads instead of on the first hit
+        GetClipSet(soundType);
         
         if (playerTransform == null)
         {
@@ -220,14 +217,23 @@ public class ProceduralEnemyMeleeAudio : MonoBehaviour
         return Mathf.Sqrt(attenuation); // Smoother falloff
     }
 
+    /// <summary>
+    /// Pre-rendered variations for a melee sound type, rendered on first request
+    /// </summary>
+    private ProceduralClipSet GetClipSet(MeleeSoundType type)
+    {
+        int index = (int)type;
+        if (clipSets[index] == null)
+        {
+            MeleePreset preset = GetPreset(type);
+            clipSets[index] = ProceduralClipCache.GetSet("ProceduralEnemyMeleeAudio/" + type, rng => RenderMeleeClip(preset, rng));
+        }
+        return clipSets[index];
+    }
+
     public void PlayMeleeSound()
     {
-        float distAtten = GetDistanceAttenuation();
-        if (distAtten < 0.01f) return;
-        
-        currentPreset = GetPreset(soundType);
-        AudioClip clip = GenerateMeleeClip();
-        audioSource.PlayOneShot(clip, volume * distAtten);
+        PlayMeleeSound(1f);
     }
 
     public void PlayMeleeSound(float volumeMultiplier)
@@ -235,17 +241,18 @@ public class ProceduralEnemyMeleeAudio : MonoBehaviour
         float distAtten = GetDistanceAttenuation();
         if (distAtten < 0.01f) return;
         
-        currentPreset = GetPreset(soundType);
-        AudioClip clip = GenerateMeleeClip();
-        audioSource.PlayOneShot(clip, volume * volumeMultiplier * distAtten);
+        ProceduralClipCache.Play(GetClipSet(soundType), AudioVoiceCategory.EnemyMelee, volume * volumeMultiplier * distAtten, randomization * 0.5f);
     }
 
-    private AudioClip GenerateMeleeClip()
+    private float[] RenderMeleeClip(MeleePreset p, System.Random rng)
     {
-        MeleePreset p = currentPreset;
+        // Scratch buffers are only needed by the instance that renders a set
+        if (audioBuffer == null)
+            audioBuffer = new float[Mathf.CeilToInt(0.8f * sampleRate)];
+
         float rnd = randomization;
 
-        float dur = p.duration * (1f + Random.Range(-rnd * 0.3f, rnd * 0.3f));
+        float dur = p.duration * (1f + rng.Range(-rnd * 0.3f, rnd * 0.3f));
         int totalSamples = Mathf.CeilToInt(dur * sampleRate);
         totalSamples = Mathf.Min(totalSamples, audioBuffer.Length);
 
@@ -257,8 +264,8 @@ public class ProceduralEnemyMeleeAudio : MonoBehaviour
         float phaseMetallic = 0f;
         float noiseState = 0f;
 
-        float freqOffset = Random.Range(0.92f, 1.08f);
-        float impactDelayRnd = p.impactDelay * (1f + Random.Range(-rnd, rnd));
+        float freqOffset = rng.Range(0.92f, 1.08f);
+        float impactDelayRnd = p.impactDelay * (1f + rng.Range(-rnd, rnd));
 
         for (int i = 0; i < totalSamples; i++)
         {
@@ -271,7 +278,7 @@ public class ProceduralEnemyMeleeAudio : MonoBehaviour
             float whooshEnv = GetWhooshEnvelope(t, dur, p.whooshDecay);
             float whooshFreq = Mathf.Lerp(p.whooshFreqStart, p.whooshFreqEnd, normalizedT) * freqOffset;
             
-            float whooshNoise = Random.Range(-1f, 1f);
+            float whooshNoise = rng.Range(-1f, 1f);
             float whoosh = LowpassFilter(whooshNoise, whooshFreq, 0);
             whoosh = HighpassFilter(whoosh, whooshFreq * 0.3f, 0);
             whoosh *= whooshEnv * p.whooshAmount;
@@ -300,7 +307,7 @@ public class ProceduralEnemyMeleeAudio : MonoBehaviour
 
             // ===== NOISE BURST =====
             float noiseEnv = GetNoiseBurstEnvelope(t, dur, p.noiseDecay);
-            float whiteNoise = Random.Range(-1f, 1f);
+            float whiteNoise = rng.Range(-1f, 1f);
             noiseState = noiseState * 0.85f + whiteNoise * 0.15f;
             float noiseBurst = LowpassFilter(noiseState + whiteNoise * 0.5f, p.noiseCutoff * (1f - normalizedT * 0.5f), 1);
             noiseBurst *= noiseEnv * p.noiseBurst;
@@ -325,33 +332,14 @@ public class ProceduralEnemyMeleeAudio : MonoBehaviour
         }
 
         // Fade out
-        int fadeOutSamples = Mathf.Min(totalSamples / 6, sampleRate / 20);
-        for (int i = 0; i < fadeOutSamples; i++)
-        {
-            int idx = totalSamples - 1 - i;
-            float fade = (float)i / fadeOutSamples;
-            fade = fade * fade;
-            audioBuffer[idx] *= fade;
-        }
+        ProceduralDsp.FadeOutQuadratic(audioBuffer, totalSamples, Mathf.Min(totalSamples / 6, sampleRate / 20));
 
         // Normalize
-        float maxAmp = 0f;
-        for (int i = 0; i < totalSamples; i++)
-            maxAmp = Mathf.Max(maxAmp, Mathf.Abs(audioBuffer[i]));
+        ProceduralDsp.NormalizePeak(audioBuffer, totalSamples, 0.85f);
 
-        if (maxAmp > 0.01f)
-        {
-            float normalize = 0.85f / maxAmp;
-            for (int i = 0; i < totalSamples; i++)
-                audioBuffer[i] *= normalize;
-        }
-
-        AudioClip clip = AudioClip.Create("EnemyMelee", totalSamples, 1, sampleRate, false);
         float[] clipData = new float[totalSamples];
         System.Array.Copy(audioBuffer, clipData, totalSamples);
-        clip.SetData(clipData, 0);
-
-        return clip;
+        return clipData;
     }
 
     // =============== ENVELOPES ===============
@@ -414,25 +402,12 @@ public class ProceduralEnemyMeleeAudio : MonoBehaviour
 
     private float LowpassFilter(float input, float cutoff, int stateIndex)
     {
-        float rc = 1f / (2f * Mathf.PI * cutoff);
-        float dt = 1f / sampleRate;
-        float alpha = dt / (rc + dt);
-        alpha = Mathf.Clamp01(alpha);
-
-        lpState[stateIndex] += alpha * (input - lpState[stateIndex]);
-        return lpState[stateIndex];
+        return ProceduralDsp.OnePoleLowpass(ref lpState[stateIndex], input, cutoff, sampleRate);
     }
 
     private float HighpassFilter(float input, float cutoff, int stateIndex)
     {
-        float rc = 1f / (2f * Mathf.PI * cutoff);
-        float dt = 1f / sampleRate;
-        float alpha = rc / (rc + dt);
-
-        float output = alpha * (hpState[stateIndex] + input - lpState[stateIndex + 2]);
-        lpState[stateIndex + 2] = input;
-        hpState[stateIndex] = output;
-        return output;
+        return ProceduralDsp.OnePoleHighpass(ref lpState[stateIndex + 2], ref hpState[stateIndex], input, cutoff, sampleRate);
     }
 
     private float SoftClip(float x)
@@ -60,25 +60,27 @@ public class ProceduralEnemyProjectileHitAudio : MonoBehaviour
         public float flutterRate;
     }
 
-    private AudioSource audioSource;
     private int sampleRate;
     private float[] audioBuffer;
+
+    // Pre-rendered variations per sound type, shared by every instance (see ProceduralClipCache)
+    private static readonly ProceduralClipSet[] clipSets = new ProceduralClipSet[System.Enum.GetValues(typeof(EnemyHitSoundType)).Length];
+
     private float[] lpState = new float[4];
     private float[] hpState = new float[2];
 
+    // Shared instance used by the static PlayHit helper
+    private static ProceduralEnemyProjectileHitAudio instance;
+
     void Awake()
     {
-        audioSource = GetComponent<AudioSource>();
-        if (audioSource == null)
-            audioSource = gameObject.AddComponent<AudioSource>();
-            
-        audioSource.playOnAwake = false;
-        audioSource.loop = false;
-        audioSource.spatialBlend = 0f;
+        if (instance == null)
+            instance = this;
 
         sampleRate = AudioSettings.outputSampleRate;
-        int maxSamples = Mathf.CeilToInt(0.35f * sampleRate);
-        audioBuffer = new float[maxSamples];
+
+        // Render the default sound's variations while the scene loads instead of on the first hit
+        GetClipSet(soundType);
     }
 
     private EnemyHitPreset GetPreset(EnemyHitSoundType type)
@@ -204,21 +206,42 @@ public class ProceduralEnemyProjectileHitAudio : MonoBehaviour
     }
 
     public void PlayHitSound(EnemyHitSoundType type)
+    {
+        ProceduralClipCache.Play(GetClipSet(type), AudioVoiceCategory.Impact, volume, randomization * 0.5f);
+    }
+
+    /// <summary>
+    /// Pre-rendered variations for a hit type, rendered on first request
+    /// </summary>
+    private ProceduralClipSet GetClipSet(EnemyHitSoundType type)
+    {
+        int index = (int)type;
+        if (clipSets[index] == null)
+        {
+            clipSets[index] = ProceduralClipCache.GetSet("ProceduralEnemyProjectileHitAudio/" + type, rng => RenderHitVariation(type, rng));
+        }
+        return clipSets[index];
+    }
+
+    private float[] RenderHitVariation(EnemyHitSoundType type, System.Random rng)
     {
         EnemyHitPreset preset = GetPreset(type);
         
         // Apply randomization
-        float randMult = 1f + Random.Range(-randomization, randomization);
+        float randMult = 1f + rng.Range(-randomization, randomization);
         preset.impactFreq *= randMult;
         preset.bodyFreq *= randMult;
         preset.highFreq *= Mathf.Lerp(1f, randMult, 0.6f);
 
-        AudioClip clip = GenerateHitClip(preset);
-        audioSource.PlayOneShot(clip, volume);
+        return RenderHitClip(preset, rng);
     }
 
-    private AudioClip GenerateHitClip(EnemyHitPreset p)
+    private float[] RenderHitClip(EnemyHitPreset p, System.Random rng)
     {
+        // Scratch buffers are only needed by the instance that renders a set
+        if (audioBuffer == null)
+            audioBuffer = new float[Mathf.CeilToInt(0.35f * sampleRate)];
+
         int samples = Mathf.CeilToInt(p.duration * sampleRate);
         samples = Mathf.Min(samples, audioBuffer.Length);
 
@@ -227,7 +250,7 @@ public class ProceduralEnemyProjectileHitAudio : MonoBehaviour
         for (int i = 0; i < hpState.Length; i++) hpState[i] = 0;
 
         float phase1 = 0f, phase2 = 0f, phase3 = 0f;
-        float wetPhase = Random.Range(0f, Mathf.PI * 2f);
+        float wetPhase = rng.Range(0f, Mathf.PI * 2f);
 
         for (int i = 0; i < samples; i++)
         {
@@ -259,7 +282,7 @@ public class ProceduralEnemyProjectileHitAudio : MonoBehaviour
 
             // Noise (colored)
             float noiseEnv = Mathf.Exp(-t * p.noiseDecay);
-            float noise = Random.Range(-1f, 1f);
+            float noise = rng.Range(-1f, 1f);
             
             // Apply color (brown noise = low pass filtered)
             if (p.noiseColor > 0)
@@ -273,8 +296,8 @@ public class ProceduralEnemyProjectileHitAudio : MonoBehaviour
             if (p.hasWet)
             {
                 float wetEnv = Mathf.Exp(-t * 8f) * (1f - Mathf.Exp(-t * 50f));
-                wetPhase += (600f + Random.Range(-100f, 100f)) * 2f * Mathf.PI / sampleRate;
-                float wet = Mathf.Sin(wetPhase) * 0.5f + Random.Range(-0.5f, 0.5f);
+                wetPhase += (600f + rng.Range(-100f, 100f)) * 2f * Mathf.PI / sampleRate;
+                float wet = Mathf.Sin(wetPhase) * 0.5f + rng.Range(-0.5f, 0.5f);
                 wet = LowPassFilter(wet, 2000f, 2);
                 sample += wet * p.wetAmount * wetEnv;
             }
@@ -291,20 +314,14 @@ public class ProceduralEnemyProjectileHitAudio : MonoBehaviour
             audioBuffer[i] = sample;
         }
 
-        AudioClip clip = AudioClip.Create("EnemyProjectileHit", samples, 1, sampleRate, false);
         float[] finalBuffer = new float[samples];
         System.Array.Copy(audioBuffer, finalBuffer, samples);
-        clip.SetData(finalBuffer, 0);
-        return clip;
+        return finalBuffer;
     }
 
     private float LowPassFilter(float input, float cutoff, int stateIndex)
     {
-        float rc = 1f / (2f * Mathf.PI * cutoff);
-        float dt = 1f / sampleRate;
-        float alpha = dt / (rc + dt);
-        lpState[stateIndex] = lpState[stateIndex] + alpha * (input - lpState[stateIndex]);
-        return lpState[stateIndex];
+        return ProceduralDsp.OnePoleLowpass(ref lpState[stateIndex], input, cutoff, sampleRate);
     }
 
     private float ApplyDistortion(float x, float amount)
@@ -324,19 +341,16 @@ public class ProceduralEnemyProjectileHitAudio : MonoBehaviour
     // Static helper to play hit sound at position
     public static void PlayHit(Vector3 position, EnemyHitSoundType type = EnemyHitSoundType.PlasmaImpact, float vol = 0.45f)
     {
-        GameObject temp = new GameObject("EnemyProjectileHitSound");
-        temp.transform.position = position;
-        
-        AudioSource source = temp.AddComponent<AudioSource>();
-        source.spatialBlend = 0.5f;
-        source.rolloffMode = AudioRolloffMode.Linear;
-        source.maxDistance = 30f;
-        
-        ProceduralEnemyProjectileHitAudio hitAudio = temp.AddComponent<ProceduralEnemyProjectileHitAudio>();
-        hitAudio.volume = vol;
-        hitAudio.soundType = type;
-        hitAudio.PlayHitSound();
-        
-        Destroy(temp, 0.5f);
+        EnsureInstance();
+        ProceduralClipCache.PlayAt(instance.GetClipSet(type), AudioVoiceCategory.Impact, position, vol, instance.randomization * 0.5f);
+    }
+
+    private static void EnsureInstance()
+    {
+        if (instance != null) return;
+
+        GameObject obj = new GameObject("EnemyProjectileHitAudio");
+        DontDestroyOnLoad(obj);
+        instance = obj.AddComponent<ProceduralEnemyProjectileHitAudio>();
     }
 }
@@ -4,8 +4,8 @@ using UnityEngine;
 /// Procedural walk/movement sound generator for enemies.
 /// Generates distinct alien/monster footstep sounds different from the player.
 /// Triggers based on movement velocity rather than hop state.
+/// Stepped by EnemySimulationManager, which skips enemies outside the camera view.
 /// </summary>
-[RequireComponent(typeof(AudioSource))]
 public class ProceduralEnemyWalkAudio : MonoBehaviour
 {
     public enum EnemyWalkSoundType
@@ -66,12 +66,13 @@ public class ProceduralEnemyWalkAudio : MonoBehaviour
         public float wetAmount;
     }
 
-    private WalkPreset currentPreset;
-    private AudioSource audioSource;
     private Rigidbody2D rb;
     private int sampleRate;
     private float[] audioBuffer;
 
+    // Pre-rendered variations per sound type, shared by every instance (see ProceduralClipCache)
+    private static readonly ProceduralClipSet[] clipSets = new ProceduralClipSet[System.Enum.GetValues(typeof(EnemyWalkSoundType)).Length];
+
     private float[] lpState = new float[4];
     private float[] hpState = new float[4];  // High-pass filter state
     private float stepTimer;
@@ -84,19 +85,26 @@ public class ProceduralEnemyWalkAudio : MonoBehaviour
     private const float MAX_AUDIBLE_DISTANCE = 20f;
     private const float MIN_AUDIBLE_DISTANCE = 3f;
 
+    /// <summary>
+    /// Slot in EnemySimulationManager while enabled (-1 when not registered)
+    /// </summary>
+    public int SimulationIndex { get; set; } = -1;
+
+    /// <summary>
+    /// World position used for the manager's visibility test
+    /// </summary>
+    public Vector2 Position => rb != null ? rb.position : (Vector2)transform.position;
+
     void Awake()
     {
-        audioSource = GetComponent<AudioSource>();
-        audioSource.playOnAwake = false;
-        audioSource.loop = false;
-
         rb = GetComponent<Rigidbody2D>();
 
         sampleRate = AudioSettings.outputSampleRate;
-        int maxSamples = Mathf.CeilToInt(0.4f * sampleRate);
-        audioBuffer = new float[maxSamples];
 
         stepTimer = Random.Range(0f, baseStepInterval); // Randomize initial offset
+
+        // Render step variations up front (shared by every enemy with this sound type)
+        GetClipSet(soundType);
         
         activeEnemyCount++;
         
@@ -107,6 +115,16 @@ public class ProceduralEnemyWalkAudio : MonoBehaviour
         }
     }
     
+    void OnEnable()
+    {
+        EnemySimulationManager.Register(this);
+    }
+
+    void OnDisable()
+    {
+        EnemySimulationManager.Unregister(this);
+    }
+
     void OnDestroy()
     {
         activeEnemyCount = Mathf.Max(0, activeEnemyCount - 1);
@@ -237,7 +255,10 @@ public class ProceduralEnemyWalkAudio : MonoBehaviour
         return p;
     }
 
-    void Update()
+    /// <summary>
+    /// Per-frame step timing, called by EnemySimulationManager
+    /// </summary>
+    public void SimulationUpdate(float deltaTime)
     {
         if (rb == null) return;
 
@@ -256,7 +277,7 @@ public class ProceduralEnemyWalkAudio : MonoBehaviour
         float speedFactor = Mathf.Clamp(speed / 5f, 0.5f, 2f);
         float currentInterval = baseStepInterval / speedFactor;
 
-        stepTimer -= Time.deltaTime;
+        stepTimer -= deltaTime;
         if (stepTimer <= 0f)
         {
             PlayStep();
@@ -283,22 +304,36 @@ public class ProceduralEnemyWalkAudio : MonoBehaviour
         // Reduce volume when many enemies are active
         float crowdAttenuation = 1f / (1f + activeEnemyCount * 0.1f);
         
-        currentPreset = GetPreset(soundType);
-        AudioClip clip = GenerateStepClip();
-        
         // Scale volume slightly by speed
         float speedVolume = Mathf.Lerp(0.7f, 1f, Mathf.Clamp01(lastSpeed / 5f));
         float finalVolume = volume * speedVolume * distanceVolume * crowdAttenuation;
         
-        audioSource.PlayOneShot(clip, finalVolume);
+        ProceduralClipCache.Play(GetClipSet(soundType), AudioVoiceCategory.EnemyMovement, finalVolume, randomization * 0.5f);
+    }
+
+    /// <summary>
+    /// Pre-rendered variations for a walk sound type, rendered on first request
+    /// </summary>
+    private ProceduralClipSet GetClipSet(EnemyWalkSoundType type)
+    {
+        int index = (int)type;
+        if (clipSets[index] == null)
+        {
+            WalkPreset preset = GetPreset(type);
+            clipSets[index] = ProceduralClipCache.GetSet("ProceduralEnemyWalkAudio/" + type, rng => RenderStepClip(preset, rng));
+        }
+        return clipSets[index];
     }
 
-    private AudioClip GenerateStepClip()
+    private float[] RenderStepClip(WalkPreset p, System.Random rng)
     {
-        WalkPreset p = currentPreset;
+        // Scratch buffers are only needed by the instance that renders a set
+        if (audioBuffer == null)
+            audioBuffer = new float[Mathf.CeilToInt(0.4f * sampleRate)];
+
         float rnd = randomization;
 
-        float dur = p.duration * (1f + Random.Range(-rnd * 0.3f, rnd * 0.3f));
+        float dur = p.duration * (1f + rng.Range(-rnd * 0.3f, rnd * 0.3f));
         int totalSamples = Mathf.CeilToInt(dur * sampleRate);
         totalSamples = Mathf.Min(totalSamples, audioBuffer.Length);
 
@@ -311,8 +346,8 @@ public class ProceduralEnemyWalkAudio : MonoBehaviour
         float phaseClick = 0f;
         float noiseState = 0f;
 
-        float freqOffset = Random.Range(0.9f, 1.1f);
-        float secondaryDelayRnd = p.secondaryDelay * (1f + Random.Range(-rnd, rnd));
+        float freqOffset = rng.Range(0.9f, 1.1f);
+        float secondaryDelayRnd = p.secondaryDelay * (1f + rng.Range(-rnd, rnd));
 
         for (int i = 0; i < totalSamples; i++)
         {
@@ -351,7 +386,7 @@ public class ProceduralEnemyWalkAudio : MonoBehaviour
 
             // ===== NOISE =====
             float noiseEnv = GetNoiseEnvelope(t, dur, p.noiseDecay);
-            float whiteNoise = Random.Range(-1f, 1f);
+            float whiteNoise = rng.Range(-1f, 1f);
             noiseState = noiseState * (0.9f + p.noiseColor * 0.09f) + whiteNoise * (0.1f - p.noiseColor * 0.09f);
             float coloredNoise = noiseState * p.noiseColor + whiteNoise * (1f - p.noiseColor);
             float noise = LowpassFilter(coloredNoise, p.noiseCutoff * (1f - normalizedT * 0.4f), 0);
@@ -372,7 +407,7 @@ public class ProceduralEnemyWalkAudio : MonoBehaviour
             if (p.hasWet)
             {
                 float wetEnv = GetWetEnvelope(t, dur);
-                float wetNoise = LowpassFilter(Random.Range(-1f, 1f), 400f + 800f * (1f - normalizedT), 1);
+                float wetNoise = LowpassFilter(rng.Range(-1f, 1f), 400f + 800f * (1f - normalizedT), 1);
                 wet = wetNoise * wetEnv * p.wetAmount;
             }
 
@@ -389,33 +424,14 @@ public class ProceduralEnemyWalkAudio : MonoBehaviour
         }
 
         // Fade out
-        int fadeOutSamples = Mathf.Min(totalSamples / 5, sampleRate / 25);
-        for (int i = 0; i < fadeOutSamples; i++)
-        {
-            int idx = totalSamples - 1 - i;
-            float fade = (float)i / fadeOutSamples;
-            fade = fade * fade;
-            audioBuffer[idx] *= fade;
-        }
+        ProceduralDsp.FadeOutQuadratic(audioBuffer, totalSamples, Mathf.Min(totalSamples / 5, sampleRate / 25));
 
         // Normalize with headroom to prevent clipping
-        float maxAmp = 0f;
-        for (int i = 0; i < totalSamples; i++)
-            maxAmp = Mathf.Max(maxAmp, Mathf.Abs(audioBuffer[i]));
-
-        if (maxAmp > 0.01f)
-        {
-            float normalize = 0.65f / maxAmp;  // Leave more headroom
-            for (int i = 0; i < totalSamples; i++)
-                audioBuffer[i] *= normalize;
-        }
+        ProceduralDsp.NormalizePeak(audioBuffer, totalSamples, 0.65f);
 
-        AudioClip clip = AudioClip.Create("EnemyStep", totalSamples, 1, sampleRate, false);
         float[] clipData = new float[totalSamples];
         System.Array.Copy(audioBuffer, clipData, totalSamples);
-        clip.SetData(clipData, 0);
-
-        return clip;
+        return clipData;
     }
 
     // =============== ENVELOPES ===============
@@ -485,26 +501,12 @@ public class ProceduralEnemyWalkAudio : MonoBehaviour
 
     private float LowpassFilter(float input, float cutoff, int stateIndex)
     {
-        float rc = 1f / (2f * Mathf.PI * cutoff);
-        float dt = 1f / sampleRate;
-        float alpha = dt / (rc + dt);
-        alpha = Mathf.Clamp01(alpha);
-
-        lpState[stateIndex] += alpha * (input - lpState[stateIndex]);
-        return lpState[stateIndex];
+        return ProceduralDsp.OnePoleLowpass(ref lpState[stateIndex], input, cutoff, sampleRate);
     }
 
     private float HighpassFilter(float input, float cutoff, int stateIndex)
     {
-        float rc = 1f / (2f * Mathf.PI * cutoff);
-        float dt = 1f / sampleRate;
-        float alpha = rc / (rc + dt);
-        alpha = Mathf.Clamp01(alpha);
-
-        float output = alpha * (hpState[stateIndex + 2] + input - hpState[stateIndex]);
-        hpState[stateIndex] = input;
-        hpState[stateIndex + 2] = output;
-        return output;
+        return ProceduralDsp.OnePoleHighpass(ref hpState[stateIndex], ref hpState[stateIndex + 2], input, cutoff, sampleRate);
     }
 
     private float SoftClip(float x)
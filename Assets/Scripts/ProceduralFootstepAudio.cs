@@ -4,7 +4,6 @@ using UnityEngine;
 /// Procedural footstep sound generator using synthesized audio.
 /// Generates soft "thump" sounds when the character lands.
 /// </summary>
-[RequireComponent(typeof(AudioSource))]
 public class ProceduralFootstepAudio : MonoBehaviour
 {
     [Header("References")]
@@ -34,20 +33,12 @@ public class ProceduralFootstepAudio : MonoBehaviour
     [Range(100f, 2000f)]
     [SerializeField] private float lowPassCutoff = 400f;
 
-    private AudioSource audioSource;
     private ShuffleWalkVisual.HopState lastState;
     private float[] audioBuffer;
     private int sampleRate;
-    
-    // Simple low-pass filter state
-    private float filterState;
 
     void Awake()
     {
-        audioSource = GetComponent<AudioSource>();
-        audioSource.playOnAwake = false;
-        audioSource.loop = false;
-        
         sampleRate = AudioSettings.outputSampleRate;
         
         // Pre-allocate buffer for max duration
@@ -75,73 +66,94 @@ public class ProceduralFootstepAudio : MonoBehaviour
 
     public void PlayFootstep()
     {
-        AudioClip clip = GenerateFootstepClip();
-        audioSource.PlayOneShot(clip, volume);
+        ProceduralStreamState step = CreateStep();
+
+        // Synthesized on the audio thread while it plays where the streaming mixer exists
+        if (ProceduralAudioMixer.Supported)
+        {
+            ProceduralAudioMixer.PlayStream(ProceduralVoiceKind.Footstep, step, AudioVoiceCategory.PlayerMovement, volume);
+            return;
+        }
+
+        AudioClip clip = GenerateFootstepClip(step);
+        AudioVoiceManager.Play(clip, AudioVoiceCategory.PlayerMovement, volume);
     }
 
-    private AudioClip GenerateFootstepClip()
+    /// <summary>
+    /// Randomized parameters for one footstep
+    /// (p0 frequency, p1 duration, p2 gain, p3 noise mix, p4 lowpass coefficient; s0 filter state)
+    /// </summary>
+    private ProceduralStreamState CreateStep()
     {
-        // Add variation
-        float freq = baseFrequency * (1f + Random.Range(-frequencyVariation, frequencyVariation));
-        float vol = 1f - Random.Range(0f, volumeVariation);
         float dur = duration * Random.Range(0.85f, 1.15f);
-        
-        int numSamples = Mathf.CeilToInt(dur * sampleRate);
-        numSamples = Mathf.Min(numSamples, audioBuffer.Length);
-        
-        // Reset filter
-        filterState = 0f;
-        
+
         // Low-pass filter coefficient (simple one-pole)
         float rc = 1f / (2f * Mathf.PI * lowPassCutoff);
         float dt = 1f / sampleRate;
-        float alpha = dt / (rc + dt);
-        
-        for (int i = 0; i < numSamples; i++)
+
+        return new ProceduralStreamState
         {
-            float t = (float)i / sampleRate;
-            float envelope = GetEnvelope(t, dur);
-            
-            // Base tone (sine wave with slight frequency decay for "thump")
-            float freqDecay = freq * Mathf.Exp(-t * 15f); // Frequency drops quickly
-            float phase = 2f * Mathf.PI * freqDecay * t;
-            float tone = Mathf.Sin(phase);
-            
-            // Add some harmonics for body
-            tone += 0.3f * Mathf.Sin(phase * 2f);
-            tone += 0.1f * Mathf.Sin(phase * 3f);
-            
-            // Noise component for texture
-            float noise = Random.Range(-1f, 1f);
-            
-            // Mix tone and noise
-            float sample = Mathf.Lerp(tone, noise, noiseMix);
-            
-            // Apply envelope
-            sample *= envelope * vol;
-            
-            // Simple low-pass filter
-            filterState += alpha * (sample - filterState);
-            sample = filterState;
-            
-            // Soft clip to prevent harsh peaks
-            sample = SoftClip(sample);
-            
-            audioBuffer[i] = sample;
-        }
-        
+            length = Mathf.Min(Mathf.CeilToInt(dur * sampleRate), audioBuffer.Length),
+            p0 = baseFrequency * (1f + Random.Range(-frequencyVariation, frequencyVariation)),
+            p1 = dur,
+            p2 = 1f - Random.Range(0f, volumeVariation),
+            p3 = noiseMix,
+            p4 = dt / (rc + dt),
+            rng = (uint)Random.Range(1, int.MaxValue)
+        };
+    }
+
+    /// <summary>
+    /// Sample i of a footstep. Runs on the audio thread (ProceduralAudioMixer) or in GenerateFootstepClip.
+    /// </summary>
+    public static float NextSample(ref ProceduralStreamState s, int i, float sampleRate)
+    {
+        float t = i / sampleRate;
+        float envelope = GetEnvelope(t, s.p1);
+
+        // Base tone (sine wave with slight frequency decay for "thump")
+        float freqDecay = s.p0 * Mathf.Exp(-t * 15f); // Frequency drops quickly
+        float phase = 2f * Mathf.PI * freqDecay * t;
+        float tone = Mathf.Sin(phase);
+
+        // Add some harmonics for body
+        tone += 0.3f * Mathf.Sin(phase * 2f);
+        tone += 0.1f * Mathf.Sin(phase * 3f);
+
+        // Noise component for texture
+        float noise = s.NextNoise();
+
+        // Mix tone and noise
+        float sample = Mathf.Lerp(tone, noise, s.p3);
+
+        // Apply envelope
+        sample *= envelope * s.p2;
+
+        // Simple low-pass filter
+        s.s0 += s.p4 * (sample - s.s0);
+
+        // Soft clip to prevent harsh peaks
+        return SoftClip(s.s0);
+    }
+
+    private AudioClip GenerateFootstepClip(ProceduralStreamState step)
+    {
+        int numSamples = step.length;
+        for (int i = 0; i < numSamples; i++)
+            audioBuffer[i] = NextSample(ref step, i, sampleRate);
+
         // Create AudioClip from buffer
         AudioClip clip = AudioClip.Create("Footstep", numSamples, 1, sampleRate, false);
-        
+
         // Copy only the samples we need
         float[] clipData = new float[numSamples];
         System.Array.Copy(audioBuffer, clipData, numSamples);
         clip.SetData(clipData, 0);
-        
+
         return clip;
     }
 
-    private float GetEnvelope(float time, float totalDuration)
+    private static float GetEnvelope(float time, float totalDuration)
     {
         // Quick attack, exponential decay - like a soft impact
         float attackTime = 0.005f;
@@ -160,7 +172,7 @@ public class ProceduralFootstepAudio : MonoBehaviour
         }
     }
 
-    private float SoftClip(float x)
+    private static float SoftClip(float x)
     {
         // Soft saturation using tanh-like function
         if (x > 1f) return 1f;
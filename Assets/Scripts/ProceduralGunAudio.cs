@@ -5,7 +5,6 @@ using UnityEngine;
 /// complex modulation, room simulation, and punch compression.
 /// Each gun type has a completely unique sound signature.
 /// </summary>
-[RequireComponent(typeof(AudioSource))]
 public class ProceduralGunAudio : MonoBehaviour
 {
     public enum GunSoundType
@@ -70,68 +69,38 @@ public class ProceduralGunAudio : MonoBehaviour
         public float pitchSweepAmount;
     }
 
-    private GunPreset currentPreset;
-
-    private AudioSource audioSource;
     private int sampleRate;
     private float[] audioBuffer;
 
+    // Pre-rendered variations per sound type, shared by every instance (see ProceduralClipCache)
+    private static readonly ProceduralClipSet[] clipSets = new ProceduralClipSet[System.Enum.GetValues(typeof(GunSoundType)).Length];
+
     // Multi-stage filter states
     private float[] lpState = new float[4];
     private float[] hpState = new float[2];
     private float[] bpState = new float[4];
 
-    // Allpass delays for reverb
-    private float[][] allpassBuffers;
-    private int[] allpassIndices;
-    private float[][] combBuffers;
-    private int[] combIndices;
+    // Reverb
+    private SchroederReverb reverb;
 
     // Compressor state
     private float compEnvelope;
 
     void Awake()
     {
-        audioSource = GetComponent<AudioSource>();
-        audioSource.playOnAwake = false;
-        audioSource.loop = false;
-
         sampleRate = AudioSettings.outputSampleRate;
 
-        int maxSamples = Mathf.CeilToInt(1.5f * sampleRate);
-        audioBuffer = new float[maxSamples];
-
-        InitializeReverb();
+        // Render this gun's variations while the scene loads instead of on the first shot
+        GetClipSet(soundType);
     }
 
     private void InitializeReverb()
     {
-        int[] allpassDelays = { 347, 113, 37, 59 };
-        int[] combDelays = { 1687, 1601, 2053, 2251, 1777, 1949 };
-
-        allpassBuffers = new float[allpassDelays.Length][];
-        allpassIndices = new int[allpassDelays.Length];
-        for (int i = 0; i < allpassDelays.Length; i++)
-        {
-            allpassBuffers[i] = new float[allpassDelays[i]];
-            allpassIndices[i] = 0;
-        }
-
-        combBuffers = new float[combDelays.Length][];
-        combIndices = new int[combDelays.Length];
-        for (int i = 0; i < combDelays.Length; i++)
-        {
-            combBuffers[i] = new float[combDelays[i]];
-            combIndices[i] = 0;
-        }
-    }
-
-    private void ClearReverb()
-    {
-        for (int i = 0; i < allpassBuffers.Length; i++)
-            System.Array.Clear(allpassBuffers[i], 0, allpassBuffers[i].Length);
-        for (int i = 0; i < combBuffers.Length; i++)
-            System.Array.Clear(combBuffers[i], 0, combBuffers[i].Length);
+        reverb = new SchroederReverb(
+            new[] { 1687, 1601, 2053, 2251, 1777, 1949 },
+            new[] { 0.84f, 0.82f, 0.81f, 0.79f, 0.78f, 0.77f },
+            new[] { 347, 113, 37, 59 },
+            0.5f);
     }
 
     private GunPreset GetPreset(GunSoundType type)
@@ -289,28 +258,43 @@ public class ProceduralGunAudio : MonoBehaviour
         return p;
     }
 
+    /// <summary>
+    /// Pre-rendered variations for a gun type, rendered on first request
+    /// </summary>
+    private ProceduralClipSet GetClipSet(GunSoundType type)
+    {
+        int index = (int)type;
+        if (clipSets[index] == null)
+        {
+            GunPreset preset = GetPreset(type);
+            clipSets[index] = ProceduralClipCache.GetSet("ProceduralGunAudio/" + type, rng => RenderGunClip(preset, rng));
+        }
+        return clipSets[index];
+    }
+
     public void PlayGunSound()
     {
-        currentPreset = GetPreset(soundType);
-        AudioClip clip = GenerateGunClip();
-        audioSource.PlayOneShot(clip, volume);
+        PlayGunSound(1f);
     }
 
     public void PlayGunSound(float volumeMultiplier)
     {
-        currentPreset = GetPreset(soundType);
-        AudioClip clip = GenerateGunClip();
-        audioSource.PlayOneShot(clip, volume * volumeMultiplier);
+        ProceduralClipCache.Play(GetClipSet(soundType), AudioVoiceCategory.PlayerWeapon, volume * volumeMultiplier, randomization * 0.5f);
     }
 
-    private AudioClip GenerateGunClip()
+    private float[] RenderGunClip(GunPreset p, System.Random rng)
     {
-        GunPreset p = currentPreset;
+        // Scratch buffers are only needed by the instance that renders a set
+        if (audioBuffer == null)
+            audioBuffer = new float[Mathf.CeilToInt(1.5f * sampleRate)];
+        if (reverb == null)
+            InitializeReverb();
+
         float rnd = randomization;
         
         // Apply randomization to key parameters
-        float dur = p.duration * (1f + Random.Range(-rnd * 0.3f, rnd * 0.3f));
-        float roomR = p.roomSize * (1f + Random.Range(-rnd, rnd));
+        float dur = p.duration * (1f + rng.Range(-rnd * 0.3f, rnd * 0.3f));
+        float roomR = p.roomSize * (1f + rng.Range(-rnd, rnd));
         
         int numSamples = Mathf.CeilToInt(dur * sampleRate);
         int totalSamples = Mathf.CeilToInt((dur + roomR * 0.5f) * sampleRate);
@@ -321,7 +305,7 @@ public class ProceduralGunAudio : MonoBehaviour
         System.Array.Clear(lpState, 0, lpState.Length);
         System.Array.Clear(hpState, 0, hpState.Length);
         System.Array.Clear(bpState, 0, bpState.Length);
-        ClearReverb();
+        reverb.Clear();
         compEnvelope = 0f;
 
         // Phase accumulators
@@ -330,12 +314,12 @@ public class ProceduralGunAudio : MonoBehaviour
         float noiseState = 0f;
 
         // Randomized offsets for this shot
-        float freqOffset1 = Random.Range(0.92f, 1.08f);
-        float freqOffset2 = Random.Range(0.90f, 1.10f);
-        float mechOffset = Random.Range(0.95f, 1.05f);
+        float freqOffset1 = rng.Range(0.92f, 1.08f);
+        float freqOffset2 = rng.Range(0.90f, 1.10f);
+        float mechOffset = rng.Range(0.95f, 1.05f);
         
         // Shotgun double-click timing
-        float clickTime = 0.025f + Random.Range(0f, 0.01f);
+        float clickTime = 0.025f + rng.Range(0f, 0.01f);
 
         for (int i = 0; i < totalSamples; i++)
         {
@@ -414,7 +398,7 @@ public class ProceduralGunAudio : MonoBehaviour
                 // ========== LAYER 4: NOISE ==========
                 float noiseEnv = GetNoiseEnvelope(t, dur, p.noiseDecay);
                 
-                float whiteNoise = Random.Range(-1f, 1f);
+                float whiteNoise = rng.Range(-1f, 1f);
                 noiseState = noiseState * 0.97f + whiteNoise * 0.03f;
                 float pinkish = noiseState + whiteNoise * 0.4f;
                 
@@ -426,7 +410,7 @@ public class ProceduralGunAudio : MonoBehaviour
 
                 // ========== LAYER 5: AIR ==========
                 float airEnv = GetAirEnvelope(t, dur);
-                float airNoise = LowpassFilter(Random.Range(-1f, 1f), 350f + 150f * (1f - normalizedT), 1);
+                float airNoise = LowpassFilter(rng.Range(-1f, 1f), 350f + 150f * (1f - normalizedT), 1);
                 float air = airNoise * airEnv * p.subAmount * 0.15f;
 
                 // ========== COMBINE ==========
@@ -436,44 +420,25 @@ public class ProceduralGunAudio : MonoBehaviour
                 sample = PunchCompress(sample, p.punch);
             }
 
-            // ========== REVERB ==========
-            float wet = ProcessReverb(sample) * roomR;
-            sample = sample * (1f - roomR * 0.25f) + wet;
-
-            // ========== LIMIT ==========
-            sample = FinalLimit(sample);
-
             audioBuffer[i] = sample;
         }
 
+        // ========== REVERB ==========
+        reverb.ProcessBlock(audioBuffer, totalSamples, roomR, 1f - roomR * 0.25f);
+
+        // ========== LIMIT ==========
+        for (int i = 0; i < totalSamples; i++)
+            audioBuffer[i] = FinalLimit(audioBuffer[i]);
+
         // Fade out
-        int fadeOutSamples = Mathf.Min(totalSamples / 6, sampleRate / 15);
-        for (int i = 0; i < fadeOutSamples; i++)
-        {
-            int idx = totalSamples - 1 - i;
-            float fade = (float)i / fadeOutSamples;
-            fade = fade * fade;
-            audioBuffer[idx] *= fade;
-        }
+        ProceduralDsp.FadeOutQuadratic(audioBuffer, totalSamples, Mathf.Min(totalSamples / 6, sampleRate / 15));
 
         // Normalize
-        float maxAmp = 0f;
-        for (int i = 0; i < totalSamples; i++)
-            maxAmp = Mathf.Max(maxAmp, Mathf.Abs(audioBuffer[i]));
-        
-        if (maxAmp > 0.01f)
-        {
-            float normalize = 0.92f / maxAmp;
-            for (int i = 0; i < totalSamples; i++)
-                audioBuffer[i] *= normalize;
-        }
+        ProceduralDsp.NormalizePeak(audioBuffer, totalSamples, 0.92f);
 
-        AudioClip clip = AudioClip.Create("GunShot", totalSamples, 1, sampleRate, false);
         float[] clipData = new float[totalSamples];
         System.Array.Copy(audioBuffer, clipData, totalSamples);
-        clip.SetData(clipData, 0);
-
-        return clip;
+        return clipData;
     }
 
     // =============== ENVELOPES ===============
@@ -563,46 +528,17 @@ public class ProceduralGunAudio : MonoBehaviour
 
     private float LowpassFilter(float input, float cutoff, int stateIndex)
     {
-        float rc = 1f / (2f * Mathf.PI * cutoff);
-        float dt = 1f / sampleRate;
-        float alpha = dt / (rc + dt);
-        alpha = Mathf.Clamp01(alpha);
-        
-        lpState[stateIndex] += alpha * (input - lpState[stateIndex]);
-        return lpState[stateIndex];
+        return ProceduralDsp.OnePoleLowpass(ref lpState[stateIndex], input, cutoff, sampleRate);
     }
 
     private float HighpassFilter(float input, float cutoff, int stateIndex)
     {
-        float rc = 1f / (2f * Mathf.PI * cutoff);
-        float dt = 1f / sampleRate;
-        float alpha = rc / (rc + dt);
-        
-        float output = alpha * (hpState[stateIndex] + input - lpState[stateIndex + 2]);
-        lpState[stateIndex + 2] = input;
-        hpState[stateIndex] = output;
-        return output;
+        return ProceduralDsp.OnePoleHighpass(ref lpState[stateIndex + 2], ref hpState[stateIndex], input, cutoff, sampleRate);
     }
 
     private float BandpassFilter(float input, float centerFreq, float q, int stateIndex)
     {
-        float w0 = 2f * Mathf.PI * centerFreq / sampleRate;
-        float alpha = Mathf.Sin(w0) / (2f * q);
-        
-        float b0 = alpha;
-        float a1 = -2f * Mathf.Cos(w0);
-        float a2 = 1f - alpha;
-        float norm = 1f + alpha;
-        
-        b0 /= norm;
-        a1 /= norm;
-        a2 /= norm;
-        
-        float output = b0 * input - a1 * bpState[stateIndex] - a2 * bpState[stateIndex + 1];
-        bpState[stateIndex + 1] = bpState[stateIndex];
-        bpState[stateIndex] = output;
-        
-        return output;
+        return ProceduralDsp.ResonantBandpass(ref bpState[stateIndex], ref bpState[stateIndex + 1], input, centerFreq, q, sampleRate);
     }
 
     // =============== SATURATION ===============
@@ -647,41 +583,6 @@ public class ProceduralGunAudio : MonoBehaviour
         return input * gainReduction * makeupGain;
     }
 
-    // =============== REVERB ===============
-
-    private float ProcessReverb(float input)
-    {
-        // Comb filters in parallel
-        float combOut = 0f;
-        float[] combFeedback = { 0.84f, 0.82f, 0.81f, 0.79f, 0.78f, 0.77f };
-        
-        for (int i = 0; i < combBuffers.Length; i++)
-        {
-            int idx = combIndices[i];
-            float delayed = combBuffers[i][idx];
-            combBuffers[i][idx] = input + delayed * combFeedback[i];
-            combIndices[i] = (idx + 1) % combBuffers[i].Length;
-            combOut += delayed;
-        }
-        combOut /= combBuffers.Length;
-        
-        // Allpass filters in series
-        float allpassOut = combOut;
-        float allpassFeedback = 0.5f;
-        
-        for (int i = 0; i < allpassBuffers.Length; i++)
-        {
-            int idx = allpassIndices[i];
-            float delayed = allpassBuffers[i][idx];
-            float temp = -allpassFeedback * allpassOut + delayed;
-            allpassBuffers[i][idx] = allpassOut + allpassFeedback * temp;
-            allpassIndices[i] = (idx + 1) % allpassBuffers[i].Length;
-            allpassOut = temp;
-        }
-        
-        return allpassOut;
-    }
-
     // =============== FINAL LIMITING ===============
 
     private float FinalLimit(float x)
@@ -3,28 +3,23 @@ using UnityEngine;
 /// <summary>
 /// Procedural audio for level up fanfare - triumphant ascending tones with sparkle.
 /// </summary>
-[RequireComponent(typeof(AudioSource))]
 public class ProceduralLevelUpAudio : MonoBehaviour
 {
     [Header("Volume")]
     [Range(0f, 1f)]
     [SerializeField] private float volume = 0.8f;
 
-    private AudioSource audioSource;
     private int sampleRate;
 
     void Awake()
     {
-        audioSource = GetComponent<AudioSource>();
-        audioSource.playOnAwake = false;
-        audioSource.loop = false;
         sampleRate = AudioSettings.outputSampleRate;
     }
 
     public void PlayLevelUpSound()
     {
         AudioClip clip = GenerateLevelUpClip();
-        audioSource.PlayOneShot(clip, volume);
+        AudioVoiceManager.Play(clip, AudioVoiceCategory.UI, volume);
     }
 
     private AudioClip GenerateLevelUpClip()
@@ -85,16 +80,7 @@ public class ProceduralLevelUpAudio : MonoBehaviour
         }
 
         // Normalize
-        float maxAmp = 0f;
-        for (int i = 0; i < numSamples; i++)
-            maxAmp = Mathf.Max(maxAmp, Mathf.Abs(audioBuffer[i]));
-
-        if (maxAmp > 0.01f)
-        {
-            float normalize = 0.85f / maxAmp;
-            for (int i = 0; i < numSamples; i++)
-                audioBuffer[i] *= normalize;
-        }
+        ProceduralDsp.NormalizePeak(audioBuffer, numSamples, 0.85f);
 
         // Fade out last 10%
         int fadeStart = (int)(numSamples * 0.9f);
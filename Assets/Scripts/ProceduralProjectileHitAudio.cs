@@ -55,9 +55,12 @@ public class ProceduralProjectileHitAudio : MonoBehaviour
         public float thumpAmount;
     }
 
-    private AudioSource audioSource;
     private int sampleRate;
     private float[] audioBuffer;
+
+    // Pre-rendered variations per sound type, shared by every instance (see ProceduralClipCache)
+    private static readonly ProceduralClipSet[] clipSets = new ProceduralClipSet[System.Enum.GetValues(typeof(HitSoundType)).Length];
+
     private float[] lpState = new float[4];
 
     private static ProceduralProjectileHitAudio instance;
@@ -68,17 +71,10 @@ public class ProceduralProjectileHitAudio : MonoBehaviour
         if (instance == null)
             instance = this;
 
-        audioSource = GetComponent<AudioSource>();
-        if (audioSource == null)
-            audioSource = gameObject.AddComponent<AudioSource>();
-            
-        audioSource.playOnAwake = false;
-        audioSource.loop = false;
-        audioSource.spatialBlend = 0f; // 2D sound
-
         sampleRate = AudioSettings.outputSampleRate;
-        int maxSamples = Mathf.CeilToInt(0.3f * sampleRate);
-        audioBuffer = new float[maxSamples];
+
+        // Render the default sound's variations while the scene loads instead of on the first hit
+        GetClipSet(soundType);
     }
 
     private HitPreset GetPreset(HitSoundType type)
@@ -187,21 +183,42 @@ public class ProceduralProjectileHitAudio : MonoBehaviour
     }
 
     public void PlayHitSound(HitSoundType type)
+    {
+        ProceduralClipCache.Play(GetClipSet(type), AudioVoiceCategory.Impact, volume, randomization * 0.5f);
+    }
+
+    /// <summary>
+    /// Pre-rendered variations for a hit type, rendered on first request
+    /// </summary>
+    private ProceduralClipSet GetClipSet(HitSoundType type)
+    {
+        int index = (int)type;
+        if (clipSets[index] == null)
+        {
+            clipSets[index] = ProceduralClipCache.GetSet("ProceduralProjectileHitAudio/" + type, rng => RenderHitVariation(type, rng));
+        }
+        return clipSets[index];
+    }
+
+    private float[] RenderHitVariation(HitSoundType type, System.Random rng)
     {
         HitPreset preset = GetPreset(type);
         
         // Apply randomization
-        float randMult = 1f + Random.Range(-randomization, randomization);
+        float randMult = 1f + rng.Range(-randomization, randomization);
         preset.impactFreq *= randMult;
         preset.bodyFreq *= randMult;
         preset.sizzleFreq *= Mathf.Lerp(1f, randMult, 0.5f);
 
-        AudioClip clip = GenerateHitClip(preset);
-        audioSource.PlayOneShot(clip, volume);
+        return RenderHitClip(preset, rng);
     }
 
-    private AudioClip GenerateHitClip(HitPreset p)
+    private float[] RenderHitClip(HitPreset p, System.Random rng)
     {
+        // Scratch buffers are only needed by the instance that renders a set
+        if (audioBuffer == null)
+            audioBuffer = new float[Mathf.CeilToInt(0.3f * sampleRate)];
+
         int samples = Mathf.CeilToInt(p.duration * sampleRate);
         samples = Mathf.Min(samples, audioBuffer.Length);
 
@@ -240,7 +257,7 @@ public class ProceduralProjectileHitAudio : MonoBehaviour
 
             // Noise burst
             float noiseEnv = Mathf.Exp(-t * p.noiseDecay);
-            float noise = Random.Range(-1f, 1f);
+            float noise = rng.Range(-1f, 1f);
             noise = LowPassFilter(noise, p.noiseCutoff, 0);
             sample += noise * p.noiseAmount * noiseEnv;
 
@@ -250,20 +267,14 @@ public class ProceduralProjectileHitAudio : MonoBehaviour
             audioBuffer[i] = sample;
         }
 
-        AudioClip clip = AudioClip.Create("PlayerHit", samples, 1, sampleRate, false);
         float[] finalBuffer = new float[samples];
         System.Array.Copy(audioBuffer, finalBuffer, samples);
-        clip.SetData(finalBuffer, 0);
-        return clip;
+        return finalBuffer;
     }
 
     private float LowPassFilter(float input, float cutoff, int stateIndex)
     {
-        float rc = 1f / (2f * Mathf.PI * cutoff);
-        float dt = 1f / sampleRate;
-        float alpha = dt / (rc + dt);
-        lpState[stateIndex] = lpState[stateIndex] + alpha * (input - lpState[stateIndex]);
-        return lpState[stateIndex];
+        return ProceduralDsp.OnePoleLowpass(ref lpState[stateIndex], input, cutoff, sampleRate);
     }
 
     private float SoftClip(float x)
@@ -276,20 +287,17 @@ public class ProceduralProjectileHitAudio : MonoBehaviour
     // Static helper to play hit sound from anywhere
     public static void PlayHit(Vector3 position, HitSoundType type = HitSoundType.Energy, float vol = 0.5f)
     {
-        // Create temporary audio source at position
-        GameObject temp = new GameObject("ProjectileHitSound");
-        temp.transform.position = position;
-        
-        AudioSource source = temp.AddComponent<AudioSource>();
-        source.spatialBlend = 0.5f; // Partial 3D
-        source.rolloffMode = AudioRolloffMode.Linear;
-        source.maxDistance = 30f;
-        
-        ProceduralProjectileHitAudio hitAudio = temp.AddComponent<ProceduralProjectileHitAudio>();
-        hitAudio.volume = vol;
-        hitAudio.soundType = type;
-        hitAudio.PlayHitSound();
-        
-        Destroy(temp, 0.5f);
+        // Partial 3D voice at the hit position (see AudioVoiceManager.PlayAt)
+        EnsureInstance();
+        ProceduralClipCache.PlayAt(instance.GetClipSet(type), AudioVoiceCategory.Impact, position, vol, instance.randomization * 0.5f);
+    }
+
+    private static void EnsureInstance()
+    {
+        if (instance != null) return;
+
+        GameObject obj = new GameObject("ProjectileHitAudio");
+        DontDestroyOnLoad(obj);
+        instance = obj.AddComponent<ProceduralProjectileHitAudio>();
     }
 }
@@ -3,6 +3,7 @@ using UnityEngine;
 /// <summary>
 /// Procedural XP pickup sound - satisfying, dopamine-inducing collect sound.
 /// Combines a bright chime with a soft whoosh for that rewarding feel.
+/// Where ProceduralAudioMixer exists each pickup is synthesized on the audio thread while it plays.
 /// </summary>
 public class ProceduralXPPickupAudio : MonoBehaviour
 {
@@ -18,10 +19,13 @@ public class ProceduralXPPickupAudio : MonoBehaviour
     [SerializeField] private bool scaleWithCombo = true;
     [SerializeField] private float maxPitchBoost = 0.5f;
 
-    private static AudioSource sharedAudioSource;
+    private const float Duration = 0.25f;
+
     private static int sampleRate;
     private static float[] audioBuffer;
-    private static float[] lpState = new float[4];
+
+    // Fixed output gain, measured once from a reference render (a streamed voice can't normalize itself)
+    private static float outputGain;
     
     // Combo tracking for pitch scaling
     private static float lastPickupTime;
@@ -36,17 +40,19 @@ public class ProceduralXPPickupAudio : MonoBehaviour
 
     private static void EnsureInitialized()
     {
-        if (sharedAudioSource == null)
+        if (audioBuffer == null)
         {
-            GameObject audioObj = new GameObject("XPPickupAudio");
-            DontDestroyOnLoad(audioObj);
-            sharedAudioSource = audioObj.AddComponent<AudioSource>();
-            sharedAudioSource.playOnAwake = false;
-            sharedAudioSource.spatialBlend = 0f; // 2D sound
-            
             sampleRate = AudioSettings.outputSampleRate;
             int maxSamples = Mathf.CeilToInt(0.5f * sampleRate);
             audioBuffer = new float[maxSamples];
+
+            // Normalize with headroom
+            outputGain = 1f;
+            ProceduralStreamState reference = CreatePickup(1f);
+            for (int i = 0; i < reference.length; i++)
+                audioBuffer[i] = NextSample(ref reference, i, sampleRate);
+            float peak = ProceduralDsp.Peak(audioBuffer, reference.length);
+            outputGain = peak > 0.01f ? 0.7f / peak : 1f;
         }
     }
 
@@ -85,17 +91,41 @@ public class ProceduralXPPickupAudio : MonoBehaviour
         // Random pitch variation
         float pitchMult = comboPitch * (1f + Random.Range(-pitchVar, pitchVar));
 
-        AudioClip clip = GeneratePickupClip(pitchMult);
-        sharedAudioSource.PlayOneShot(clip, vol);
+        ProceduralStreamState pickup = CreatePickup(pitchMult);
+        if (ProceduralAudioMixer.Supported)
+        {
+            ProceduralAudioMixer.PlayStream(ProceduralVoiceKind.Pickup, pickup, AudioVoiceCategory.Pickup, vol);
+            return;
+        }
+
+        AudioClip clip = GeneratePickupClip(pickup);
+        AudioVoiceManager.Play(clip, AudioVoiceCategory.Pickup, vol);
     }
 
-    private static AudioClip GeneratePickupClip(float pitchMult)
+    /// <summary>
+    /// Parameters for one pickup (p0 pitch multiplier, p1 output gain; s0-s4 oscillator phases,
+    /// s5/s6 whoosh filter state)
+    /// </summary>
+    private static ProceduralStreamState CreatePickup(float pitchMult)
     {
-        float duration = 0.25f;
-        int totalSamples = Mathf.CeilToInt(duration * sampleRate);
-        totalSamples = Mathf.Min(totalSamples, audioBuffer.Length);
+        return new ProceduralStreamState
+        {
+            length = Mathf.Min(Mathf.CeilToInt(Duration * sampleRate), audioBuffer.Length),
+            p0 = pitchMult,
+            p1 = outputGain,
+            rng = (uint)Random.Range(1, int.MaxValue)
+        };
+    }
 
-        System.Array.Clear(lpState, 0, lpState.Length);
+    /// <summary>
+    /// Sample i of a pickup. Runs on the audio thread (ProceduralAudioMixer) or in GeneratePickupClip.
+    /// </summary>
+    public static float NextSample(ref ProceduralStreamState s, int i, float sampleRate)
+    {
+        float duration = Duration;
+        float pitchMult = s.p0;
+        float t = i / sampleRate;
+        float normalizedT = t / duration;
 
         // Base frequencies for a pleasant major chord arpeggio feel
         float baseFreq = 880f * pitchMult;  // A5
@@ -103,97 +133,77 @@ public class ProceduralXPPickupAudio : MonoBehaviour
         float freq3 = baseFreq * 1.5f;       // E6 (perfect fifth)
         float freq4 = baseFreq * 2f;         // A6 (octave)
 
-        float phase1 = 0f, phase2 = 0f, phase3 = 0f, phase4 = 0f;
-        float shimmerPhase = 0f;
-
-        for (int i = 0; i < totalSamples; i++)
+        // === MAIN CHIME (bright sine with harmonics) ===
+        float chimeEnv = GetChimeEnvelope(t, duration);
+
+        // Staggered entry for arpeggio effect
+        float t1 = t;
+        float t2 = Mathf.Max(0f, t - 0.015f);
+        float t3 = Mathf.Max(0f, t - 0.03f);
+        float t4 = Mathf.Max(0f, t - 0.045f);
+
+        s.s0 += baseFreq / sampleRate;
+        float tone1 = Mathf.Sin(s.s0 * Mathf.PI * 2f);
+        tone1 += Mathf.Sin(s.s0 * Mathf.PI * 4f) * 0.3f; // 2nd harmonic
+        tone1 *= GetStaggeredEnv(t1, duration) * 0.4f;
+
+        s.s1 += freq2 / sampleRate;
+        float tone2 = Mathf.Sin(s.s1 * Mathf.PI * 2f);
+        tone2 += Mathf.Sin(s.s1 * Mathf.PI * 4f) * 0.25f;
+        tone2 *= GetStaggeredEnv(t2, duration) * 0.35f;
+
+        s.s2 += freq3 / sampleRate;
+        float tone3 = Mathf.Sin(s.s2 * Mathf.PI * 2f);
+        tone3 += Mathf.Sin(s.s2 * Mathf.PI * 4f) * 0.2f;
+        tone3 *= GetStaggeredEnv(t3, duration) * 0.3f;
+
+        s.s3 += freq4 / sampleRate;
+        float tone4 = Mathf.Sin(s.s3 * Mathf.PI * 2f);
+        tone4 *= GetStaggeredEnv(t4, duration) * 0.25f;
+
+        float chime = (tone1 + tone2 + tone3 + tone4) * chimeEnv;
+
+        // === SHIMMER (high frequency sparkle) ===
+        float shimmerEnv = Mathf.Exp(-t * 15f);
+        s.s4 += (3500f * pitchMult) / sampleRate;
+        float shimmer = Mathf.Sin(s.s4 * Mathf.PI * 2f);
+        shimmer *= shimmerEnv * 0.15f;
+
+        // === SOFT WHOOSH (filtered noise) ===
+        float whooshEnv = GetWhooshEnvelope(t, duration);
+        float noise = s.NextNoise();
+        float whoosh = ProceduralDsp.OnePoleLowpass(ref s.s5, noise, 2000f + 3000f * (1f - normalizedT), sampleRate);
+        whoosh = ProceduralDsp.OnePoleLowpass(ref s.s6, whoosh, 4000f, sampleRate); // Extra smoothing
+        whoosh *= whooshEnv * 0.12f;
+
+        // === ATTACK CLICK ===
+        float click = 0f;
+        if (t < 0.008f)
         {
-            float t = (float)i / sampleRate;
-            float normalizedT = t / duration;
-
-            float sample = 0f;
-
-            // === MAIN CHIME (bright sine with harmonics) ===
-            float chimeEnv = GetChimeEnvelope(t, duration);
-            
-            // Staggered entry for arpeggio effect
-            float t1 = t;
-            float t2 = Mathf.Max(0f, t - 0.015f);
-            float t3 = Mathf.Max(0f, t - 0.03f);
-            float t4 = Mathf.Max(0f, t - 0.045f);
-
-            phase1 += baseFreq / sampleRate;
-            float tone1 = Mathf.Sin(phase1 * Mathf.PI * 2f);
-            tone1 += Mathf.Sin(phase1 * Mathf.PI * 4f) * 0.3f; // 2nd harmonic
-            tone1 *= GetStaggeredEnv(t1, duration) * 0.4f;
-
-            phase2 += freq2 / sampleRate;
-            float tone2 = Mathf.Sin(phase2 * Mathf.PI * 2f);
-            tone2 += Mathf.Sin(phase2 * Mathf.PI * 4f) * 0.25f;
-            tone2 *= GetStaggeredEnv(t2, duration) * 0.35f;
-
-            phase3 += freq3 / sampleRate;
-            float tone3 = Mathf.Sin(phase3 * Mathf.PI * 2f);
-            tone3 += Mathf.Sin(phase3 * Mathf.PI * 4f) * 0.2f;
-            tone3 *= GetStaggeredEnv(t3, duration) * 0.3f;
-
-            phase4 += freq4 / sampleRate;
-            float tone4 = Mathf.Sin(phase4 * Mathf.PI * 2f);
-            tone4 *= GetStaggeredEnv(t4, duration) * 0.25f;
-
-            float chime = (tone1 + tone2 + tone3 + tone4) * chimeEnv;
-
-            // === SHIMMER (high frequency sparkle) ===
-            float shimmerEnv = Mathf.Exp(-t * 15f);
-            shimmerPhase += (3500f * pitchMult) / sampleRate;
-            float shimmer = Mathf.Sin(shimmerPhase * Mathf.PI * 2f);
-            shimmer *= shimmerEnv * 0.15f;
-
-            // === SOFT WHOOSH (filtered noise) ===
-            float whooshEnv = GetWhooshEnvelope(t, duration);
-            float noise = Random.Range(-1f, 1f);
-            float whoosh = LowpassFilter(noise, 2000f + 3000f * (1f - normalizedT), 0);
-            whoosh = LowpassFilter(whoosh, 4000f, 1); // Extra smoothing
-            whoosh *= whooshEnv * 0.12f;
-
-            // === ATTACK CLICK ===
-            float click = 0f;
-            if (t < 0.008f)
-            {
-                float clickEnv = Mathf.Exp(-t * 400f);
-                click = Mathf.Sin(t * 6000f * Mathf.PI * 2f) * clickEnv * 0.2f;
-            }
-
-            // === COMBINE ===
-            sample = chime + shimmer + whoosh + click;
-
-            // Soft clip
-            sample = SoftClip(sample);
-
-            audioBuffer[i] = sample;
+            float clickEnv = Mathf.Exp(-t * 400f);
+            click = Mathf.Sin(t * 6000f * Mathf.PI * 2f) * clickEnv * 0.2f;
         }
 
-        // Fade out
-        int fadeOutSamples = Mathf.Min(totalSamples / 4, sampleRate / 20);
-        for (int i = 0; i < fadeOutSamples; i++)
+        // === COMBINE ===
+        float sample = SoftClip(chime + shimmer + whoosh + click);
+
+        // Quadratic fade-out over the tail (as ProceduralDsp.FadeOutQuadratic)
+        int fadeSamples = Mathf.Min(s.length / 4, (int)sampleRate / 20);
+        int fromEnd = s.length - 1 - i;
+        if (fromEnd < fadeSamples)
         {
-            int idx = totalSamples - 1 - i;
-            float fade = (float)i / fadeOutSamples;
-            fade = fade * fade;
-            audioBuffer[idx] *= fade;
+            float fade = (float)fromEnd / fadeSamples;
+            sample *= fade * fade;
         }
 
-        // Normalize with headroom
-        float maxAmp = 0f;
-        for (int i = 0; i < totalSamples; i++)
-            maxAmp = Mathf.Max(maxAmp, Mathf.Abs(audioBuffer[i]));
+        return sample * s.p1;
+    }
 
-        if (maxAmp > 0.01f)
-        {
-            float normalize = 0.7f / maxAmp;
-            for (int i = 0; i < totalSamples; i++)
-                audioBuffer[i] *= normalize;
-        }
+    private static AudioClip GeneratePickupClip(ProceduralStreamState pickup)
+    {
+        int totalSamples = pickup.length;
+        for (int i = 0; i < totalSamples; i++)
+            audioBuffer[i] = NextSample(ref pickup, i, sampleRate);
 
         AudioClip clip = AudioClip.Create("XPPickup", totalSamples, 1, sampleRate, false);
         float[] clipData = new float[totalSamples];
@@ -249,17 +259,6 @@ public class ProceduralXPPickupAudio : MonoBehaviour
             return Mathf.Exp(-(t - peak) * 12f);
     }
 
-    private static float LowpassFilter(float input, float cutoff, int stateIndex)
-    {
-        float rc = 1f / (2f * Mathf.PI * cutoff);
-        float dt = 1f / sampleRate;
-        float alpha = dt / (rc + dt);
-        alpha = Mathf.Clamp01(alpha);
-
-        lpState[stateIndex] += alpha * (input - lpState[stateIndex]);
-        return lpState[stateIndex];
-    }
-
     private static float SoftClip(float x)
     {
         if (x > 1f) return 1f;
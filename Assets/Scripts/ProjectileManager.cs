@@ -0,0 +1,395 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+/// <summary>
+/// Owns every projectile in flight, player and enemy alike.
+/// Projectiles are pooled per prefab, moved in one Update and hit-tested as circles swept along
+/// the step's movement (so fast shots can't tunnel through thin targets at low frame rates):
+/// hostile shots against the player, friendly shots against nearby enemies from EnemyRegistry. No per-bullet
+/// Update, trigger collider or Instantiate/Destroy. Each prefab has a live cap; past it the oldest
+/// shot of that prefab is recycled for the new one.
+/// </summary>
+public class ProjectileManager : MonoBehaviour
+{
+    private const int InitialCapacity = 128;
+
+    [Header("Limits")]
+    [SerializeField] private int maxLivePerType = 160;
+    [SerializeField] private float maxEnemyHitRadius = 1.5f;   // Largest enemy hit extent the registry query must cover
+
+    private static ProjectileManager instance;
+    private static readonly EnemyBase[] HitBuffer = new EnemyBase[16];
+
+    // In-flight projectiles (indexed by PooledProjectile.SimulationIndex)
+    private readonly List<PooledProjectile> projectiles = new List<PooledProjectile>(InitialCapacity);
+    private Vector3[] positions = new Vector3[InitialCapacity];
+    private Vector2[] velocities = new Vector2[InitialCapacity];
+    private float[] spawnTimes = new float[InitialCapacity];
+    private float[] lifeTimes = new float[InitialCapacity];
+    private bool[] hostile = new bool[InitialCapacity];
+
+    private readonly Dictionary<GameObject, Stack<PooledProjectile>> pools = new Dictionary<GameObject, Stack<PooledProjectile>>();
+    private readonly Dictionary<GameObject, int> liveCounts = new Dictionary<GameObject, int>();
+    private Transform poolRoot;
+
+    private Transform player;
+    private Collider2D playerCollider;
+    private PlayerStats playerStats;
+    private PlayerDamageHandler playerDamageHandler;
+    private float playerRadius;
+
+    /// <summary>
+    /// Number of projectiles currently in flight
+    /// </summary>
+    public static int ActiveCount => instance != null ? instance.projectiles.Count : 0;
+
+    private static ProjectileManager GetOrCreate()
+    {
+        if (instance == null && Application.isPlaying)
+        {
+            GameObject obj = new GameObject("ProjectileManager");
+            instance = obj.AddComponent<ProjectileManager>();
+        }
+        return instance;
+    }
+
+    /// <summary>
+    /// Take a projectile from the prefab's pool (or create one) and place it at position.
+    /// Call the projectile's Init to launch it. Returns null if the prefab has no PooledProjectile.
+    /// </summary>
+    public static PooledProjectile Spawn(GameObject prefab, Vector3 position)
+    {
+        if (prefab == null) return null;
+
+        ProjectileManager manager = GetOrCreate();
+        if (manager == null) return null;
+
+        manager.EnforceCap(prefab);
+
+        PooledProjectile projectile = manager.Take(prefab);
+        if (projectile == null) return null;
+
+        Transform t = projectile.transform;
+        t.SetParent(null, false);   // Leaving the inactive pool root activates the projectile
+        t.SetPositionAndRotation(position, Quaternion.identity);
+        return projectile;
+    }
+
+    public static void Launch(PooledProjectile projectile, Vector2 velocity, float lifeTime, bool isHostile)
+    {
+        ProjectileManager manager = GetOrCreate();
+        if (manager == null) return;
+
+        int index = projectile.SimulationIndex;
+        if (index < 0)
+        {
+            index = manager.projectiles.Count;
+            manager.EnsureCapacity(index + 1);
+            manager.projectiles.Add(projectile);
+            projectile.SimulationIndex = index;
+            manager.AddLive(projectile.PoolPrefab, 1);
+        }
+
+        manager.positions[index] = projectile.transform.position;
+        manager.velocities[index] = velocity;
+        manager.spawnTimes[index] = Time.time;
+        manager.lifeTimes[index] = lifeTime;
+        manager.hostile[index] = isHostile;
+    }
+
+    /// <summary>
+    /// Closest hostile projectile within range of position, or null. Projectiles have no live
+    /// colliders, so this stands in for physics queries against them.
+    /// </summary>
+    public static Transform FindClosestHostile(Vector2 position, float range)
+    {
+        if (instance == null) return null;
+
+        Transform closest = null;
+        float closestSqrDist = range * range;
+        for (int i = 0; i < instance.projectiles.Count; i++)
+        {
+            if (!instance.hostile[i] || instance.projectiles[i] == null) continue;
+
+            float sqrDist = ((Vector2)instance.positions[i] - position).sqrMagnitude;
+            if (sqrDist <= closestSqrDist)
+            {
+                closestSqrDist = sqrDist;
+                closest = instance.projectiles[i].transform;
+            }
+        }
+        return closest;
+    }
+
+    public static void Unregister(PooledProjectile projectile)
+    {
+        if (instance == null) return;
+        instance.RemoveAt(projectile);
+    }
+
+    void Awake()
+    {
+        if (instance != null && instance != this)
+        {
+            Destroy(this);
+            return;
+        }
+        instance = this;
+
+        GameObject rootObj = new GameObject("Pool");
+        rootObj.SetActive(false);
+        poolRoot = rootObj.transform;
+        poolRoot.SetParent(transform, false);
+    }
+
+    void OnDestroy()
+    {
+        if (instance != this) return;
+        instance = null;
+
+        foreach (PooledProjectile projectile in projectiles)
+        {
+            if (projectile != null) projectile.SimulationIndex = -1;
+        }
+    }
+
+    void Update()
+    {
+        FindPlayer();
+
+        float now = Time.time;
+        float dt = Time.deltaTime;
+        bool playerHittable = playerStats != null;
+        Vector2 playerCenter = playerCollider != null ? (Vector2)playerCollider.bounds.center
+            : player != null ? (Vector2)player.position : Vector2.zero;
+
+        // Backwards so despawning (swap-remove) never skips a projectile
+        for (int i = projectiles.Count - 1; i >= 0; i--)
+        {
+            PooledProjectile projectile = projectiles[i];
+            if (projectile == null)
+            {
+                RemoveIndex(i, null);
+                continue;
+            }
+
+            float timeAlive = now - spawnTimes[i];
+            if (timeAlive >= lifeTimes[i])
+            {
+                Release(projectile);
+                continue;
+            }
+
+            Vector3 pos = positions[i];
+            Vector2 from = pos;
+            pos.x += velocities[i].x * dt;
+            pos.y += velocities[i].y * dt;
+            positions[i] = pos;
+            projectile.transform.position = pos;
+            projectile.SimulationUpdate(timeAlive, dt);
+
+            Vector2 pos2D = pos;
+            float radius = projectile.HitRadius;
+            bool hit;
+            if (hostile[i])
+            {
+                float reach = radius + playerRadius;
+                hit = playerHittable && SqrDistanceToSegment(playerCenter, from, pos2D) <= reach * reach
+                    && projectile.OnHitPlayer(playerStats);
+                if (hit && playerDamageHandler != null)
+                    playerDamageHandler.HandleProjectileHit();
+            }
+            else
+            {
+                hit = HitEnemy(projectile, from, pos2D, radius);
+            }
+
+            // The hit callback may already have despawned it
+            if (hit && projectile.SimulationIndex >= 0)
+                Release(projectile);
+        }
+    }
+
+    private bool HitEnemy(PooledProjectile projectile, Vector2 from, Vector2 to, float radius)
+    {
+        // One query around the whole step
+        Vector2 mid = (from + to) * 0.5f;
+        float halfStep = (to - from).magnitude * 0.5f;
+        int count = EnemyRegistry.Query(mid, halfStep + radius + maxEnemyHitRadius, HitBuffer);
+        for (int i = 0; i < count; i++)
+        {
+            EnemyBase enemy = HitBuffer[i];
+            Collider2D body = enemy.BodyCollider;
+
+            Vector2 center;
+            float enemyRadius;
+            if (body != null)
+            {
+                Bounds bounds = body.bounds;
+                center = bounds.center;
+                enemyRadius = Mathf.Max(bounds.extents.x, bounds.extents.y);
+            }
+            else
+            {
+                center = enemy.transform.position;
+                enemyRadius = 0.5f;
+            }
+
+            float reach = radius + enemyRadius;
+            if (SqrDistanceToSegment(center, from, to) <= reach * reach && projectile.OnHitEnemy(enemy))
+                return true;
+        }
+        return false;
+    }
+
+    private static float SqrDistanceToSegment(Vector2 point, Vector2 a, Vector2 b)
+    {
+        Vector2 ab = b - a;
+        float lengthSqr = ab.sqrMagnitude;
+        float t = lengthSqr > 0f ? Mathf.Clamp01(Vector2.Dot(point - a, ab) / lengthSqr) : 0f;
+        return (a + ab * t - point).sqrMagnitude;
+    }
+
+    private void FindPlayer()
+    {
+        if (player != null) return;
+
+        GameObject playerObj = GameObject.FindGameObjectWithTag("Player");
+        if (playerObj == null) return;
+
+        player = playerObj.transform;
+        playerStats = playerObj.GetComponentInChildren<PlayerStats>();
+        playerDamageHandler = playerObj.GetComponentInChildren<PlayerDamageHandler>();
+        playerCollider = playerObj.GetComponent<Collider2D>();
+
+        playerRadius = 0.5f;
+        if (playerCollider is CircleCollider2D circle)
+        {
+            Vector3 scale = player.lossyScale;
+            playerRadius = circle.radius * Mathf.Max(Mathf.Abs(scale.x), Mathf.Abs(scale.y));
+        }
+        else if (playerCollider != null)
+        {
+            Vector3 extents = playerCollider.bounds.extents;
+            playerRadius = Mathf.Max(extents.x, extents.y);
+        }
+    }
+
+    /// <summary>
+    /// Recycle the oldest shot of a prefab when it is at its live cap
+    /// </summary>
+    private void EnforceCap(GameObject prefab)
+    {
+        if (!liveCounts.TryGetValue(prefab, out int live) || live < maxLivePerType) return;
+
+        int oldest = -1;
+        for (int i = 0; i < projectiles.Count; i++)
+        {
+            if (projectiles[i] == null || projectiles[i].PoolPrefab != prefab) continue;
+            if (oldest < 0 || spawnTimes[i] < spawnTimes[oldest])
+                oldest = i;
+        }
+
+        if (oldest >= 0)
+            Release(projectiles[oldest]);
+    }
+
+    private PooledProjectile Take(GameObject prefab)
+    {
+        if (pools.TryGetValue(prefab, out Stack<PooledProjectile> stack))
+        {
+            while (stack.Count > 0)
+            {
+                // Skip projectiles destroyed externally while pooled
+                PooledProjectile pooled = stack.Pop();
+                if (pooled != null) return pooled;
+            }
+        }
+
+        GameObject obj = Instantiate(prefab, poolRoot, false);
+        PooledProjectile projectile = obj.GetComponent<PooledProjectile>();
+        if (projectile == null)
+        {
+            GameLog.Warning(LogCategory.General, $"ProjectileManager: Prefab '{prefab.name}' has no PooledProjectile component, cannot pool it.");
+            Destroy(obj);
+            return null;
+        }
+
+        obj.name = prefab.name;
+        projectile.PoolPrefab = prefab;
+        return projectile;
+    }
+
+    /// <summary>
+    /// Return a projectile to its pool. Projectiles that were not spawned through the manager are destroyed.
+    /// </summary>
+    private void Release(PooledProjectile projectile)
+    {
+        RemoveAt(projectile);
+
+        GameObject prefab = projectile.PoolPrefab;
+        if (prefab == null)
+        {
+            Destroy(projectile.gameObject);
+            return;
+        }
+
+        projectile.transform.SetParent(poolRoot, false);
+
+        if (!pools.TryGetValue(prefab, out Stack<PooledProjectile> stack))
+        {
+            stack = new Stack<PooledProjectile>();
+            pools[prefab] = stack;
+        }
+        stack.Push(projectile);
+    }
+
+    private void RemoveAt(PooledProjectile projectile)
+    {
+        int index = projectile.SimulationIndex;
+        if (index < 0 || index >= projectiles.Count || projectiles[index] != projectile) return;
+
+        RemoveIndex(index, projectile.PoolPrefab);
+        projectile.SimulationIndex = -1;
+    }
+
+    private void RemoveIndex(int index, GameObject prefab)
+    {
+        AddLive(prefab, -1);
+
+        // Swap-remove keeps unregistering O(1)
+        int last = projectiles.Count - 1;
+        if (index != last)
+        {
+            PooledProjectile moved = projectiles[last];
+            projectiles[index] = moved;
+            positions[index] = positions[last];
+            velocities[index] = velocities[last];
+            spawnTimes[index] = spawnTimes[last];
+            lifeTimes[index] = lifeTimes[last];
+            hostile[index] = hostile[last];
+            if (moved != null) moved.SimulationIndex = index;
+        }
+        projectiles.RemoveAt(last);
+    }
+
+    private void AddLive(GameObject prefab, int delta)
+    {
+        if (prefab == null) return;
+
+        liveCounts.TryGetValue(prefab, out int live);
+        liveCounts[prefab] = Mathf.Max(0, live + delta);
+    }
+
+    private void EnsureCapacity(int count)
+    {
+        if (positions.Length >= count) return;
+
+        int size = Mathf.NextPowerOfTwo(count);
+        System.Array.Resize(ref positions, size);
+        System.Array.Resize(ref velocities, size);
+        System.Array.Resize(ref spawnTimes, size);
+        System.Array.Resize(ref lifeTimes, size);
+        System.Array.Resize(ref hostile, size);
+    }
+}
@@ -0,0 +1,281 @@
+using UnityEngine;
+using UnityEngine.Rendering;
+using UnityEngine.Rendering.Universal;
+using UnityEngine.SceneManagement;
+
+/// <summary>
+/// Runtime quality governor. FrameRateOptimizer and iOSSafariWebGLOptimizer set a fixed starting
+/// point; this watches frame time and steps cost down (and back up) while the game runs.
+///
+/// Levels (0 = startup quality, 3 = cheapest), each step adding to the previous one:
+/// 1 - 90Hz physics, 90% render scale, 75% spray particles, off-screen enemies steer half as often
+/// 2 - 60Hz physics, 80% render scale, 50% spray particles without mist/glow layers
+/// 3 - 50Hz physics, 70% render scale, 35% spray particles, no vignette (post effect and damage pulse)
+/// Physics never runs faster and render scale never goes above what the optimizers set at startup.
+///
+/// Hysteresis: it degrades only after frames have been over budget for a while and upgrades only
+/// after a longer stretch of main-thread work well under budget (so a 60Hz display cap doesn't pin
+/// it at a low level). Every change starts a cooldown, and an upgrade that had to be undone soon
+/// after makes the next upgrade wait longer.
+/// Creates itself programmatically and survives scene loads.
+/// </summary>
+public class QualityGovernor : MonoBehaviour
+{
+    public const int MaxLevel = 3;
+
+    private static readonly float[] PhysicsRates = { float.MaxValue, 90f, 60f, 50f };
+    private static readonly float[] RenderScales = { 1f, 0.9f, 0.8f, 0.7f };
+    private static readonly float[] SprayParticleScales = { 1f, 0.75f, 0.5f, 0.35f };
+    private const int SlowOffscreenSteeringLevel = 1;
+    private const int SprayDecorOffLevel = 2;
+    private const int VignetteOffLevel = 3;
+
+    private const float MaxSampleMs = 100f;              // Hitches (loads, GC) don't count in full
+    private const float UpgradeUndoneWindow = 10f;       // Degrading this soon after an upgrade backs off
+    private const float MaxUpgradeBackoff = 4f;
+
+    [Header("Budget")]
+    [SerializeField] private float targetFrameMs = 1000f / 60f;
+    [SerializeField] private float degradeThreshold = 1.15f;   // Smoothed frame time above target * this degrades
+    [SerializeField] private float upgradeThreshold = 0.7f;    // Smoothed main-thread time below target * this upgrades
+    [SerializeField] private float smoothing = 0.1f;
+
+    [Header("Hysteresis")]
+    [SerializeField] private float degradeAfterSeconds = 1.5f;
+    [SerializeField] private float upgradeAfterSeconds = 6f;
+    [SerializeField] private float cooldownSeconds = 3f;
+
+    private static QualityGovernor instance;
+    private static bool governing = true;
+    private static Rect viewRect = new Rect(float.MinValue / 2f, float.MinValue / 2f, float.MaxValue, float.MaxValue);
+    private static readonly Vector3[] viewEdges = new Vector3[4];   // Inward edge normal (xy) and offset (z)
+
+    private float baseFixedDeltaTime;
+    private float baseRenderScale = 1f;
+    private UniversalRenderPipelineAsset urpAsset;
+    private Camera mainCamera;
+    private readonly Vector2[] viewFootprint = new Vector2[4];
+
+    private float smoothedFrameMs;
+    private float smoothedWorkMs;
+    private float overBudgetTime;
+    private float underBudgetTime;
+    private float cooldownUntil;
+    private float lastUpgradeTime = float.MinValue;
+    private float upgradeBackoff = 1f;
+
+    /// <summary>
+    /// Current quality level, 0 (full) to MaxLevel (cheapest)
+    /// </summary>
+    public static int Level { get; private set; }
+
+    public static float SprayParticleScale => SprayParticleScales[Level];
+    public static bool SprayDecorLayers => Level < SprayDecorOffLevel;
+    public static int OffscreenSteeringScale => Level >= SlowOffscreenSteeringLevel ? 2 : 1;
+    public static bool VignetteEnabled => Level < VignetteOffLevel;
+
+    /// <summary>
+    /// Turn the governor on or off. Turning it off restores full quality and holds it there
+    /// (WaveBenchmark does this so physics rate and spawn timing don't depend on the machine).
+    /// </summary>
+    public static bool Governing
+    {
+        get => governing;
+        set
+        {
+            governing = value;
+            if (!value && instance != null) instance.SetLevel(0);
+        }
+    }
+
+    /// <summary>
+    /// Whether a world position is inside the main camera's view (grown by margin world units).
+    /// The view is the camera's footprint on the z = 0 gameplay plane, refreshed once per frame;
+    /// for the pitched perspective camera that's a trapezoid narrower at the bottom of the screen,
+    /// so its bounding rectangle alone would count the ground beside the player as in view.
+    /// </summary>
+    public static bool IsInView(Vector2 position, float margin = 1f)
+    {
+        if (position.x < viewRect.xMin - margin || position.x > viewRect.xMax + margin
+            || position.y < viewRect.yMin - margin || position.y > viewRect.yMax + margin)
+            return false;
+
+        for (int i = 0; i < 4; i++)
+        {
+            Vector3 edge = viewEdges[i];
+            if (edge.x * position.x + edge.y * position.y - edge.z < -margin) return false;
+        }
+        return true;
+    }
+
+    [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.AfterSceneLoad)]
+    private static void Bootstrap()
+    {
+        if (instance != null) return;
+
+        GameObject obj = new GameObject("QualityGovernor");
+        DontDestroyOnLoad(obj);
+        obj.AddComponent<QualityGovernor>();
+    }
+
+    void Awake()
+    {
+        if (instance != null && instance != this)
+        {
+            Destroy(gameObject);
+            return;
+        }
+        instance = this;
+
+        // Whatever the startup optimizers chose is level 0
+        baseFixedDeltaTime = Time.fixedDeltaTime;
+        urpAsset = GraphicsSettings.currentRenderPipeline as UniversalRenderPipelineAsset;
+        if (urpAsset != null) baseRenderScale = urpAsset.renderScale;
+
+        smoothedFrameMs = targetFrameMs;
+        smoothedWorkMs = targetFrameMs;
+
+        // Main-thread work time comes from the optimizer's frame markers
+        FrameRateOptimizer.InstallFrameMarkers();
+        SceneManager.sceneLoaded += HandleSceneLoaded;
+    }
+
+    void OnDestroy()
+    {
+        if (instance != this) return;
+
+        SceneManager.sceneLoaded -= HandleSceneLoaded;
+
+        // Leave settings (and the URP asset, which the editor would save) as we found them
+        SetLevel(0);
+        instance = null;
+    }
+
+    private void HandleSceneLoaded(Scene scene, LoadSceneMode mode)
+    {
+        mainCamera = null;
+        ApplyVignette();
+    }
+
+    void Update()
+    {
+        UpdateViewRect();
+
+        // Paused and level-up frames aren't representative of gameplay cost
+        if (!governing || Time.timeScale == 0f) return;
+
+        float dt = Time.unscaledDeltaTime;
+        float frameMs = Mathf.Min(dt * 1000f, MaxSampleMs);
+        float workMs = Mathf.Min(FrameRateOptimizer.SimulationMs + FrameRateOptimizer.RenderSubmitMs, MaxSampleMs);
+        smoothedFrameMs += (frameMs - smoothedFrameMs) * smoothing;
+        smoothedWorkMs += (workMs - smoothedWorkMs) * smoothing;
+
+        float now = Time.unscaledTime;
+        if (now < cooldownUntil)
+        {
+            overBudgetTime = 0f;
+            underBudgetTime = 0f;
+            return;
+        }
+
+        // Dead band between the two thresholds resets both timers
+        if (smoothedFrameMs > targetFrameMs * degradeThreshold)
+        {
+            overBudgetTime += dt;
+            underBudgetTime = 0f;
+        }
+        else if (smoothedWorkMs < targetFrameMs * upgradeThreshold)
+        {
+            underBudgetTime += dt;
+            overBudgetTime = 0f;
+        }
+        else
+        {
+            overBudgetTime = 0f;
+            underBudgetTime = 0f;
+        }
+
+        if (overBudgetTime >= degradeAfterSeconds && Level < MaxLevel)
+        {
+            if (now - lastUpgradeTime < UpgradeUndoneWindow)
+                upgradeBackoff = Mathf.Min(upgradeBackoff * 2f, MaxUpgradeBackoff);
+
+            SetLevel(Level + 1);
+        }
+        else if (underBudgetTime >= upgradeAfterSeconds * upgradeBackoff && Level > 0)
+        {
+            lastUpgradeTime = now;
+            SetLevel(Level - 1);
+        }
+        else if (Level == 0 && now - lastUpgradeTime > UpgradeUndoneWindow * 3f)
+        {
+            upgradeBackoff = 1f;   // Long stable stretch at full quality
+        }
+    }
+
+    private void SetLevel(int level)
+    {
+        level = Mathf.Clamp(level, 0, MaxLevel);
+        overBudgetTime = 0f;
+        underBudgetTime = 0f;
+        cooldownUntil = Time.unscaledTime + cooldownSeconds;
+        if (level == Level) return;
+
+        GameLog.Info(LogCategory.Performance, $"[QualityGovernor] Level {Level} -> {level} (frame {smoothedFrameMs:F1}ms, work {smoothedWorkMs:F1}ms, budget {targetFrameMs:F1}ms)");
+        Level = level;
+
+        // Physics never runs faster than the startup rate
+        float rate = Mathf.Min(1f / baseFixedDeltaTime, PhysicsRates[level]);
+        Time.fixedDeltaTime = 1f / rate;
+
+        if (urpAsset != null)
+            urpAsset.renderScale = baseRenderScale * RenderScales[level];
+
+        ApplyVignette();
+    }
+
+    private void ApplyVignette()
+    {
+        bool enabled = VignetteEnabled;
+        foreach (Volume volume in FindObjectsByType<Volume>(FindObjectsSortMode.None))
+        {
+            if (volume.sharedProfile == null || !volume.sharedProfile.Has<Vignette>()) continue;
+
+            // .profile gives the volume its own copy so the shared asset isn't modified;
+            // no need to make one just to leave the vignette on
+            if (enabled && !volume.HasInstantiatedProfile()) continue;
+            if (volume.profile.TryGet(out Vignette vignette))
+                vignette.active = enabled;
+        }
+    }
+
+    private void UpdateViewRect()
+    {
+        if (mainCamera == null)
+        {
+            mainCamera = Camera.main;
+            if (mainCamera == null) return;
+        }
+
+        CameraFootprint.Compute(mainCamera, 0f, viewFootprint);
+        viewRect = CameraFootprint.Bounds(viewFootprint);
+
+        // Winding depends on the camera, so orient the normals by the signed area
+        float area = 0f;
+        for (int i = 0; i < 4; i++)
+        {
+            Vector2 a = viewFootprint[i];
+            Vector2 b = viewFootprint[(i + 1) & 3];
+            area += a.x * b.y - a.y * b.x;
+        }
+        float inward = area >= 0f ? 1f : -1f;
+
+        for (int i = 0; i < 4; i++)
+        {
+            Vector2 a = viewFootprint[i];
+            Vector2 edge = viewFootprint[(i + 1) & 3] - a;
+            Vector2 normal = new Vector2(-edge.y, edge.x).normalized * inward;
+            viewEdges[i] = new Vector3(normal.x, normal.y, Vector2.Dot(normal, a));
+        }
+    }
+}
@@ -0,0 +1,344 @@
+using System.Collections.Generic;
+using System.IO;
+using System.Threading.Tasks;
+using UnityEngine;
+using UnityEngine.SceneManagement;
+
+/// <summary>
+/// Persistent settings and scores. Values live in memory; Set* only marks the store dirty, and
+/// the whole store is written as one compact binary file (save.bin in persistentDataPath) later:
+/// - on a debounce, FlushDelay after the last change, but only while no gameplay is running
+/// - at safe points - Flush() from level-up, pause and game over, and on every scene change
+/// - synchronously when the application is paused or quits
+/// While GameStates reports gameplay (SetGameplayActive) debounced flushes wait for the next safe
+/// point, so saving never costs a gameplay frame. Encoding and the file write run on a worker
+/// thread where threads exist; on WebGL they run on the main thread at the safe point.
+/// Replaces DataSaver and the scattered PlayerPrefs.Save calls; known PlayerPrefs keys are
+/// migrated on first run.
+/// </summary>
+public class SaveService : MonoBehaviour
+{
+    public const string LastScoreKey = "LastScore";
+    public const string HighScoreKey = "HighScore";
+    public const string ShowVirtualControllerKey = "ShowVirtualController";
+    public const string PerfHudVisibleKey = "PerfHudVisible";
+
+    private const string FileName = "save.bin";
+    private const int Magic = 0x56535242;     // "BRSV"
+    private const int Version = 1;
+    private const float FlushDelay = 2f;
+
+    // Int keys written through PlayerPrefs before this service existed
+    private static readonly string[] MigratedIntKeys = { LastScoreKey, ShowVirtualControllerKey, PerfHudVisibleKey };
+
+#if UNITY_WEBGL && !UNITY_EDITOR
+    private static readonly bool useWorkerThread = false;   // No threads on WebGL
+#else
+    private static readonly bool useWorkerThread = true;
+#endif
+
+    private enum ValueType : byte
+    {
+        Int,
+        Float,
+        String
+    }
+
+    private struct Value
+    {
+        public ValueType type;
+        public int intValue;
+        public float floatValue;
+        public string stringValue;
+    }
+
+    private struct Record
+    {
+        public string key;
+        public Value value;
+    }
+
+    private static SaveService instance;
+    private static readonly Dictionary<string, Value> values = new Dictionary<string, Value>();
+    private static bool loaded;
+    private static bool dirty;
+    private static bool gameplayActive;
+    private static float lastChangeTime;
+    private static string filePath;
+
+    // Writes run one after another so an older snapshot never overwrites a newer one
+    private static Task writeChain = Task.CompletedTask;
+
+    /// <summary>
+    /// True when changes are waiting to be written
+    /// </summary>
+    public static bool HasPendingChanges => dirty;
+
+    [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.BeforeSceneLoad)]
+    private static void Initialize()
+    {
+        EnsureLoaded();
+        SceneManager.sceneUnloaded += HandleSceneUnloaded;
+    }
+
+    private static void HandleSceneUnloaded(Scene scene)
+    {
+        Flush();
+    }
+
+    // ==================== Values ====================
+
+    public static bool HasKey(string key)
+    {
+        EnsureLoaded();
+        return values.ContainsKey(key);
+    }
+
+    public static int GetInt(string key, int defaultValue = 0)
+    {
+        EnsureLoaded();
+        return values.TryGetValue(key, out Value v) && v.type == ValueType.Int ? v.intValue : defaultValue;
+    }
+
+    public static float GetFloat(string key, float defaultValue = 0f)
+    {
+        EnsureLoaded();
+        return values.TryGetValue(key, out Value v) && v.type == ValueType.Float ? v.floatValue : defaultValue;
+    }
+
+    public static string GetString(string key, string defaultValue = null)
+    {
+        EnsureLoaded();
+        return values.TryGetValue(key, out Value v) && v.type == ValueType.String ? v.stringValue : defaultValue;
+    }
+
+    public static void SetInt(string key, int value)
+    {
+        Set(key, new Value { type = ValueType.Int, intValue = value });
+    }
+
+    public static void SetFloat(string key, float value)
+    {
+        Set(key, new Value { type = ValueType.Float, floatValue = value });
+    }
+
+    public static void SetString(string key, string value)
+    {
+        Set(key, new Value { type = ValueType.String, stringValue = value ?? string.Empty });
+    }
+
+    /// <summary>
+    /// Store a serializable object as compact JSON (JsonUtility, not pretty-printed)
+    /// </summary>
+    public static void SetObject<T>(string key, T value)
+    {
+        SetString(key, JsonUtility.ToJson(value, false));
+    }
+
+    public static T GetObject<T>(string key)
+    {
+        string json = GetString(key);
+        return string.IsNullOrEmpty(json) ? default : JsonUtility.FromJson<T>(json);
+    }
+
+    public static bool DeleteKey(string key)
+    {
+        EnsureLoaded();
+        if (!values.Remove(key)) return false;
+
+        MarkDirty();
+        return true;
+    }
+
+    private static void Set(string key, Value value)
+    {
+        EnsureLoaded();
+        if (values.TryGetValue(key, out Value old) && old.type == value.type && old.intValue == value.intValue
+            && old.floatValue == value.floatValue && old.stringValue == value.stringValue)
+            return;
+
+        values[key] = value;
+        MarkDirty();
+    }
+
+    private static void MarkDirty()
+    {
+        dirty = true;
+        lastChangeTime = Time.realtimeSinceStartup;
+        EnsureInstance();
+    }
+
+    // ==================== Flushing ====================
+
+    /// <summary>
+    /// Hold debounced flushes while a run is in progress (GameStates). Changes are still written
+    /// at safe points.
+    /// </summary>
+    public static void SetGameplayActive(bool active)
+    {
+        gameplayActive = active;
+    }
+
+    /// <summary>
+    /// Write pending changes now. Call at safe points (level-up, pause, game over); the encode and
+    /// write are queued on the worker thread where available.
+    /// </summary>
+    public static void Flush()
+    {
+        if (!dirty) return;
+        dirty = false;
+
+        Record[] snapshot = Snapshot();
+        string path = filePath;
+        if (useWorkerThread)
+            writeChain = writeChain.ContinueWith(_ => Write(snapshot, path), TaskScheduler.Default);
+        else
+            Write(snapshot, path);
+    }
+
+    /// <summary>
+    /// Write pending changes and wait for every queued write (application pause and quit)
+    /// </summary>
+    public static void FlushImmediately()
+    {
+        Flush();
+        writeChain.Wait();
+    }
+
+    void Update()
+    {
+        if (dirty && !gameplayActive && Time.realtimeSinceStartup - lastChangeTime >= FlushDelay)
+            Flush();
+    }
+
+    void OnApplicationPause(bool paused)
+    {
+        // Mobile browsers and OSes may kill a backgrounded app without another callback
+        if (paused) FlushImmediately();
+    }
+
+    void OnApplicationQuit()
+    {
+        FlushImmediately();
+    }
+
+    private static Record[] Snapshot()
+    {
+        var snapshot = new Record[values.Count];
+        int i = 0;
+        foreach (KeyValuePair<string, Value> pair in values)
+            snapshot[i++] = new Record { key = pair.Key, value = pair.Value };
+        return snapshot;
+    }
+
+    /// <summary>
+    /// Encode and write a snapshot. Runs on the worker thread: no Unity API in here except Debug
+    /// (GameLog reads Time, which is main-thread only).
+    /// </summary>
+    private static void Write(Record[] snapshot, string path)
+    {
+        string tempPath = path + ".tmp";
+        try
+        {
+            using (var stream = new FileStream(tempPath, FileMode.Create, FileAccess.Write))
+            using (var writer = new BinaryWriter(stream))
+            {
+                writer.Write(Magic);
+                writer.Write(Version);
+                writer.Write(snapshot.Length);
+                foreach (Record record in snapshot)
+                {
+                    writer.Write((byte)record.value.type);
+                    writer.Write(record.key);
+                    switch (record.value.type)
+                    {
+                        case ValueType.Int: writer.Write(record.value.intValue); break;
+                        case ValueType.Float: writer.Write(record.value.floatValue); break;
+                        default: writer.Write(record.value.stringValue); break;
+                    }
+                }
+            }
+
+            // Replace in one step so a write cut short never leaves a corrupt save
+            if (File.Exists(path)) File.Delete(path);
+            File.Move(tempPath, path);
+        }
+        catch (System.Exception e)
+        {
+            Debug.LogWarning($"[SaveService] Failed to write {path}: {e.Message}");
+        }
+    }
+
+    // ==================== Loading ====================
+
+    private static void EnsureLoaded()
+    {
+        if (loaded) return;
+        loaded = true;
+
+        filePath = Path.Combine(Application.persistentDataPath, FileName);
+        if (File.Exists(filePath))
+        {
+            try
+            {
+                Read(File.ReadAllBytes(filePath));
+                return;
+            }
+            catch (System.Exception e)
+            {
+                values.Clear();
+                GameLog.Warning(LogCategory.General, $"[SaveService] Save file unreadable, starting fresh: {e.Message}");
+            }
+        }
+
+        MigratePlayerPrefs();
+    }
+
+    private static void Read(byte[] bytes)
+    {
+        using (var reader = new BinaryReader(new MemoryStream(bytes)))
+        {
+            if (reader.ReadInt32() != Magic || reader.ReadInt32() > Version)
+                throw new IOException("unknown format");
+
+            int count = reader.ReadInt32();
+            for (int i = 0; i < count; i++)
+            {
+                var type = (ValueType)reader.ReadByte();
+                string key = reader.ReadString();
+                var value = new Value { type = type };
+                switch (type)
+                {
+                    case ValueType.Int: value.intValue = reader.ReadInt32(); break;
+                    case ValueType.Float: value.floatValue = reader.ReadSingle(); break;
+                    case ValueType.String: value.stringValue = reader.ReadString(); break;
+                    default: throw new IOException($"unknown value type {type}");
+                }
+                values[key] = value;
+            }
+        }
+    }
+
+    private static void MigratePlayerPrefs()
+    {
+        bool migrated = false;
+        foreach (string key in MigratedIntKeys)
+        {
+            if (!PlayerPrefs.HasKey(key)) continue;
+
+            values[key] = new Value { type = ValueType.Int, intValue = PlayerPrefs.GetInt(key) };
+            migrated = true;
+        }
+
+        if (migrated) MarkDirty();
+    }
+
+    private static void EnsureInstance()
+    {
+        if (instance != null || !Application.isPlaying) return;
+
+        GameObject obj = new GameObject("SaveService");
+        DontDestroyOnLoad(obj);
+        instance = obj.AddComponent<SaveService>();
+    }
+}
@@ -5,6 +5,7 @@ public class ScoreValue : MonoBehaviour
 {
     [SerializeField] TextMeshProUGUI scoreText;
     private GameStates gameStates;
+    private int shownScore = int.MinValue;
 
     void Awake()
     {
@@ -20,9 +21,9 @@ public class ScoreValue : MonoBehaviour
     
     void Update()
     {
-        if (scoreText != null && gameStates != null)
-        {
-            scoreText.text = gameStates.score.ToString();
-        }
+        if (scoreText == null || gameStates == null || gameStates.score == shownScore) return;
+        
+        shownScore = gameStates.score;
+        scoreText.SetText("{0}", shownScore);
     }
 }
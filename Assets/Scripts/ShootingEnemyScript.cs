@@ -32,51 +32,20 @@ public class ShootingEnemyScript : EnemyBase
             gunAudio = GetComponent<ProceduralEnemyGunAudio>();
     }
 
-    protected override void FixedUpdate()
+    public override void ResetForSpawn()
     {
-        if (player == null) return;
-        
-        // Don't move toward player during knockback
-        if (isKnockedBack)
-        {
-            // Still apply separation during knockback
-            base.FixedUpdate();
-            return;
-        }
-
-        Vector2 toPlayer = (Vector2)player.position - rb.position;
-        float dist = toPlayer.magnitude;
-
-        // If far away -> move towards player
-        if (dist > stopDistance)
-        {
-            if (dist < 0.0001f) return;
-
-            Vector2 dir = toPlayer / dist; // normalized
-            Vector2 targetVel = dir * Speed;
-
-            // Smooth acceleration towards target velocity
-            rb.linearVelocity = Vector2.MoveTowards(rb.linearVelocity, targetVel, acceleration * Time.fixedDeltaTime);
-        }
-        else if (dist < playerSeparationRadius)
-        {
-            // Too close to player - move away
-            Vector2 dir = -toPlayer / dist; // away from player
-            float urgency = 1f - (dist / playerSeparationRadius);
-            Vector2 targetVel = dir * Speed * urgency;
-            rb.linearVelocity = Vector2.MoveTowards(rb.linearVelocity, targetVel, acceleration * Time.fixedDeltaTime);
-        }
-        else
-        {
-            // Within stop range but not too close -> stop moving
-            rb.linearVelocity = Vector2.MoveTowards(rb.linearVelocity, Vector2.zero, acceleration * Time.fixedDeltaTime);
-        }
+        base.ResetForSpawn();
         
-        // Apply separation AFTER movement
-        base.FixedUpdate();
+        nextShootTime = 0f;
     }
 
-    public override void Update()
+    /// <summary>
+    /// Ranged enemies hold position at stopDistance and back off when the player gets too close
+    /// </summary>
+    public override EnemySteeringMode Steering => EnemySteeringMode.KeepDistance;
+    public override float SteeringStopDistance => stopDistance;
+
+    public override void SimulationUpdate(float deltaTime)
     {
         if (player == null) return;
         
@@ -86,7 +55,7 @@ public class ShootingEnemyScript : EnemyBase
         {
             TryShoot();
         }
-        base.Update();
+        base.SimulationUpdate(deltaTime);
     }
 
     void TryShoot()
@@ -113,9 +82,7 @@ public class ShootingEnemyScript : EnemyBase
         // Use Z position for visual "height" - this doesn't affect 2D collision
         Vector3 spawnPos = new Vector3(spawnPos2D.x, spawnPos2D.y, projectileVisualHeight);
         
-        GameObject proj = Instantiate(projectilePrefab, spawnPos, Quaternion.identity);
-
-        EnemyProjectile ep = proj.GetComponent<EnemyProjectile>();
+        EnemyProjectile ep = ProjectileManager.Spawn(projectilePrefab, spawnPos) as EnemyProjectile;
         if (ep != null)
         {
             ep.Init(direction);
@@ -6,6 +6,8 @@ public class ShuffleWalkVisual : MonoBehaviour
     
     // Reference to player stats for speed-based animation scaling
     private PlayerStats _playerStats;
+    private float _speedMultiplier = 1f;
+    private int _speedMultiplierVersion = -1;  // PlayerStats.Version _speedMultiplier was computed at
     private const float BaseMovementSpeed = 4f;  // Default speed - animation tuned for this
 
     // Timing (base values - scaled by speed)
@@ -123,9 +125,14 @@ public class ShuffleWalkVisual : MonoBehaviour
                 return 1f;
         }
         
-        float currentSpeed = _playerStats.CurrentMovementSpeed;
-        float ratio = currentSpeed / BaseMovementSpeed;
-        return Mathf.Clamp(ratio, MinSpeedMultiplier, MaxSpeedMultiplier);
+        // Speed only changes with upgrades and boosts
+        if (_playerStats.Version != _speedMultiplierVersion)
+        {
+            _speedMultiplierVersion = _playerStats.Version;
+            float ratio = _playerStats.CurrentMovementSpeed / BaseMovementSpeed;
+            _speedMultiplier = Mathf.Clamp(ratio, MinSpeedMultiplier, MaxSpeedMultiplier);
+        }
+        return _speedMultiplier;
     }
     
     /// <summary>
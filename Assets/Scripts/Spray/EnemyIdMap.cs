@@ -0,0 +1,100 @@
+/// <summary>
+/// Open-addressed map from EnemyBase.SpawnId to a dense slot (0..Count-1), so per-enemy spray
+/// state lives in plain arrays instead of a Dictionary keyed by the enemy object.
+/// Clear is O(1): entries from older generations count as empty.
+/// </summary>
+public sealed class EnemyIdMap
+{
+    private int[] keys;
+    private int[] slots;
+    private int[] generations;
+    private int mask;
+    private int generation = 1;
+
+    /// <summary>
+    /// Number of ids added since the last Clear
+    /// </summary>
+    public int Count { get; private set; }
+
+    public EnemyIdMap(int capacity = 256)
+    {
+        int size = UnityEngine.Mathf.NextPowerOfTwo(UnityEngine.Mathf.Max(16, capacity * 2));
+        Allocate(size);
+    }
+
+    /// <summary>
+    /// Slot for id, adding it as slot Count if it isn't in the map yet
+    /// </summary>
+    public int GetOrAdd(int id, out bool added)
+    {
+        // Keep the load factor under one half
+        if ((Count + 1) * 2 > keys.Length) Grow();
+
+        int i = Probe(id);
+        if (generations[i] == generation)
+        {
+            added = false;
+            return slots[i];
+        }
+
+        keys[i] = id;
+        slots[i] = Count;
+        generations[i] = generation;
+        added = true;
+        return Count++;
+    }
+
+    public bool TryGet(int id, out int slot)
+    {
+        int i = Probe(id);
+        slot = generations[i] == generation ? slots[i] : -1;
+        return slot >= 0;
+    }
+
+    public void Clear()
+    {
+        Count = 0;
+        if (++generation == int.MaxValue)
+        {
+            // Wrapped: wipe for real once every 2^31 clears
+            System.Array.Clear(generations, 0, generations.Length);
+            generation = 1;
+        }
+    }
+
+    private int Probe(int id)
+    {
+        // Fibonacci hashing spreads consecutive spawn ids across the table
+        int i = (int)((uint)id * 2654435769u) & mask;
+        while (generations[i] == generation && keys[i] != id)
+            i = (i + 1) & mask;
+        return i;
+    }
+
+    private void Grow()
+    {
+        int[] oldKeys = keys;
+        int[] oldSlots = slots;
+        int[] oldGenerations = generations;
+        int oldGeneration = generation;
+
+        Allocate(keys.Length * 2);
+        for (int j = 0; j < oldKeys.Length; j++)
+        {
+            if (oldGenerations[j] != oldGeneration) continue;
+
+            int i = Probe(oldKeys[j]);
+            keys[i] = oldKeys[j];
+            slots[i] = oldSlots[j];
+            generations[i] = generation;
+        }
+    }
+
+    private void Allocate(int size)
+    {
+        keys = new int[size];
+        slots = new int[size];
+        generations = new int[size];
+        mask = size - 1;
+    }
+}
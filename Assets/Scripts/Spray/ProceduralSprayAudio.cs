@@ -7,6 +7,7 @@ using UnityEngine;
 /// 
 /// Uses SprayAudioClipGenerator for sound generation and 
 /// SprayAudioFilters for audio processing.
+/// The continuous loop keeps its own AudioSource; bursts play through AudioVoiceManager.
 /// </summary>
 [RequireComponent(typeof(AudioSource))]
 public class ProceduralSprayAudio : MonoBehaviour
@@ -80,8 +81,7 @@ public class ProceduralSprayAudio : MonoBehaviour
         float variation = 1f + Random.Range(-randomization, randomization);
         AudioClip clip = clipGenerator.GenerateSprayBurst(sprayDuration * variation);
         
-        audioSource.pitch = 1f + Random.Range(-0.05f, 0.05f);
-        audioSource.PlayOneShot(clip, volume * volumeMultiplier);
+        AudioVoiceManager.Play(clip, AudioVoiceCategory.PlayerWeapon, volume * volumeMultiplier, 1f + Random.Range(-0.05f, 0.05f));
     }
 
     /// <summary>
@@ -109,6 +109,6 @@ public class ProceduralSprayAudio : MonoBehaviour
         audioSource.Stop();
         audioSource.loop = false;
         
-        audioSource.PlayOneShot(sprayEndClip, volume);
+        AudioVoiceManager.Play(sprayEndClip, AudioVoiceCategory.PlayerWeapon, volume);
     }
 }
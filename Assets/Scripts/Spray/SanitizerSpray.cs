@@ -63,6 +63,23 @@ public class SanitizerSpray : MonoBehaviour
         InitializeComponents();
         FindReferences();
         UpdateStatsFromPlayer();
+        
+        // Range/width only change on upgrades - react to those instead of polling
+        if (playerStats != null)
+            playerStats.StatsChanged += OnPlayerStatsChanged;
+    }
+
+    void OnDestroy()
+    {
+        if (playerStats != null)
+            playerStats.StatsChanged -= OnPlayerStatsChanged;
+    }
+
+    private void OnPlayerStatsChanged(PlayerStats stats)
+    {
+        // Most changes are health/XP; only touch the particle systems when spray stats moved
+        if (stats.CurrentSprayRange != currentRange || stats.CurrentSprayWidth != currentWidth)
+            UpdateStatsFromPlayer();
     }
 
     private void InitializeComponents()
@@ -133,10 +150,6 @@ public class SanitizerSpray : MonoBehaviour
 
     void Update()
     {
-        // Periodically refresh stats
-        if (Time.frameCount % 30 == 0)
-            UpdateStatsFromPlayer();
-        
         // Keep hand's range in sync
         handVisuals?.SetRange(currentRange);
         
@@ -167,6 +180,10 @@ public class SanitizerSpray : MonoBehaviour
             // This detects enemies in the spray cone and deals damage immediately
             damageHandler?.ProcessDamage(dir, currentRange, currentWidth, (Vector2)nozzle);
         }
+        else
+        {
+            damageHandler?.ApplyPendingDamage();
+        }
     }
     
     /// <summary>
@@ -97,16 +97,7 @@ public class SprayAudioFilters
     /// </summary>
     public static void NormalizeBuffer(float[] buffer, float targetPeak)
     {
-        float maxAmp = 0f;
-        for (int i = 0; i < buffer.Length; i++)
-            maxAmp = Mathf.Max(maxAmp, Mathf.Abs(buffer[i]));
-        
-        if (maxAmp > 0.001f)
-        {
-            float scale = targetPeak / maxAmp;
-            for (int i = 0; i < buffer.Length; i++)
-                buffer[i] *= scale;
-        }
+        ProceduralDsp.NormalizePeak(buffer, buffer.Length, targetPeak, 0.001f);
     }
 
     /// <summary>
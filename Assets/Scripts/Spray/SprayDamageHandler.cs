@@ -3,14 +3,30 @@ using UnityEngine;
 
 /// <summary>
 /// Handles damage calculation and enemy detection for the sanitizer spray.
-/// Damage is delayed based on particle travel time to sync with visuals.
+/// Hits are accumulated per enemy (keyed by EnemyBase.SpawnId) in flat arrays, and each tick's
+/// damage goes into a ring buffer in the order it was dealt. The ring drains a bounded number of
+/// hits per frame, so a wide spray over 100 enemies (deaths, drops, splits) spreads over a few
+/// frames instead of spiking one. New hits on an enemy that is still queued add to its entry, so
+/// the ring never holds more than one entry per enemy. Entries whose enemy died or went back to
+/// the pool are dropped.
 /// </summary>
 public class SprayDamageHandler
 {
-    private readonly Dictionary<EnemyBase, int> particleHitCounts = new Dictionary<EnemyBase, int>();
-    private readonly Collider2D[] hitBuffer = new Collider2D[SpraySettings.HitBufferSize];
-    private readonly List<PendingDamage> pendingDamages = new List<PendingDamage>();
-    
+    private const int InitialCapacity = 64;
+
+    // Particle hits this tick, one slot per enemy
+    private readonly EnemyIdMap hitSlots = new EnemyIdMap(InitialCapacity);
+    private EnemyBase[] hitEnemies = new EnemyBase[InitialCapacity];
+    private int[] hitCounts = new int[InitialCapacity];
+
+    private readonly EnemyBase[] enemyBuffer = new EnemyBase[SpraySettings.HitBufferSize];
+    private readonly List<ParticleSystem.Particle> triggerParticles = new List<ParticleSystem.Particle>(SpraySettings.MaxParticles);
+
+    // Pending damage ring, oldest at pendingHead
+    private PendingDamage[] pending = new PendingDamage[InitialCapacity];
+    private int pendingHead;
+    private int pendingCount;
+
     private float nextDamageTick = 0f;
     private PlayerStats playerStats;
     private Transform playerTransform;
@@ -19,9 +35,9 @@ public class SprayDamageHandler
     private struct PendingDamage
     {
         public EnemyBase enemy;
+        public int spawnId;
         public float damage;
         public Vector2 knockbackDir;
-        public float applyTime;
     }
 
     public SprayDamageHandler(PlayerStats stats, Transform player)
@@ -50,19 +66,26 @@ public class SprayDamageHandler
     /// <summary>
     /// Register a particle hit on an enemy for splash damage calculation
     /// </summary>
-    public void RegisterParticleHit(EnemyBase enemy)
+    public void RegisterParticleHit(EnemyBase enemy, int hits = 1)
     {
-        if (enemy == null) return;
-        
-        if (!particleHitCounts.ContainsKey(enemy))
+        if (enemy == null || enemy.IsDead) return;
+
+        int slot = hitSlots.GetOrAdd(enemy.SpawnId, out bool added);
+        if (added)
         {
-            particleHitCounts[enemy] = 0;
+            if (slot >= hitEnemies.Length)
+            {
+                System.Array.Resize(ref hitEnemies, hitEnemies.Length * 2);
+                System.Array.Resize(ref hitCounts, hitCounts.Length * 2);
+            }
+            hitEnemies[slot] = enemy;
+            hitCounts[slot] = 0;
         }
-        particleHitCounts[enemy]++;
+        hitCounts[slot] += hits;
     }
 
     /// <summary>
-    /// Process damage - queue with delay based on particle travel time.
+    /// Process damage - detect this tick's hits, queue them and apply what the frame budget allows.
     /// </summary>
     /// <param name="sprayDirection">Direction the spray is aimed</param>
     /// <param name="currentRange">Current spray range</param>
@@ -70,52 +93,104 @@ public class SprayDamageHandler
     /// <param name="nozzleOrigin">Origin point for damage cone (nozzle position)</param>
     public void ProcessDamage(Vector2 sprayDirection, float currentRange, float currentWidth, Vector2 nozzleOrigin)
     {
-        // Always process pending damages first
-        ProcessPendingDamages();
-        
-        if (Time.time < nextDamageTick) return;
-        nextDamageTick = Time.time + SpraySettings.DamageTickRate;
-        
+        if (Time.time >= nextDamageTick)
+        {
+            nextDamageTick = Time.time + SpraySettings.DamageTickRate;
+            QueueTickDamage(sprayDirection, currentRange, currentWidth, nozzleOrigin);
+        }
+
+        ApplyPendingDamage();
+    }
+
+    private void QueueTickDamage(Vector2 sprayDirection, float currentRange, float currentWidth, Vector2 nozzleOrigin)
+    {
         // Detect enemies in cone from nozzle origin
         DetectEnemiesInCone(sprayDirection, currentRange, currentWidth, nozzleOrigin);
         
-        // Queue damage with travel time delay
         float damageMultiplier = playerStats != null ? playerStats.CurrentSprayDamageMultiplier : 1f;
         float baseDamage = playerStats != null 
             ? playerStats.CurrentDamage * 0.35f 
             : SpraySettings.BaseDamagePerParticle * 3f;
         
-        foreach (var kvp in particleHitCounts)
+        float damagePerHit = baseDamage * damageMultiplier;
+
+        // Fold this tick's hits into damage still queued for the same enemy (dropping stale entries)
+        int length = pending.Length;
+        int kept = 0;
+        for (int i = 0; i < pendingCount; i++)
         {
-            EnemyBase enemy = kvp.Key;
-            int hitCount = kvp.Value;
-            
-            if (enemy != null && hitCount > 0)
+            PendingDamage queued = pending[(pendingHead + i) % length];
+            if (!IsSameLife(queued)) continue;
+
+            if (hitSlots.TryGet(queued.spawnId, out int slot) && hitCounts[slot] > 0)
             {
-                float damage = baseDamage * hitCount * damageMultiplier;
-                
-                // Apply damage immediately for responsive hit registration
-                // (travel time delay removed - visual particles are cosmetic)
-                enemy.TakeDamage(damage, sprayDirection);
+                queued.damage += damagePerHit * hitCounts[slot];
+                queued.knockbackDir = sprayDirection;
+                hitCounts[slot] = 0;
             }
+            pending[(pendingHead + kept++) % length] = queued;
         }
-        
-        particleHitCounts.Clear();
+        for (int i = kept; i < pendingCount; i++)
+            pending[(pendingHead + i) % length] = default;
+        pendingCount = kept;
+
+        // No travel-time delay for the rest: the visual particles are cosmetic and hits should feel immediate
+        int hitEnemyCount = hitSlots.Count;
+        for (int i = 0; i < hitEnemyCount; i++)
+        {
+            if (hitCounts[i] > 0)
+                Enqueue(hitEnemies[i], damagePerHit * hitCounts[i], sprayDirection);
+        }
+        ClearHits();
     }
 
-    private void ProcessPendingDamages()
+    private static bool IsSameLife(in PendingDamage damage)
     {
-        for (int i = pendingDamages.Count - 1; i >= 0; i--)
+        // False once the enemy died or was respawned from the pool since the hit
+        EnemyBase enemy = damage.enemy;
+        return enemy != null && !enemy.IsDead && enemy.SpawnId == damage.spawnId;
+    }
+
+    private void Enqueue(EnemyBase enemy, float damage, Vector2 knockbackDir)
+    {
+        if (pendingCount == pending.Length)
         {
-            var pending = pendingDamages[i];
-            if (Time.time >= pending.applyTime)
-            {
-                if (pending.enemy != null)
-                {
-                    pending.enemy.TakeDamage(pending.damage, pending.knockbackDir);
-                }
-                pendingDamages.RemoveAt(i);
-            }
+            // Unroll the ring into a bigger array
+            var grown = new PendingDamage[pending.Length * 2];
+            for (int i = 0; i < pendingCount; i++)
+                grown[i] = pending[(pendingHead + i) % pending.Length];
+            pending = grown;
+            pendingHead = 0;
+        }
+
+        pending[(pendingHead + pendingCount) % pending.Length] = new PendingDamage
+        {
+            enemy = enemy,
+            spawnId = enemy.SpawnId,
+            damage = damage,
+            knockbackDir = knockbackDir
+        };
+        pendingCount++;
+    }
+
+    /// <summary>
+    /// Apply queued damage, oldest first, up to the per-frame budget.
+    /// ProcessDamage does this itself; call it on frames without spray so the queue still drains.
+    /// </summary>
+    public void ApplyPendingDamage()
+    {
+        int budget = SpraySettings.MaxDamageAppliesPerFrame;
+        while (pendingCount > 0 && budget > 0)
+        {
+            PendingDamage damage = pending[pendingHead];
+            pending[pendingHead] = default;
+            pendingHead = (pendingHead + 1) % pending.Length;
+            pendingCount--;
+
+            if (!IsSameLife(damage)) continue;
+
+            damage.enemy.TakeDamage(damage.damage, damage.knockbackDir);
+            budget--;
         }
     }
 
@@ -133,19 +208,15 @@ public class SprayDamageHandler
         
         float halfAngle = currentWidth * 0.5f;
         
-        // Detection still uses a circle around nozzle for initial broad-phase
-        int hitCount = Physics2D.OverlapCircleNonAlloc(origin, currentRange, hitBuffer);
+        // Broad-phase: circle around nozzle from the shared enemy spatial hash
+        int hitCount = EnemyRegistry.Query(origin, currentRange + SpraySettings.ConeQueryMargin, enemyBuffer);
         
         for (int i = 0; i < hitCount; i++)
         {
-            Collider2D hit = hitBuffer[i];
-            if (hit == null || !hit.CompareTag("Enemy")) continue;
-            
-            EnemyBase enemy = hit.GetComponent<EnemyBase>();
-            if (enemy == null) continue;
+            EnemyBase enemy = enemyBuffer[i];
             
             // Use predicted position for fast-moving enemies
-            Vector2 enemyPos = (Vector2)hit.bounds.center;
+            Vector2 enemyPos = enemy.BoundsCenter;
             if (enemy.rb != null && enemy.rb.linearVelocity.sqrMagnitude > 0.1f)
             {
                 float dist = Vector2.Distance(origin, enemyPos);
@@ -172,10 +243,7 @@ public class SprayDamageHandler
                 float particleDensity = distanceFalloff * angleFalloff;
                 int simulatedHits = Mathf.Max(1, Mathf.RoundToInt(5f * particleDensity));
                 
-                for (int j = 0; j < simulatedHits; j++)
-                {
-                    RegisterParticleHit(enemy);
-                }
+                RegisterParticleHit(enemy, simulatedHits);
             }
         }
     }
@@ -190,7 +258,7 @@ public class SprayDamageHandler
         if (sprayParticles == null) return;
         
         // Get particles that entered triggers
-        List<ParticleSystem.Particle> enter = new List<ParticleSystem.Particle>();
+        List<ParticleSystem.Particle> enter = triggerParticles;
         int numEnter = sprayParticles.GetTriggerParticles(ParticleSystemTriggerEventType.Enter, enter);
         
         bool anyKilled = false;
@@ -199,21 +267,17 @@ public class SprayDamageHandler
         {
             Vector3 particlePos = enter[i].position;
             
-            // Find enemy at this position
-            Collider2D hit = Physics2D.OverlapPoint(particlePos);
-            if (hit != null && hit.CompareTag("Enemy"))
+            // Find the enemy under this particle from the shared spatial hash
+            EnemyBase enemy = FindEnemyAt(particlePos);
+            if (enemy != null)
             {
-                EnemyBase enemy = hit.GetComponent<EnemyBase>();
-                if (enemy != null)
-                {
-                    RegisterParticleHit(enemy);
-                    
-                    // Kill particle on impact - no piercing through enemies
-                    var particle = enter[i];
-                    particle.remainingLifetime = 0f;
-                    enter[i] = particle;
-                    anyKilled = true;
-                }
+                RegisterParticleHit(enemy);
+                
+                // Kill particle on impact - no piercing through enemies
+                var particle = enter[i];
+                particle.remainingLifetime = 0f;
+                enter[i] = particle;
+                anyKilled = true;
             }
         }
         
@@ -224,6 +288,18 @@ public class SprayDamageHandler
         }
     }
 
+    private EnemyBase FindEnemyAt(Vector2 point)
+    {
+        int count = EnemyRegistry.Query(point, SpraySettings.ConeQueryMargin + SpraySettings.MaxEnemyHitRadius, enemyBuffer);
+        for (int i = 0; i < count; i++)
+        {
+            Collider2D body = enemyBuffer[i].BodyCollider;
+            if (body != null && body.OverlapPoint(point))
+                return enemyBuffer[i];
+        }
+        return null;
+    }
+
     /// <summary>
     /// Reset the next damage tick timer (useful when starting a burst)
     /// </summary>
@@ -237,6 +313,7 @@ public class SprayDamageHandler
     /// </summary>
     public void ClearHits()
     {
-        particleHitCounts.Clear();
+        System.Array.Clear(hitEnemies, 0, hitSlots.Count);
+        hitSlots.Clear();
     }
 }
@@ -3,22 +3,100 @@ using UnityEngine;
 /// <summary>
 /// Creates PBR-style materials for realistic spray particle effects.
 /// Handles reflection, refraction simulation, and lighting interaction.
+/// Materials and textures are baked into Resources/Baked by ProceduralTextureBaker; the Create*
+/// methods are the bake source and the fallback when no bake is present.
 /// </summary>
 public static class SprayMaterialCreator
 {
+    public const string CoreMaterialName = "SprayCoreMaterial";
+    public const string MistMaterialName = "SprayMistMaterial";
+    public const string DropletMaterialName = "SprayDropletMaterial";
+    public const string GlowMaterialName = "SprayGlowMaterial";
+    public const string SoftCircleTextureName = "SpraySoftCircle";
+    public const string DropletTextureName = "SprayDroplet";
+
+    public const int SoftCircleTextureSize = 64;
+    public const int DropletTextureSize = 32;
+
     // Cached materials
     private static Material _sprayCoreMaterial;
     private static Material _sprayMistMaterial;
     private static Material _sprayDropletMaterial;
     private static Material _sprayGlowMaterial;
+
+    // Cached textures (shared by every spray)
+    private static Texture2D _softCircleTexture;
+    private static Texture2D _dropletTexture;
     
     /// <summary>
     /// Get or create the main spray core material (dense center spray)
     /// </summary>
     public static Material GetSprayCoreMaterial()
     {
-        if (_sprayCoreMaterial != null) return _sprayCoreMaterial;
-        
+        if (_sprayCoreMaterial == null) _sprayCoreMaterial = LoadBakedMaterial(CoreMaterialName);
+        if (_sprayCoreMaterial == null) _sprayCoreMaterial = CreateSprayCoreMaterial();
+        return _sprayCoreMaterial;
+    }
+
+    /// <summary>
+    /// Get or create the mist/fog material (outer spray cloud)
+    /// </summary>
+    public static Material GetSprayMistMaterial()
+    {
+        if (_sprayMistMaterial == null) _sprayMistMaterial = LoadBakedMaterial(MistMaterialName);
+        if (_sprayMistMaterial == null) _sprayMistMaterial = CreateSprayMistMaterial();
+        return _sprayMistMaterial;
+    }
+
+    /// <summary>
+    /// Get or create the droplet material (individual visible droplets)
+    /// </summary>
+    public static Material GetSprayDropletMaterial()
+    {
+        if (_sprayDropletMaterial == null) _sprayDropletMaterial = LoadBakedMaterial(DropletMaterialName);
+        if (_sprayDropletMaterial == null) _sprayDropletMaterial = CreateSprayDropletMaterial();
+        return _sprayDropletMaterial;
+    }
+
+    /// <summary>
+    /// Get or create the glow/highlight material (bright center highlights)
+    /// </summary>
+    public static Material GetSprayGlowMaterial()
+    {
+        if (_sprayGlowMaterial == null) _sprayGlowMaterial = LoadBakedMaterial(GlowMaterialName);
+        if (_sprayGlowMaterial == null) _sprayGlowMaterial = CreateSprayGlowMaterial();
+        return _sprayGlowMaterial;
+    }
+
+    /// <summary>
+    /// Soft circle particle texture (core, mist, glow)
+    /// </summary>
+    public static Texture2D GetSoftCircleTexture()
+    {
+        if (_softCircleTexture == null) _softCircleTexture = BakedAssets.Load<Texture2D>(SoftCircleTextureName);
+        if (_softCircleTexture == null) _softCircleTexture = CreateSoftCircleTexture(SoftCircleTextureSize);
+        return _softCircleTexture;
+    }
+
+    /// <summary>
+    /// Droplet particle texture
+    /// </summary>
+    public static Texture2D GetDropletTexture()
+    {
+        if (_dropletTexture == null) _dropletTexture = BakedAssets.Load<Texture2D>(DropletTextureName);
+        if (_dropletTexture == null) _dropletTexture = CreateDropletTexture(DropletTextureSize);
+        return _dropletTexture;
+    }
+
+    private static Material LoadBakedMaterial(string name)
+    {
+        // Copy, so runtime changes (SprayLayerFactory sets mainTexture) never touch the asset
+        Material baked = BakedAssets.Load<Material>(name);
+        return baked != null ? new Material(baked) { name = name } : null;
+    }
+    
+    public static Material CreateSprayCoreMaterial()
+    {
         // Try to use URP Lit particle shader for PBR, fallback to standard
         Shader shader = Shader.Find("Universal Render Pipeline/Particles/Lit");
         if (shader == null)
@@ -26,57 +104,47 @@ public static class SprayMaterialCreator
         if (shader == null)
             shader = Shader.Find("Sprites/Default");
         
-        _sprayCoreMaterial = new Material(shader);
-        _sprayCoreMaterial.name = "SprayCoreMaterial";
+        Material material = new Material(shader);
+        material.name = CoreMaterialName;
         
         // Configure for additive blending with transparency
-        ConfigureParticleBlending(_sprayCoreMaterial, BlendMode.Additive);
+        ConfigureParticleBlending(material, BlendMode.Additive);
         
         // Set base color - bright white-blue core
         Color coreColor = new Color(0.9f, 0.95f, 1f, 0.7f);
-        SetMaterialColor(_sprayCoreMaterial, coreColor);
+        SetMaterialColor(material, coreColor);
         
         // Enable soft particles for depth blending
-        EnableSoftParticles(_sprayCoreMaterial, 0.5f);
+        EnableSoftParticles(material, 0.5f);
         
-        return _sprayCoreMaterial;
+        return material;
     }
     
-    /// <summary>
-    /// Get or create the mist/fog material (outer spray cloud)
-    /// </summary>
-    public static Material GetSprayMistMaterial()
+    public static Material CreateSprayMistMaterial()
     {
-        if (_sprayMistMaterial != null) return _sprayMistMaterial;
-        
         Shader shader = Shader.Find("Universal Render Pipeline/Particles/Unlit");
         if (shader == null)
             shader = Shader.Find("Particles/Standard Unlit");
         if (shader == null)
             shader = Shader.Find("Sprites/Default");
         
-        _sprayMistMaterial = new Material(shader);
-        _sprayMistMaterial.name = "SprayMistMaterial";
+        Material material = new Material(shader);
+        material.name = MistMaterialName;
         
         // Soft additive for fog effect
-        ConfigureParticleBlending(_sprayMistMaterial, BlendMode.SoftAdditive);
+        ConfigureParticleBlending(material, BlendMode.SoftAdditive);
         
         // Softer, more transparent mist
         Color mistColor = new Color(0.8f, 0.9f, 1f, 0.3f);
-        SetMaterialColor(_sprayMistMaterial, mistColor);
+        SetMaterialColor(material, mistColor);
         
-        EnableSoftParticles(_sprayMistMaterial, 1f);
+        EnableSoftParticles(material, 1f);
         
-        return _sprayMistMaterial;
+        return material;
     }
     
-    /// <summary>
-    /// Get or create the droplet material (individual visible droplets)
-    /// </summary>
-    public static Material GetSprayDropletMaterial()
+    public static Material CreateSprayDropletMaterial()
     {
-        if (_sprayDropletMaterial != null) return _sprayDropletMaterial;
-        
         // Try to get Lit shader for PBR reflections
         Shader shader = Shader.Find("Universal Render Pipeline/Particles/Lit");
         if (shader == null)
@@ -84,62 +152,57 @@ public static class SprayMaterialCreator
         if (shader == null)
             shader = Shader.Find("Sprites/Default");
         
-        _sprayDropletMaterial = new Material(shader);
-        _sprayDropletMaterial.name = "SprayDropletMaterial";
+        Material material = new Material(shader);
+        material.name = DropletMaterialName;
         
         // Alpha blend for solid droplets
-        ConfigureParticleBlending(_sprayDropletMaterial, BlendMode.Alpha);
+        ConfigureParticleBlending(material, BlendMode.Alpha);
         
         // Brighter droplets that catch light
         Color dropletColor = new Color(1f, 1f, 1f, 0.85f);
-        SetMaterialColor(_sprayDropletMaterial, dropletColor);
+        SetMaterialColor(material, dropletColor);
         
         // Configure metallic/smoothness for reflections
-        if (_sprayDropletMaterial.HasProperty("_Metallic"))
-            _sprayDropletMaterial.SetFloat("_Metallic", 0.1f);
-        if (_sprayDropletMaterial.HasProperty("_Smoothness"))
-            _sprayDropletMaterial.SetFloat("_Smoothness", 0.95f);
-        if (_sprayDropletMaterial.HasProperty("_Glossiness"))
-            _sprayDropletMaterial.SetFloat("_Glossiness", 0.95f);
+        if (material.HasProperty("_Metallic"))
+            material.SetFloat("_Metallic", 0.1f);
+        if (material.HasProperty("_Smoothness"))
+            material.SetFloat("_Smoothness", 0.95f);
+        if (material.HasProperty("_Glossiness"))
+            material.SetFloat("_Glossiness", 0.95f);
         
-        EnableSoftParticles(_sprayDropletMaterial, 0.3f);
+        EnableSoftParticles(material, 0.3f);
         
-        return _sprayDropletMaterial;
+        return material;
     }
     
-    /// <summary>
-    /// Get or create the glow/highlight material (bright center highlights)
-    /// </summary>
-    public static Material GetSprayGlowMaterial()
+    public static Material CreateSprayGlowMaterial()
     {
-        if (_sprayGlowMaterial != null) return _sprayGlowMaterial;
-        
         Shader shader = Shader.Find("Universal Render Pipeline/Particles/Unlit");
         if (shader == null)
             shader = Shader.Find("Particles/Standard Unlit");
         if (shader == null)
             shader = Shader.Find("Sprites/Default");
         
-        _sprayGlowMaterial = new Material(shader);
-        _sprayGlowMaterial.name = "SprayGlowMaterial";
+        Material material = new Material(shader);
+        material.name = GlowMaterialName;
         
         // Strong additive for glow
-        ConfigureParticleBlending(_sprayGlowMaterial, BlendMode.Additive);
+        ConfigureParticleBlending(material, BlendMode.Additive);
         
         // Bright white glow
         Color glowColor = new Color(1f, 1f, 1f, 0.5f);
-        SetMaterialColor(_sprayGlowMaterial, glowColor);
+        SetMaterialColor(material, glowColor);
         
         // Extra HDR intensity for bloom
-        if (_sprayGlowMaterial.HasProperty("_EmissionColor"))
+        if (material.HasProperty("_EmissionColor"))
         {
-            _sprayGlowMaterial.EnableKeyword("_EMISSION");
-            _sprayGlowMaterial.SetColor("_EmissionColor", glowColor * 2f);
+            material.EnableKeyword("_EMISSION");
+            material.SetColor("_EmissionColor", glowColor * 2f);
         }
         
-        EnableSoftParticles(_sprayGlowMaterial, 0.8f);
+        EnableSoftParticles(material, 0.8f);
         
-        return _sprayGlowMaterial;
+        return material;
     }
     
     public enum BlendMode
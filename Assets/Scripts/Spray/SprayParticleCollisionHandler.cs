@@ -16,9 +16,15 @@ public class SprayParticleCollisionHandler : MonoBehaviour
     private float damageMultiplier = 1f;
     private Vector2 sprayDirection = Vector2.right;
     
-    // Cooldown to prevent same enemy being hit too rapidly by multiple particles
-    private Dictionary<EnemyBase, float> lastHitTime = new Dictionary<EnemyBase, float>();
+    // Cooldown to prevent same enemy being hit too rapidly by multiple particles.
+    // Enemies hit in the current and previous cooldown window, keyed by EnemyBase.SpawnId; a hit
+    // older than that is past its cooldown, so swapping windows keeps the tables small.
     private const float HitCooldown = 0.05f; // 50ms between hits on same enemy
+    private EnemyIdMap currentWindow = new EnemyIdMap(64);
+    private EnemyIdMap previousWindow = new EnemyIdMap(64);
+    private float[] currentHitTimes = new float[64];
+    private float[] previousHitTimes = new float[64];
+    private float windowStart;
     
     // Reference to player stats for damage scaling
     private PlayerStats playerStats;
@@ -81,18 +87,14 @@ public class SprayParticleCollisionHandler : MonoBehaviour
         // Get collision events
         int numEvents = sprayParticles.GetCollisionEvents(other, collisionEvents);
         
-        // Check if it's an enemy
-        EnemyBase enemy = other.GetComponent<EnemyBase>();
+        // Check if it's an enemy (cached lookup, no GetComponent per collision)
+        EnemyBase enemy = EnemyRegistry.FromGameObject(other);
         if (enemy == null) return;
         
         // Check cooldown - prevent rapid multi-hit
         float currentTime = Time.time;
-        if (lastHitTime.TryGetValue(enemy, out float lastTime))
-        {
-            if (currentTime - lastTime < HitCooldown)
-                return;
-        }
-        lastHitTime[enemy] = currentTime;
+        if (IsCoolingDown(enemy.SpawnId, currentTime)) return;
+        RecordHit(enemy.SpawnId, currentTime);
         
         // Calculate damage based on number of particles that hit
         float totalDamage = numEvents * damagePerParticle * damageMultiplier;
@@ -107,12 +109,38 @@ public class SprayParticleCollisionHandler : MonoBehaviour
         enemy.TakeDamage(totalDamage, sprayDirection);
     }
     
+    private bool IsCoolingDown(int spawnId, float now)
+    {
+        if (now - windowStart >= HitCooldown)
+        {
+            // Start a new window; anything older than the previous one has cooled down
+            bool skippedWindow = now - windowStart >= HitCooldown * 2f;
+            (currentWindow, previousWindow) = (previousWindow, currentWindow);
+            (currentHitTimes, previousHitTimes) = (previousHitTimes, currentHitTimes);
+            currentWindow.Clear();
+            if (skippedWindow) previousWindow.Clear();
+            windowStart = now;
+        }
+
+        if (currentWindow.TryGet(spawnId, out int slot) && now - currentHitTimes[slot] < HitCooldown) return true;
+        return previousWindow.TryGet(spawnId, out slot) && now - previousHitTimes[slot] < HitCooldown;
+    }
+
+    private void RecordHit(int spawnId, float now)
+    {
+        int slot = currentWindow.GetOrAdd(spawnId, out _);
+        if (slot >= currentHitTimes.Length)
+            System.Array.Resize(ref currentHitTimes, currentHitTimes.Length * 2);
+        currentHitTimes[slot] = now;
+    }
+
     /// <summary>
     /// Clear cooldown tracking (call when spray stops)
     /// </summary>
     public void ClearCooldowns()
     {
-        lastHitTime.Clear();
+        currentWindow.Clear();
+        previousWindow.Clear();
     }
     
     void OnDisable()
@@ -38,9 +38,9 @@ public class SprayParticleLayers
         containerObj.transform.localPosition = Vector3.zero;
         containerObj.transform.localRotation = Quaternion.identity;
         
-        // Create textures
-        softCircleTex = SprayMaterialCreator.CreateSoftCircleTexture(64);
-        dropletTex = SprayMaterialCreator.CreateDropletTexture(32);
+        // Shared textures (baked, or generated once)
+        softCircleTex = SprayMaterialCreator.GetSoftCircleTexture();
+        dropletTex = SprayMaterialCreator.GetDropletTexture();
         
         // Create layers using factory (order matters for rendering)
         mistLayer = SprayLayerFactory.CreateMistLayer(containerObj.transform, softCircleTex);
@@ -54,18 +54,24 @@ public class SprayParticleLayers
     /// </summary>
     public void PlayBurst(int baseCount)
     {
-        PlayBurstOnSystem(coreSpray, (short)(baseCount * 1.0f));
-        PlayBurstOnSystem(mistLayer, (short)(baseCount * 0.4f));
-        PlayBurstOnSystem(dropletLayer, (short)(baseCount * 0.6f));
-        PlayBurstOnSystem(glowLayer, (short)(baseCount * 0.15f));
+        // QualityGovernor thins the bursts and drops the decorative layers under load
+        float scale = QualityGovernor.SprayParticleScale;
+        bool decor = QualityGovernor.SprayDecorLayers;
+        PlayBurstOnSystem(coreSpray, (short)(baseCount * 1.0f * scale));
+        PlayBurstOnSystem(mistLayer, decor ? (short)(baseCount * 0.4f * scale) : (short)0);
+        PlayBurstOnSystem(dropletLayer, (short)(baseCount * 0.6f * scale));
+        PlayBurstOnSystem(glowLayer, decor ? (short)(baseCount * 0.15f * scale) : (short)0);
     }
     
     private void PlayBurstOnSystem(ParticleSystem ps, short count)
     {
         if (ps == null) return;
         ps.Stop(true, ParticleSystemStopBehavior.StopEmittingAndClear);
+        if (count <= 0) return;
+
         var emission = ps.emission;
-        emission.SetBursts(new ParticleSystem.Burst[] { new ParticleSystem.Burst(0f, count) });
+        emission.burstCount = 1;
+        emission.SetBurst(0, new ParticleSystem.Burst(0f, count));
         ps.Play();
     }
     
@@ -118,7 +124,21 @@ public class SprayParticleLayers
         dropletLayer?.Stop();
         glowLayer?.Stop();
     }
-    
+
+    /// <summary>
+    /// Destroy the layers (used for the throwaway GameWarmup spray). The materials are the shared
+    /// SprayMaterialCreator ones and stay alive for the player's spray.
+    /// </summary>
+    public void Destroy()
+    {
+        if (containerObj == null) return;
+
+        Object.Destroy(containerObj);
+
+        containerObj = null;
+        coreSpray = mistLayer = dropletLayer = glowLayer = null;
+    }
+
     /// <summary>
     /// Get particle speed for damage timing
     /// </summary>
@@ -73,7 +73,10 @@ public static class SpraySettings
     public const int NozzleSortingOrder = 14;
 
     // ==================== Detection ====================
-    public const int HitBufferSize = 20;
+    public const int HitBufferSize = 256;             // Max enemies considered per cone test
+    public const float ConeQueryMargin = 1f;           // Broad-phase padding so moving enemies near the edge are not missed
+    public const float MaxEnemyHitRadius = 1.5f;       // Largest enemy collider extent a point query must cover
+    public const int MaxDamageAppliesPerFrame = 32;    // Queued spray hits applied per frame; the rest wait in order
     public const float AngleToleranceForFiring = 5f;   // Degrees - tighter tolerance for accurate aiming
     public const float MaxAimTime = 0.5f;              // Fire anyway after this long (reduced for responsiveness)
     public const float MinTargetDistance = 0.5f;       // Don't spray at targets closer than this
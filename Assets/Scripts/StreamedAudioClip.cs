@@ -0,0 +1,38 @@
+using UnityEngine;
+
+/// <summary>
+/// Gives an AudioSource its clip from a ContentBundles bundle instead of a scene reference, so
+/// long music and ambience tracks stay out of the initial download. The source starts playing
+/// once the clip arrives if Play On Awake is set; leave its AudioClip field empty.
+/// </summary>
+[RequireComponent(typeof(AudioSource))]
+public class StreamedAudioClip : MonoBehaviour
+{
+    [SerializeField] private string bundleName = ContentBundles.GameplayAudio;
+    [SerializeField] private string clipName;
+
+    private AudioSource source;
+
+    void Awake()
+    {
+        source = GetComponent<AudioSource>();
+        ContentBundles.Load<AudioClip>(bundleName, clipName, OnClipLoaded);
+    }
+
+    private void OnClipLoaded(AudioClip clip)
+    {
+        // The scene may have been left while the bundle was downloading
+        if (this == null || clip == null) return;
+
+        source.clip = clip;
+        if (source.playOnAwake && isActiveAndEnabled)
+            source.Play();
+    }
+
+    void OnEnable()
+    {
+        // Re-enabled after the clip arrived: resume like Play On Awake would
+        if (source != null && source.clip != null && source.playOnAwake && !source.isPlaying)
+            source.Play();
+    }
+}
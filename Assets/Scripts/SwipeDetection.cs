@@ -31,28 +31,28 @@ public class SwipeDetection : MonoBehaviour
 
     private void UP(float axis) {
         if (axis == 1) {
-            Debug.Log("Keyboard UP");
+            GameLog.Verbose(LogCategory.Input, "Keyboard UP");
             //playerController.QueueMove(Direction.UP); 
         }
     }
 
     private void DOWN(float axis) {
         if (axis == 1) {
-            Debug.Log("Keyboard DOWN");
+            GameLog.Verbose(LogCategory.Input, "Keyboard DOWN");
             //playerController.QueueMove(Direction.DOWN);
         }
     }
 
     private void LEFT(float axis) {
         if (axis == 1) {
-            Debug.Log("Keyboard LEFT");
+            GameLog.Verbose(LogCategory.Input, "Keyboard LEFT");
             //playerController.QueueMove(Direction.LEFT);
         }
     }
 
     private void RIGHT(float axis) {
         if (axis == 1) {
-            Debug.Log("Keyboard RIGHT");
+            GameLog.Verbose(LogCategory.Input, "Keyboard RIGHT");
             //playerController.QueueMove(Direction.RIGHT);
         }
     }
@@ -0,0 +1,159 @@
+using System.Collections.Generic;
+using UnityEngine;
+using UnityEngine.Experimental.Rendering;
+using UnityEngine.SceneManagement;
+using UnityEngine.U2D;
+
+/// <summary>
+/// Texture memory of the loaded atlases (see SpriteAtlasBuilder) and of all loaded textures,
+/// against a per-platform ceiling. Sizes are estimated from dimensions, format and mip count so the
+/// report works in release players, where the profiler API returns nothing.
+/// Refreshed on every scene load (logged, with a warning past the budget) and when a new atlas is
+/// registered; PerformanceHud shows the totals. Refreshing walks all loaded objects, so never call
+/// Refresh per frame.
+/// </summary>
+public static class TextureMemoryReport
+{
+    // iOS Safari kills tabs well below device memory; leave room for audio, meshes and the heap
+    private const long MobileBudgetBytes = 96L * 1024 * 1024;
+    private const long DesktopBudgetBytes = 384L * 1024 * 1024;
+
+    public struct AtlasEntry
+    {
+        public string name;
+        public int pages;
+        public long bytes;
+    }
+
+    private static readonly List<AtlasEntry> atlases = new List<AtlasEntry>();
+    private static readonly HashSet<Texture2D> counted = new HashSet<Texture2D>();
+    private static bool dirty = true;
+
+    /// <summary>
+    /// Loaded atlases as of the last refresh
+    /// </summary>
+    public static IReadOnlyList<AtlasEntry> Atlases => atlases;
+
+    public static long AtlasBytes { get; private set; }
+
+    /// <summary>
+    /// All loaded Texture2D memory, atlases included
+    /// </summary>
+    public static long TotalBytes { get; private set; }
+
+    public static long BudgetBytes => Application.isMobilePlatform ? MobileBudgetBytes : DesktopBudgetBytes;
+
+    public static bool OverBudget => TotalBytes > BudgetBytes;
+
+    [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.AfterSceneLoad)]
+    private static void Initialize()
+    {
+        SceneManager.sceneLoaded += HandleSceneLoaded;
+        SpriteAtlasManager.atlasRegistered += HandleAtlasRegistered;
+        Refresh(true);
+    }
+
+    private static void HandleSceneLoaded(Scene scene, LoadSceneMode mode)
+    {
+        Refresh(true);
+    }
+
+    private static void HandleAtlasRegistered(SpriteAtlas atlas)
+    {
+        dirty = true;
+    }
+
+    /// <summary>
+    /// Refresh if an atlas was registered since the last refresh (cheap otherwise)
+    /// </summary>
+    public static void RefreshIfChanged()
+    {
+        if (dirty) Refresh(false);
+    }
+
+    public static void Refresh(bool log)
+    {
+        dirty = false;
+        atlases.Clear();
+        counted.Clear();
+        AtlasBytes = 0;
+
+        // Atlas pages are the textures of packed sprites; CanBindTo tells which atlas owns them
+        SpriteAtlas[] loadedAtlases = Resources.FindObjectsOfTypeAll<SpriteAtlas>();
+        foreach (Sprite sprite in Resources.FindObjectsOfTypeAll<Sprite>())
+        {
+            if (!sprite.packed) continue;
+            Texture2D page = sprite.texture;
+            if (page == null || !counted.Add(page)) continue;
+
+            string atlasName = "(unknown atlas)";
+            foreach (SpriteAtlas atlas in loadedAtlases)
+            {
+                if (atlas.CanBindTo(sprite))
+                {
+                    atlasName = atlas.name;
+                    break;
+                }
+            }
+
+            long bytes = EstimateBytes(page);
+            AtlasBytes += bytes;
+            AddToAtlas(atlasName, bytes);
+        }
+
+        long total = 0;
+        foreach (Texture2D texture in Resources.FindObjectsOfTypeAll<Texture2D>())
+            total += EstimateBytes(texture);
+        TotalBytes = total;
+
+        if (!log) return;
+
+        foreach (AtlasEntry entry in atlases)
+            GameLog.Info(LogCategory.Rendering, $"[TextureMemoryReport] Atlas {entry.name}: {entry.pages} page(s), {ToMB(entry.bytes):F1} MB");
+
+        string summary = $"[TextureMemoryReport] Textures {ToMB(TotalBytes):F1} MB (atlases {ToMB(AtlasBytes):F1} MB) of {ToMB(BudgetBytes):F0} MB budget";
+        if (OverBudget) GameLog.Warning(LogCategory.Rendering, summary);
+        else GameLog.Info(LogCategory.Rendering, summary);
+    }
+
+    /// <summary>
+    /// GPU size of a texture (all mips), doubled when a CPU-readable copy is kept
+    /// </summary>
+    public static long EstimateBytes(Texture2D texture)
+    {
+        int width = texture.width;
+        int height = texture.height;
+        GraphicsFormat format = texture.graphicsFormat;
+
+        long bytes = 0;
+        for (int mip = 0; mip < texture.mipmapCount; mip++)
+        {
+            bytes += GraphicsFormatUtility.ComputeMipmapSize(width, height, format);
+            width = Mathf.Max(1, width / 2);
+            height = Mathf.Max(1, height / 2);
+        }
+
+        return texture.isReadable ? bytes * 2 : bytes;
+    }
+
+    public static float ToMB(long bytes)
+    {
+        return bytes / (1024f * 1024f);
+    }
+
+    private static void AddToAtlas(string atlasName, long bytes)
+    {
+        for (int i = 0; i < atlases.Count; i++)
+        {
+            if (atlases[i].name != atlasName) continue;
+
+            AtlasEntry entry = atlases[i];
+            entry.pages++;
+            entry.bytes += bytes;
+            atlases[i] = entry;
+            return;
+        }
+
+        atlases.Add(new AtlasEntry { name = atlasName, pages = 1, bytes = bytes });
+    }
+}
@@ -1,4 +1,3 @@
-using System;
 using TMPro;
 using UnityEngine;
 
@@ -6,6 +5,7 @@ public class Timer : MonoBehaviour
 {
     [SerializeField] TextMeshProUGUI timerText;
     private GameStates gameStates;
+    private int shownSeconds = -1;
 
     void Awake()
     {
@@ -21,9 +21,12 @@ public class Timer : MonoBehaviour
     
     void Update()
     {
-        if (timerText != null && gameStates != null)
-        {
-            timerText.text = TimeSpan.FromSeconds(gameStates.gameTime).ToString(@"mm\:ss");
-        }
+        if (timerText == null || gameStates == null) return;
+        
+        // mm:ss only changes once a second; SetText with numeric args doesn't allocate
+        int seconds = Mathf.FloorToInt(gameStates.gameTime);
+        if (seconds == shownSeconds) return;
+        shownSeconds = seconds;
+        timerText.SetText("{0:00}:{1:00}", (seconds / 60) % 60, seconds % 60);
     }
 }
@@ -0,0 +1,73 @@
+using System.Collections.Generic;
+using UnityEngine;
+
+/// <summary>
+/// Keeps its Camera in a static list while enabled, so ForceLandscapeAspect updates viewports
+/// without scanning every camera, and applies the current letterbox rect as soon as the camera
+/// is enabled.
+/// Scene cameras get one via AttachAll when a scene loads; cameras built at runtime add it
+/// themselves.
+/// </summary>
+[DisallowMultipleComponent]
+[RequireComponent(typeof(Camera))]
+public class TrackedCamera : MonoBehaviour
+{
+    private static readonly List<TrackedCamera> active = new List<TrackedCamera>();
+
+    /// <summary>
+    /// Enabled tracked cameras (unordered)
+    /// </summary>
+    public static IReadOnlyList<TrackedCamera> Active => active;
+
+    /// <summary>
+    /// Slot in the active list while enabled (-1 when not registered)
+    /// </summary>
+    public int ActiveIndex { get; set; } = -1;
+
+    public Camera Camera { get; private set; }
+
+    /// <summary>
+    /// Add a TrackedCamera to every camera in the loaded scenes (including inactive ones) except
+    /// those named skipName. Runs once per scene load, not per frame.
+    /// </summary>
+    public static void AttachAll(string skipName)
+    {
+        Camera[] cameras = FindObjectsByType<Camera>(FindObjectsInactive.Include, FindObjectsSortMode.None);
+        foreach (Camera cam in cameras)
+        {
+            if (cam == null || cam.gameObject.name == skipName) continue;
+            if (cam.GetComponent<TrackedCamera>() == null)
+                cam.gameObject.AddComponent<TrackedCamera>();
+        }
+    }
+
+    void Awake()
+    {
+        Camera = GetComponent<Camera>();
+    }
+
+    void OnEnable()
+    {
+        if (ActiveIndex < 0)
+        {
+            ActiveIndex = active.Count;
+            active.Add(this);
+        }
+
+        Camera.rect = ForceLandscapeAspect.ViewportRect;
+    }
+
+    void OnDisable()
+    {
+        int index = ActiveIndex;
+        if (index < 0 || index >= active.Count || active[index] != this) return;
+
+        int last = active.Count - 1;
+        TrackedCamera moved = active[last];
+        active[index] = moved;
+        moved.ActiveIndex = index;
+        active.RemoveAt(last);
+
+        ActiveIndex = -1;
+    }
+}
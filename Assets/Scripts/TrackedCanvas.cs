@@ -0,0 +1,72 @@
+using System.Collections.Generic;
+using UnityEngine;
+using UnityEngine.UI;
+
+/// <summary>
+/// Keeps its Canvas in a static list while enabled, so GraphicRegistryCleaner walks live
+/// canvases instead of calling FindObjectsByType every cleanup.
+/// Scene canvases get one via AttachAll when a scene loads; canvases built at runtime add it
+/// themselves.
+/// </summary>
+[DisallowMultipleComponent]
+[RequireComponent(typeof(Canvas))]
+public class TrackedCanvas : MonoBehaviour
+{
+    private static readonly List<TrackedCanvas> active = new List<TrackedCanvas>();
+
+    /// <summary>
+    /// Enabled tracked canvases (unordered)
+    /// </summary>
+    public static IReadOnlyList<TrackedCanvas> Active => active;
+
+    /// <summary>
+    /// Slot in the active list while enabled (-1 when not registered)
+    /// </summary>
+    public int ActiveIndex { get; set; } = -1;
+
+    public Canvas Canvas { get; private set; }
+    public GraphicRaycaster Raycaster { get; private set; }
+
+    /// <summary>
+    /// Add a TrackedCanvas to every canvas in the loaded scenes, including inactive ones.
+    /// Runs once per scene load, not per frame.
+    /// </summary>
+    public static void AttachAll()
+    {
+        Canvas[] canvases = FindObjectsByType<Canvas>(FindObjectsInactive.Include, FindObjectsSortMode.None);
+        foreach (Canvas canvas in canvases)
+        {
+            if (canvas != null && canvas.GetComponent<TrackedCanvas>() == null)
+                canvas.gameObject.AddComponent<TrackedCanvas>();
+        }
+    }
+
+    void Awake()
+    {
+        Canvas = GetComponent<Canvas>();
+    }
+
+    void OnEnable()
+    {
+        // Raycasters are sometimes added after the canvas (ThisCanvas), so look it up per enable
+        Raycaster = GetComponent<GraphicRaycaster>();
+
+        if (ActiveIndex >= 0) return;
+        ActiveIndex = active.Count;
+        active.Add(this);
+    }
+
+    void OnDisable()
+    {
+        int index = ActiveIndex;
+        if (index < 0 || index >= active.Count || active[index] != this) return;
+
+        int last = active.Count - 1;
+        TrackedCanvas moved = active[last];
+        active[index] = moved;
+        moved.ActiveIndex = index;
+        active.RemoveAt(last);
+
+        ActiveIndex = -1;
+    }
+}
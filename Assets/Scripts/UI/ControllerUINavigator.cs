@@ -190,27 +190,8 @@ public class ControllerUINavigator : MonoBehaviour
     {
         if (Time.unscaledTime - lastInputTime < inputRepeatDelay) return;
         
-        Vector2 nav = Vector2.zero;
-        
-        // Check keyboard
-        if (Input.GetKey(KeyCode.LeftArrow) || Input.GetKey(KeyCode.A)) nav.x = -1;
-        else if (Input.GetKey(KeyCode.RightArrow) || Input.GetKey(KeyCode.D)) nav.x = 1;
-        if (Input.GetKey(KeyCode.UpArrow) || Input.GetKey(KeyCode.W)) nav.y = 1;
-        else if (Input.GetKey(KeyCode.DownArrow) || Input.GetKey(KeyCode.S)) nav.y = -1;
-        
-        // Check gamepad
-        if (Gamepad.current != null)
-        {
-            Vector2 dpad = Gamepad.current.dpad.ReadValue();
-            Vector2 stick = Gamepad.current.leftStick.ReadValue();
-            
-            if (Mathf.Abs(dpad.x) > 0.5f) nav.x = Mathf.Sign(dpad.x);
-            else if (Mathf.Abs(stick.x) > 0.5f) nav.x = Mathf.Sign(stick.x);
-            
-            if (Mathf.Abs(dpad.y) > 0.5f) nav.y = Mathf.Sign(dpad.y);
-            else if (Mathf.Abs(stick.y) > 0.5f) nav.y = Mathf.Sign(stick.y);
-        }
-        
+        // Keyboard, then gamepad d-pad / stick (InputSampler)
+        Vector2 nav = InputSampler.Current.navigate;
         if (nav == Vector2.zero) return;
         
         int newIndex = currentIndex;
@@ -239,19 +220,8 @@ public class ControllerUINavigator : MonoBehaviour
     
     private void HandleSubmitInput()
     {
-        bool submit = false;
-        
-        // Keyboard
-        if (Input.GetKeyDown(KeyCode.Return) || Input.GetKeyDown(KeyCode.Space))
-        {
-            submit = true;
-        }
-        
-        // Gamepad A button (South)
-        if (Gamepad.current != null && Gamepad.current.buttonSouth.wasPressedThisFrame)
-        {
-            submit = true;
-        }
+        // Return / Space / gamepad A (South)
+        bool submit = InputSampler.Current.submit;
         
         if (submit && currentIndex >= 0 && currentIndex < navigableButtons.Count)
         {
@@ -376,10 +346,6 @@ public class ControllerUINavigator : MonoBehaviour
     /// </summary>
     public static bool WasBackButtonPressed()
     {
-        if (Gamepad.current != null)
-        {
-            return Gamepad.current.buttonEast.wasPressedThisFrame;
-        }
-        return false;
+        return InputSampler.Current.back;
     }
 }
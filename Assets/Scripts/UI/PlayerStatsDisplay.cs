@@ -4,12 +4,16 @@ using TMPro;
 /// <summary>
 /// Displays current player stats in the pause menu with color coding.
 /// White = base stat, Green = positive bonus, Red = negative penalty
+/// The text is rebuilt only when PlayerStats.Version has moved since the last build.
 /// </summary>
 public class PlayerStatsDisplay : MonoBehaviour
 {
     [SerializeField] private TextMeshProUGUI statsText;
     
     private PlayerStats playerStats;
+    private readonly System.Text.StringBuilder sb = new System.Text.StringBuilder(512);
+    private int builtVersion = -1;
+    private bool dirty;
     
     // Track stat changes from base values
     private float baseMaxHealth = 100f;
@@ -26,11 +30,32 @@ public class PlayerStatsDisplay : MonoBehaviour
     
     void OnEnable()
     {
+        // Listen only while shown
+        if (playerStats == null) playerStats = FindAnyObjectByType<PlayerStats>();
+        if (playerStats != null) playerStats.StatsChanged += OnStatsChanged;
         RefreshStats();
     }
     
+    void OnDisable()
+    {
+        if (playerStats != null) playerStats.StatsChanged -= OnStatsChanged;
+        dirty = false;
+    }
+    
+    void LateUpdate()
+    {
+        // Coalesce every change made this frame into one rebuild
+        if (dirty) RefreshStats();
+    }
+    
+    private void OnStatsChanged(PlayerStats stats)
+    {
+        dirty = true;
+    }
+    
     public void RefreshStats()
     {
+        dirty = false;
         if (playerStats == null)
         {
             playerStats = FindAnyObjectByType<PlayerStats>();
@@ -59,8 +84,11 @@ public class PlayerStatsDisplay : MonoBehaviour
             }
         }
         
+        if (statsText == null || playerStats.Version == builtVersion) return;
+        builtVersion = playerStats.Version;
+        
         // Build stats display with color coding
-        System.Text.StringBuilder sb = new System.Text.StringBuilder();
+        sb.Clear();
         sb.AppendLine("<size=24><b>PLAYER STATS</b></size>");
         sb.AppendLine();
         
@@ -82,7 +110,7 @@ public class PlayerStatsDisplay : MonoBehaviour
         sb.AppendLine(FormatStat("Regen", playerStats.CurrentHealthRegen, baseRegen, false, false, "/s", 1));
         sb.AppendLine(FormatStat("Lifesteal", playerStats.CurrentLifeSteal, baseLifeSteal, false, false, "%"));
         
-        statsText.text = sb.ToString();
+        statsText.SetText(sb);
     }
     
     private string FormatStat(string name, float value, float baseValue, bool lowerIsBetter = false, bool noColor = false, string suffix = "", int decimals = 0)
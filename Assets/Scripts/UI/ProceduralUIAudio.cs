@@ -3,12 +3,16 @@ using UnityEngine;
 /// <summary>
 /// Procedural audio generator for UI navigation sounds.
 /// Provides hover (navigation) and select (confirm) sounds.
+/// The sounds are rendered once and streamed from their samples by ProceduralAudioMixer where it
+/// exists, or kept as AudioClips for AudioVoiceManager.
 /// </summary>
 public static class ProceduralUIAudio
 {
-    private static AudioSource sharedAudioSource;
     private static int sampleRate;
-    private static float[] audioBuffer;
+    
+    private static float[] hoverSamples;
+    private static float[] selectSamples;
+    private static float[] levelUpSelectSamples;
     
     private static AudioClip hoverClip;
     private static AudioClip selectClip;
@@ -20,35 +24,46 @@ public static class ProceduralUIAudio
     
     private static void EnsureInitialized()
     {
-        if (sharedAudioSource == null)
+        if (hoverSamples == null)
         {
-            GameObject audioObj = new GameObject("UIAudio");
-            Object.DontDestroyOnLoad(audioObj);
-            sharedAudioSource = audioObj.AddComponent<AudioSource>();
-            sharedAudioSource.playOnAwake = false;
-            sharedAudioSource.spatialBlend = 0f;
-            
             sampleRate = AudioSettings.outputSampleRate;
-            int maxSamples = Mathf.CeilToInt(0.3f * sampleRate);
-            audioBuffer = new float[maxSamples];
             
-            // Pre-generate clips
-            hoverClip = GenerateHoverSound();
-            selectClip = GenerateSelectSound();
-            levelUpSelectClip = GenerateLevelUpSelectSound();
+            // Pre-generate sounds
+            hoverSamples = GenerateHoverSound();
+            selectSamples = GenerateSelectSound();
+            levelUpSelectSamples = GenerateLevelUpSelectSound();
+            
+            if (!ProceduralAudioMixer.Supported)
+            {
+                hoverClip = CreateClip("UIHover", hoverSamples);
+                selectClip = CreateClip("UISelect", selectSamples);
+                levelUpSelectClip = CreateClip("UILevelUpSelect", levelUpSelectSamples);
+            }
         }
     }
     
+    private static AudioClip CreateClip(string name, float[] samples)
+    {
+        AudioClip clip = AudioClip.Create(name, samples.Length, 1, sampleRate, false);
+        clip.SetData(samples, 0);
+        return clip;
+    }
+    
+    private static void Play(float[] samples, AudioClip clip, float volume)
+    {
+        if (ProceduralAudioMixer.Supported)
+            ProceduralAudioMixer.Play(samples, AudioVoiceCategory.UI, volume);
+        else if (clip != null)
+            AudioVoiceManager.Play(clip, AudioVoiceCategory.UI, volume);
+    }
+    
     /// <summary>
     /// Play a subtle tick/blip sound when hovering over a UI element
     /// </summary>
     public static void PlayHover()
     {
         EnsureInitialized();
-        if (hoverClip != null)
-        {
-            sharedAudioSource.PlayOneShot(hoverClip, HoverVolume);
-        }
+        Play(hoverSamples, hoverClip, HoverVolume);
     }
     
     /// <summary>
@@ -57,10 +72,7 @@ public static class ProceduralUIAudio
     public static void PlaySelect()
     {
         EnsureInitialized();
-        if (selectClip != null)
-        {
-            sharedAudioSource.PlayOneShot(selectClip, SelectVolume);
-        }
+        Play(selectSamples, selectClip, SelectVolume);
     }
     
     /// <summary>
@@ -69,16 +81,13 @@ public static class ProceduralUIAudio
     public static void PlayLevelUpSelect()
     {
         EnsureInitialized();
-        if (levelUpSelectClip != null)
-        {
-            sharedAudioSource.PlayOneShot(levelUpSelectClip, LevelUpSelectVolume);
-        }
+        Play(levelUpSelectSamples, levelUpSelectClip, LevelUpSelectVolume);
     }
     
     /// <summary>
     /// Generates a short, subtle tick sound for navigation
     /// </summary>
-    private static AudioClip GenerateHoverSound()
+    private static float[] GenerateHoverSound()
     {
         float duration = 0.06f;
         int numSamples = Mathf.CeilToInt(duration * sampleRate);
@@ -118,15 +127,13 @@ public static class ProceduralUIAudio
         // Normalize
         NormalizeSamples(samples, 0.7f);
         
-        AudioClip clip = AudioClip.Create("UIHover", numSamples, 1, sampleRate, false);
-        clip.SetData(samples, 0);
-        return clip;
+        return samples;
     }
     
     /// <summary>
     /// Generates a satisfying confirm/select sound
     /// </summary>
-    private static AudioClip GenerateSelectSound()
+    private static float[] GenerateSelectSound()
     {
         float duration = 0.15f;
         int numSamples = Mathf.CeilToInt(duration * sampleRate);
@@ -164,16 +171,14 @@ public static class ProceduralUIAudio
         // Normalize
         NormalizeSamples(samples, 0.8f);
         
-        AudioClip clip = AudioClip.Create("UISelect", numSamples, 1, sampleRate, false);
-        clip.SetData(samples, 0);
-        return clip;
+        return samples;
     }
     
     /// <summary>
     /// Generates an epic, hyped sound for level-up stat selection
     /// Three-tone ascending arpeggio with shimmer
     /// </summary>
-    private static AudioClip GenerateLevelUpSelectSound()
+    private static float[] GenerateLevelUpSelectSound()
     {
         float duration = 0.28f;
         int numSamples = Mathf.CeilToInt(duration * sampleRate);
@@ -240,22 +245,11 @@ public static class ProceduralUIAudio
         
         NormalizeSamples(samples, 0.85f);
         
-        AudioClip clip = AudioClip.Create("UILevelUpSelect", numSamples, 1, sampleRate, false);
-        clip.SetData(samples, 0);
-        return clip;
+        return samples;
     }
     
     private static void NormalizeSamples(float[] samples, float targetPeak)
     {
-        float maxAmp = 0f;
-        for (int i = 0; i < samples.Length; i++)
-            maxAmp = Mathf.Max(maxAmp, Mathf.Abs(samples[i]));
-        
-        if (maxAmp > 0.01f)
-        {
-            float normalize = targetPeak / maxAmp;
-            for (int i = 0; i < samples.Length; i++)
-                samples[i] *= normalize;
-        }
+        ProceduralDsp.NormalizePeak(samples, samples.Length, targetPeak);
     }
 }
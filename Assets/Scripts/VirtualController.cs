@@ -61,10 +61,15 @@ public class VirtualController : MonoBehaviour
     [SerializeField] private Color pauseIconColor = new Color(1f, 1f, 1f, 0.95f);
 
     private Vector2 joystickInput;
+    private double joystickInputTime;
     private bool isDragging;
     private int dragFingerId = -1;
     private bool wasPortrait;
     private float lastOrientationCheck;
+    private const int RingTextureSize = 128;
+    private const int HandleTextureSize = 64;
+    private const int PauseTextureSize = 64;
+
     private static Texture2D cachedRingTexture;
     private static Texture2D cachedHandleTexture;
     private static Texture2D cachedPauseButtonTexture;
@@ -80,7 +85,7 @@ public class VirtualController : MonoBehaviour
         
         // Check if user explicitly chose to show/hide virtual controller via main menu
         // 0 = hide (Play button), 1 = show (Play on Mobile button), -1 = not set (use auto-detection)
-        int showControllerPref = PlayerPrefs.GetInt("ShowVirtualController", -1);
+        int showControllerPref = SaveService.GetInt(SaveService.ShowVirtualControllerKey, -1);
         
         bool showController;
         if (showControllerPref == 0)
@@ -271,7 +276,7 @@ public class VirtualController : MonoBehaviour
         SetupPauseButton();
         SetupPauseButtonVisual();
         
-        // Clear cached textures to ensure colors are current (important after code changes)
+        // Clear cached fallback textures to ensure colors are current (important after code changes)
         cachedRingTexture = null;
         cachedHandleTexture = null;
         cachedPauseButtonTexture = null;
@@ -293,11 +298,16 @@ public class VirtualController : MonoBehaviour
             Image bgImage = joystickBackground.GetComponent<Image>();
             if (bgImage != null)
             {
-                if (cachedRingTexture == null)
+                // Baked by ProceduralTextureBaker; generate only when missing or stale
+                Sprite ringSprite = BakedAssets.Load<Sprite>(BakedSpriteName("Ring"));
+                if (ringSprite == null)
                 {
-                    cachedRingTexture = CreateRingTexture(128, ringThickness, ringColor, fillColor);
+                    if (cachedRingTexture == null)
+                    {
+                        cachedRingTexture = CreateRingTexture(RingTextureSize, ringThickness, ringColor, fillColor);
+                    }
+                    ringSprite = Sprite.Create(cachedRingTexture, new Rect(0, 0, RingTextureSize, RingTextureSize), new Vector2(0.5f, 0.5f), 100f);
                 }
-                Sprite ringSprite = Sprite.Create(cachedRingTexture, new Rect(0, 0, 128, 128), new Vector2(0.5f, 0.5f), 100f);
                 bgImage.sprite = ringSprite;
                 bgImage.type = Image.Type.Simple;
                 bgImage.color = Color.white; // Use white to show texture colors as-is
@@ -310,11 +320,15 @@ public class VirtualController : MonoBehaviour
             Image handleImage = joystickHandle.GetComponent<Image>();
             if (handleImage != null)
             {
-                if (cachedHandleTexture == null)
+                Sprite handleSprite = BakedAssets.Load<Sprite>(BakedSpriteName("Handle"));
+                if (handleSprite == null)
                 {
-                    cachedHandleTexture = CreateCircleTexture(64, handleColor, handleBorderColor);
+                    if (cachedHandleTexture == null)
+                    {
+                        cachedHandleTexture = CreateCircleTexture(HandleTextureSize, handleColor, handleBorderColor);
+                    }
+                    handleSprite = Sprite.Create(cachedHandleTexture, new Rect(0, 0, HandleTextureSize, HandleTextureSize), new Vector2(0.5f, 0.5f), 100f);
                 }
-                Sprite handleSprite = Sprite.Create(cachedHandleTexture, new Rect(0, 0, 64, 64), new Vector2(0.5f, 0.5f), 100f);
                 handleImage.sprite = handleSprite;
                 handleImage.type = Image.Type.Simple;
                 handleImage.color = Color.white; // Use white to show texture colors as-is
@@ -325,6 +339,31 @@ public class VirtualController : MonoBehaviour
         }
     }
     
+    /// <summary>
+    /// Resources name of a baked sprite for this controller's visual settings
+    /// </summary>
+    public string BakedSpriteName(string part)
+    {
+        int hash = BakedAssets.Hash(BakedAssets.HashSeed, Mathf.RoundToInt(ringThickness * 100f));
+        hash = BakedAssets.Hash(hash, ringColor);
+        hash = BakedAssets.Hash(hash, fillColor);
+        hash = BakedAssets.Hash(hash, handleColor);
+        hash = BakedAssets.Hash(hash, handleBorderColor);
+        hash = BakedAssets.Hash(hash, pauseButtonColor);
+        hash = BakedAssets.Hash(hash, pauseIconColor);
+        return $"VirtualController_{part}_{hash:x8}";
+    }
+
+    /// <summary>
+    /// Render the ring, handle and pause textures with this controller's settings (ProceduralTextureBaker)
+    /// </summary>
+    public void RenderTextures(out Texture2D ring, out Texture2D handle, out Texture2D pause)
+    {
+        ring = CreateRingTexture(RingTextureSize, ringThickness, ringColor, fillColor);
+        handle = CreateCircleTexture(HandleTextureSize, handleColor, handleBorderColor);
+        pause = CreatePauseIconTexture(PauseTextureSize, pauseButtonColor, pauseIconColor);
+    }
+
     private Texture2D CreateRingTexture(int size, float thickness, Color ringCol, Color fillCol)
     {
         Texture2D texture = new Texture2D(size, size, TextureFormat.RGBA32, false);
@@ -455,11 +494,15 @@ public class VirtualController : MonoBehaviour
         Image buttonImage = pauseButton.GetComponent<Image>();
         if (buttonImage != null)
         {
-            if (cachedPauseButtonTexture == null)
+            Sprite pauseSprite = BakedAssets.Load<Sprite>(BakedSpriteName("Pause"));
+            if (pauseSprite == null)
             {
-                cachedPauseButtonTexture = CreatePauseIconTexture(64, pauseButtonColor, pauseIconColor);
+                if (cachedPauseButtonTexture == null)
+                {
+                    cachedPauseButtonTexture = CreatePauseIconTexture(PauseTextureSize, pauseButtonColor, pauseIconColor);
+                }
+                pauseSprite = Sprite.Create(cachedPauseButtonTexture, new Rect(0, 0, PauseTextureSize, PauseTextureSize), new Vector2(0.5f, 0.5f), 100f);
             }
-            Sprite pauseSprite = Sprite.Create(cachedPauseButtonTexture, new Rect(0, 0, 64, 64), new Vector2(0.5f, 0.5f), 100f);
             buttonImage.sprite = pauseSprite;
             buttonImage.type = Image.Type.Simple;
             buttonImage.color = Color.white;
@@ -565,7 +608,7 @@ public class VirtualController : MonoBehaviour
 
     private void Update()
     {
-        // Only process joystick input on mobile
+        // Only lay out the joystick on mobile (its touches are processed by InputSampler)
         if (!IsMobilePlatform()) return;
         
         // Check for orientation changes using screen dimensions (more reliable than Screen.orientation)
@@ -578,12 +621,23 @@ public class VirtualController : MonoBehaviour
             if (isPortrait != wasPortrait)
             {
                 wasPortrait = isPortrait;
-                Debug.Log($"[VirtualController] Orientation changed - isPortrait: {isPortrait}, screen: {Screen.width}x{Screen.height}");
+                GameLog.Info(LogCategory.Input, $"[VirtualController] Orientation changed - isPortrait: {isPortrait}, screen: {Screen.width}x{Screen.height}");
                 UpdateLayoutForOrientation();
             }
         }
+    }
 
-        HandleJoystickInput();
+    /// <summary>
+    /// Process this frame's touches and return the joystick value. Called once per frame by
+    /// InputSampler before FixedUpdate; eventTime is the timestamp of the touch that last changed it.
+    /// </summary>
+    public Vector2 SampleJoystick(out double eventTime)
+    {
+        if (IsMobilePlatform())
+            HandleJoystickInput();
+
+        eventTime = joystickInputTime;
+        return joystickInput;
     }
 
     private void SetupActionButton()
@@ -626,18 +680,19 @@ public class VirtualController : MonoBehaviour
                 {
                     isDragging = true;
                     dragFingerId = touch.finger.index;
-                    Debug.Log($"[VirtualController] Touch began on joystick, finger: {dragFingerId}");
+                    GameLog.Verbose(LogCategory.Input, $"[VirtualController] Touch began on joystick, finger: {dragFingerId}");
                 }
             }
             else if (touch.finger.index == dragFingerId)
             {
                 if (touch.phase == TouchPhase.Moved || touch.phase == TouchPhase.Stationary)
                 {
-                    UpdateJoystickPosition(touch.screenPosition);
+                    UpdateJoystickPosition(touch.screenPosition, touch.time);
                 }
                 else if (touch.phase == TouchPhase.Ended || touch.phase == TouchPhase.Canceled)
                 {
                     ResetJoystick();
+                    joystickInputTime = touch.time;
                 }
             }
         }
@@ -652,11 +707,12 @@ public class VirtualController : MonoBehaviour
             }
             if (isDragging && Input.GetMouseButton(0))
             {
-                UpdateJoystickPosition(Input.mousePosition);
+                UpdateJoystickPosition(Input.mousePosition, Time.realtimeSinceStartupAsDouble);
             }
             if (Input.GetMouseButtonUp(0))
             {
                 ResetJoystick();
+                joystickInputTime = Time.realtimeSinceStartupAsDouble;
             }
         }
         #endif
@@ -671,8 +727,10 @@ public class VirtualController : MonoBehaviour
         return localPoint.magnitude <= radius * 1.5f; // Slightly larger touch area
     }
 
-    private void UpdateJoystickPosition(Vector2 screenPosition)
+    private void UpdateJoystickPosition(Vector2 screenPosition, double time)
     {
+        Vector2 previous = joystickInput;
+
         RectTransformUtility.ScreenPointToLocalPointInRectangle(
             joystickBackground, screenPosition, canvas.worldCamera, out Vector2 localPoint);
 
@@ -688,6 +746,9 @@ public class VirtualController : MonoBehaviour
         {
             joystickInput = Vector2.zero;
         }
+
+        if (joystickInput != previous)
+            joystickInputTime = time;
     }
 
     private void ResetJoystick()
@@ -49,7 +49,7 @@ public class VirtualControllerMenuNavigation : MonoBehaviour
     {
         if (VirtualController.Instance == null) return;
 
-        Vector2 input = VirtualController.Instance.JoystickInput;
+        Vector2 input = InputSampler.Current.joystick;
         
         // Check if joystick moved past threshold
         if (input.magnitude > joystickThreshold && Time.time - lastNavigationTime > navigationDelay)
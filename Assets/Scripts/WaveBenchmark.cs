@@ -0,0 +1,386 @@
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using Unity.Profiling;
+using UnityEngine;
+using UnityEngine.SceneManagement;
+using Debug = UnityEngine.Debug;
+using Random = UnityEngine.Random;
+
+/// <summary>
+/// Deterministic wave-scaling benchmark. Loads the game scene with a seeded UnityEngine.Random,
+/// makes the player invulnerable and walks it through a fixed input trace, then drives WaveGenerator
+/// through synthetic waves of increasing size and writes frame-time percentiles, FixedUpdate cost,
+/// GC allocations and peak memory per wave to a JSON report.
+///
+/// Game time advances a fixed 1/60s per frame (Time.captureDeltaTime) so every run simulates the
+/// same thing no matter how fast the machine is; only the measured wall-clock times differ.
+///
+/// Started from the command line, in a player or in the editor (see WaveBenchmarkCli):
+///   -waveBenchmark [-benchmarkOut path.json] [-benchmarkSeed 1234] [-benchmarkScene Game]
+///   [-benchmarkWaves 50,200,500,1000] [-benchmarkFrames 600]
+/// </summary>
+public class WaveBenchmark : MonoBehaviour
+{
+    private const string RunArg = "-waveBenchmark";
+    private const string EditorRunKey = "WaveBenchmark.Run";
+    private const float SimulatedFrameRate = 60f;
+    private const int RampExtraFrames = 60;   // Frames after the last spawn before sampling starts
+
+    // Fixed input trace, looped: (direction, seconds)
+    private static readonly Vector2[] TraceDirections =
+    {
+        new Vector2(1f, 0f), new Vector2(0f, 1f), new Vector2(-1f, 0f), new Vector2(0f, -1f),
+        new Vector2(0.707f, 0.707f), Vector2.zero, new Vector2(-0.707f, -0.707f), Vector2.zero,
+    };
+    private static readonly float[] TraceDurations = { 2f, 1.5f, 2f, 1.5f, 1f, 0.5f, 1f, 0.5f };
+
+    private string outputPath;
+    private string sceneName = "Game";
+    private int seed = 1234;
+    private int sampleFrames = 600;
+    private int[] waveSizes = { 50, 200, 500, 1000 };
+
+    private PlayerInputHandler playerInput;
+    private LevelUpScreen levelUpScreen;
+    private float traceStartTime;
+
+    private ProfilerRecorder gcAllocRecorder;
+    private ProfilerRecorder totalMemoryRecorder;
+
+    [Serializable]
+    private class Report
+    {
+        public string scene;
+        public int seed;
+        public string unityVersion;
+        public string platform;
+        public string device;
+        public string timestamp;
+        public float simulatedFrameRate;
+        public Scenario[] scenarios;
+    }
+
+    [Serializable]
+    private class Scenario
+    {
+        public int enemyCount;
+        public int frames;
+        public int aliveAtStart;
+        public int aliveAtEnd;
+        public float frameMsMean;
+        public float frameMsP50;
+        public float frameMsP90;
+        public float frameMsP99;
+        public float frameMsMax;
+        public float simulationMsMean;
+        public float renderSubmitMsMean;
+        public float fixedUpdateMsMean;
+        public float fixedUpdateMsP99;
+        public long gcAllocatedBytes;
+        public float gcAllocatedBytesPerFrame;
+        public int gcCollections;
+        public float peakTotalMemoryMB;
+        public float peakManagedHeapMB;
+    }
+
+    [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.BeforeSceneLoad)]
+    private static void Bootstrap()
+    {
+        if (!IsRequested()) return;
+
+        GameObject obj = new GameObject("WaveBenchmark");
+        DontDestroyOnLoad(obj);
+        obj.AddComponent<WaveBenchmark>();
+    }
+
+    private static bool IsRequested()
+    {
+#if UNITY_EDITOR
+        // Set by WaveBenchmarkCli before entering play mode
+        if (UnityEditor.SessionState.GetBool(EditorRunKey, false))
+        {
+            UnityEditor.SessionState.EraseBool(EditorRunKey);
+            return true;
+        }
+#endif
+        return Array.IndexOf(Environment.GetCommandLineArgs(), RunArg) >= 0;
+    }
+
+    void Awake()
+    {
+        ParseArguments();
+        if (string.IsNullOrEmpty(outputPath))
+            outputPath = Path.Combine(Application.persistentDataPath, "wave-benchmark.json");
+    }
+
+    void Start()
+    {
+        StartCoroutine(Run());
+    }
+
+    void OnDestroy()
+    {
+        gcAllocRecorder.Dispose();
+        totalMemoryRecorder.Dispose();
+        Time.captureDeltaTime = 0f;
+    }
+
+    void Update()
+    {
+        // Scripted movement; the input handler applies it in the player's FixedUpdate
+        if (playerInput != null)
+            playerInput.InputOverride = EvaluateTrace(Time.time - traceStartTime);
+
+        // Level-ups pause the game - always take the first upgrade so runs stay identical
+        if (levelUpScreen != null && levelUpScreen.IsShowing())
+            levelUpScreen.SelectUpgrade(0);
+    }
+
+    private void ParseArguments()
+    {
+        string[] args = Environment.GetCommandLineArgs();
+        for (int i = 0; i < args.Length - 1; i++)
+        {
+            string value = args[i + 1];
+            switch (args[i])
+            {
+                case "-benchmarkOut":
+                    outputPath = value;
+                    break;
+                case "-benchmarkScene":
+                    sceneName = value;
+                    break;
+                case "-benchmarkSeed":
+                    if (int.TryParse(value, out int parsedSeed)) seed = parsedSeed;
+                    break;
+                case "-benchmarkFrames":
+                    if (int.TryParse(value, out int frames) && frames > 0) sampleFrames = frames;
+                    break;
+                case "-benchmarkWaves":
+                    var sizes = new List<int>();
+                    foreach (string part in value.Split(','))
+                    {
+                        if (int.TryParse(part, out int size) && size > 0) sizes.Add(size);
+                    }
+                    if (sizes.Count > 0) waveSizes = sizes.ToArray();
+                    break;
+            }
+        }
+    }
+
+    private IEnumerator Run()
+    {
+        Debug.Log($"[WaveBenchmark] Scene '{sceneName}', seed {seed}, waves {string.Join(",", waveSizes)}, {sampleFrames} frames each");
+
+        Application.runInBackground = true;
+        QualitySettings.vSyncCount = 0;
+        Application.targetFrameRate = -1;
+        Time.captureDeltaTime = 1f / SimulatedFrameRate;
+        QualityGovernor.Governing = false;   // Would change physics rate and spray load mid-run
+        FrameRateOptimizer.InstallFrameMarkers();
+
+        Random.InitState(seed);
+        yield return SceneManager.LoadSceneAsync(sceneName);
+        yield return null;   // Let Start run on the scene's objects
+
+        WaveGenerator waveGenerator = FindAnyObjectByType<WaveGenerator>();
+        PlayerStats playerStats = FindAnyObjectByType<PlayerStats>();
+        List<GameObject> prefabs = CollectEnemyPrefabs(waveGenerator);
+        if (waveGenerator == null || playerStats == null || prefabs.Count == 0)
+        {
+            Debug.LogError("[WaveBenchmark] Scene has no WaveGenerator, player or enemy prefabs - aborting");
+            Quit(1);
+            yield break;
+        }
+
+        playerStats.Invulnerable = true;
+        if (waveGenerator.Spawner != null)
+            waveGenerator.Spawner.Throttling = false;   // Frame-time throttling would make runs machine-dependent
+        playerInput = playerStats.GetComponentInChildren<PlayerInputHandler>();
+        levelUpScreen = FindAnyObjectByType<LevelUpScreen>();
+
+        gcAllocRecorder = ProfilerRecorder.StartNew(ProfilerCategory.Memory, "GC Allocated In Frame");
+        totalMemoryRecorder = ProfilerRecorder.StartNew(ProfilerCategory.Memory, "Total Used Memory");
+
+        var scenarios = new List<Scenario>();
+        foreach (int size in waveSizes)
+        {
+            ClearEnemies();
+            Random.InitState(seed + size);
+            traceStartTime = Time.time;
+
+            // Spawn interval 0 releases the wave as fast as the spawner's per-frame cap allows
+            WaveConfig config = ScriptableObject.CreateInstance<WaveConfig>();
+            config.enemyPrefabs = prefabs.ToArray();
+            config.enemyCount = size;
+            config.spawnInterval = 0f;
+            waveGenerator.RunWave(config);
+
+            for (int frame = 0; frame < size + RampExtraFrames; frame++)
+                yield return null;
+
+            Scenario scenario = new Scenario { enemyCount = size };
+            yield return Sample(scenario);
+            scenarios.Add(scenario);
+            Destroy(config);
+
+            Debug.Log($"[WaveBenchmark] {size} enemies: p50 {scenario.frameMsP50:F2}ms, p99 {scenario.frameMsP99:F2}ms, " +
+                      $"fixed {scenario.fixedUpdateMsMean:F2}ms, GC {scenario.gcAllocatedBytesPerFrame:F0} B/frame");
+        }
+
+        WriteReport(scenarios);
+        Quit(0);
+    }
+
+    private IEnumerator Sample(Scenario scenario)
+    {
+        var frameMs = new float[sampleFrames];
+        var fixedMs = new float[sampleFrames];
+        double simulationTotal = 0.0;
+        double renderTotal = 0.0;
+        long allocated = 0;
+        long peakTotal = 0;
+        long peakManaged = 0;
+        long lastManaged = GC.GetTotalMemory(false);
+        int collectionsStart = GC.CollectionCount(0);
+
+        scenario.aliveAtStart = EnemySimulationManager.EnemyCount;
+
+        Stopwatch clock = Stopwatch.StartNew();
+        long lastTicks = clock.ElapsedTicks;
+        for (int i = 0; i < sampleFrames; i++)
+        {
+            yield return null;
+
+            long ticks = clock.ElapsedTicks;
+            frameMs[i] = (float)((ticks - lastTicks) * 1000.0 / Stopwatch.Frequency);
+            lastTicks = ticks;
+
+            fixedMs[i] = FrameRateOptimizer.FixedUpdateMs;
+            simulationTotal += FrameRateOptimizer.SimulationMs;
+            renderTotal += FrameRateOptimizer.RenderSubmitMs;
+
+            // Profiler counters where available, managed heap growth otherwise (release players)
+            long managed = GC.GetTotalMemory(false);
+            allocated += gcAllocRecorder.Valid ? gcAllocRecorder.LastValue : Math.Max(0L, managed - lastManaged);
+            lastManaged = managed;
+
+            long total = totalMemoryRecorder.Valid ? totalMemoryRecorder.LastValue : UnityEngine.Profiling.Profiler.GetTotalAllocatedMemoryLong();
+            peakTotal = Math.Max(peakTotal, total);
+            peakManaged = Math.Max(peakManaged, managed);
+        }
+
+        scenario.frames = sampleFrames;
+        scenario.aliveAtEnd = EnemySimulationManager.EnemyCount;
+        scenario.simulationMsMean = (float)(simulationTotal / sampleFrames);
+        scenario.renderSubmitMsMean = (float)(renderTotal / sampleFrames);
+        scenario.gcAllocatedBytes = allocated;
+        scenario.gcAllocatedBytesPerFrame = (float)allocated / sampleFrames;
+        scenario.gcCollections = GC.CollectionCount(0) - collectionsStart;
+        scenario.peakTotalMemoryMB = peakTotal / (1024f * 1024f);
+        scenario.peakManagedHeapMB = peakManaged / (1024f * 1024f);
+
+        scenario.frameMsMean = Mean(frameMs);
+        scenario.fixedUpdateMsMean = Mean(fixedMs);
+        Array.Sort(frameMs);
+        Array.Sort(fixedMs);
+        scenario.frameMsP50 = Percentile(frameMs, 0.5f);
+        scenario.frameMsP90 = Percentile(frameMs, 0.9f);
+        scenario.frameMsP99 = Percentile(frameMs, 0.99f);
+        scenario.frameMsMax = frameMs[frameMs.Length - 1];
+        scenario.fixedUpdateMsP99 = Percentile(fixedMs, 0.99f);
+    }
+
+    private static List<GameObject> CollectEnemyPrefabs(WaveGenerator waveGenerator)
+    {
+        var prefabs = new List<GameObject>();
+        if (waveGenerator == null || waveGenerator.Waves == null) return prefabs;
+
+        // Every enemy type the real waves use, in inspector order
+        foreach (WaveConfig wave in waveGenerator.Waves)
+        {
+            if (wave == null || wave.enemyPrefabs == null) continue;
+            foreach (GameObject prefab in wave.enemyPrefabs)
+            {
+                if (prefab != null && !prefabs.Contains(prefab)) prefabs.Add(prefab);
+            }
+        }
+        return prefabs;
+    }
+
+    private static void ClearEnemies()
+    {
+        for (int i = EnemyRegistry.Count - 1; i >= 0; i--)
+            EnemyPool.Despawn(EnemyRegistry.Get(i));
+    }
+
+    private static Vector2 EvaluateTrace(float time)
+    {
+        float loopLength = 0f;
+        foreach (float duration in TraceDurations) loopLength += duration;
+
+        float t = Mathf.Repeat(time, loopLength);
+        for (int i = 0; i < TraceDurations.Length; i++)
+        {
+            if (t < TraceDurations[i]) return TraceDirections[i];
+            t -= TraceDurations[i];
+        }
+        return Vector2.zero;
+    }
+
+    private static float Mean(float[] values)
+    {
+        double sum = 0.0;
+        foreach (float value in values) sum += value;
+        return values.Length > 0 ? (float)(sum / values.Length) : 0f;
+    }
+
+    private static float Percentile(float[] sorted, float p)
+    {
+        if (sorted.Length == 0) return 0f;
+        int index = Mathf.Clamp(Mathf.CeilToInt(p * sorted.Length) - 1, 0, sorted.Length - 1);
+        return sorted[index];
+    }
+
+    private void WriteReport(List<Scenario> scenarios)
+    {
+        Report report = new Report
+        {
+            scene = sceneName,
+            seed = seed,
+            unityVersion = Application.unityVersion,
+            platform = Application.platform.ToString(),
+            device = $"{SystemInfo.processorType} / {SystemInfo.graphicsDeviceName}",
+            timestamp = DateTime.UtcNow.ToString("o"),
+            simulatedFrameRate = SimulatedFrameRate,
+            scenarios = scenarios.ToArray(),
+        };
+
+        try
+        {
+            string directory = Path.GetDirectoryName(Path.GetFullPath(outputPath));
+            if (!string.IsNullOrEmpty(directory)) Directory.CreateDirectory(directory);
+            File.WriteAllText(outputPath, JsonUtility.ToJson(report, true));
+            Debug.Log($"[WaveBenchmark] Report written to {outputPath}");
+        }
+        catch (Exception e)
+        {
+            Debug.LogError($"[WaveBenchmark] Failed to write report to {outputPath}: {e.Message}");
+        }
+    }
+
+    private static void Quit(int exitCode)
+    {
+#if UNITY_EDITOR
+        if (Application.isBatchMode)
+            UnityEditor.EditorApplication.Exit(exitCode);
+        else
+            UnityEditor.EditorApplication.isPlaying = false;
+#else
+        Application.Quit(exitCode);
+#endif
+    }
+}
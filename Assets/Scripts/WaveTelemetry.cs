@@ -0,0 +1,427 @@
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Globalization;
+using System.IO;
+using System.Text;
+using Unity.Profiling;
+using UnityEngine;
+using UnityEngine.Networking;
+using Debug = UnityEngine.Debug;
+
+/// <summary>
+/// Opt-in per-wave instrumentation for real play sessions (WaveBenchmark covers synthetic waves).
+/// While a wave runs it records peak live enemies, XP orbs, projectiles and audio voices, the
+/// frame-time distribution, FixedUpdate cost, GC allocations and the QualityGovernor level. Each
+/// finished wave is appended to a JSON report and a CSV file under persistentDataPath/telemetry
+/// and, when an endpoint is configured, POSTed as JSON - the only way to get data out of WebGL.
+/// The editor's Wave Cost Model window (Tools/BROcoli) fits a cost model over these reports.
+///
+/// Off unless requested:
+/// - command line: -waveTelemetry [-telemetryOut folder] [-telemetryUrl https://...]
+/// - WebGL page URL: ?waveTelemetry or ?waveTelemetry=https://... (posts to that endpoint)
+/// - editor: Tools/BROcoli/Record Wave Telemetry
+/// Frames with the game paused (level-up, pause menu) are not sampled.
+/// </summary>
+public class WaveTelemetry : MonoBehaviour
+{
+    public const string EditorEnabledKey = "BROcoli.WaveTelemetry";
+    public const string FolderName = "telemetry";
+
+    private const string RunArg = "-waveTelemetry";
+    private const string UrlParameter = "waveTelemetry";
+    private const int InitialFrameCapacity = 4096;
+    private const int PostTimeoutSeconds = 10;
+
+    [Serializable]
+    public class Report
+    {
+        public string session;
+        public string platform;
+        public string device;
+        public string unityVersion;
+        public int targetFrameRate;
+        public string timestamp;
+        public List<Wave> waves = new List<Wave>();
+    }
+
+    [Serializable]
+    public class Wave
+    {
+        public int wave;
+        public string config;
+        public int enemyCount;
+        public float spawnInterval;
+        public string enemyPrefabs;     // Prefab names separated by ';'
+        public bool completed;          // False when the run ended mid-wave
+        public float durationSeconds;
+        public int frames;
+        public int peakEnemies;
+        public int peakOrbs;
+        public int peakProjectiles;
+        public int peakVoices;
+        public float frameMsMean;
+        public float frameMsP50;
+        public float frameMsP90;
+        public float frameMsP99;
+        public float frameMsMax;
+        public float fixedUpdateMsMean;
+        public long gcAllocatedBytes;
+        public float gcAllocatedBytesPerFrame;
+        public int gcCollections;
+        public int peakQualityLevel;
+    }
+
+    private static WaveTelemetry instance;
+
+    private string outputFolder;
+    private string postUrl;
+    private string jsonPath;
+    private string csvPath;
+    private Report report;
+
+    // Current wave
+    private Wave current;
+    private float waveStartTime;
+    private readonly List<float> frameMs = new List<float>(InitialFrameCapacity);
+    private double fixedMsTotal;
+    private long allocated;
+    private long lastManaged;
+    private int collectionsStart;
+    private readonly Stopwatch frameClock = new Stopwatch();
+    private long lastTicks;
+
+    private ProfilerRecorder gcAllocRecorder;
+
+    /// <summary>
+    /// True while telemetry is recording this session
+    /// </summary>
+    public static bool Enabled => instance != null;
+
+    [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.BeforeSceneLoad)]
+    private static void Bootstrap()
+    {
+        if (!IsRequested(out string url, out string folder)) return;
+
+        GameObject obj = new GameObject("WaveTelemetry");
+        DontDestroyOnLoad(obj);
+        instance = obj.AddComponent<WaveTelemetry>();
+        instance.Configure(url, folder);
+    }
+
+    private static bool IsRequested(out string url, out string folder)
+    {
+        url = null;
+        folder = null;
+        bool requested = false;
+
+#if UNITY_EDITOR
+        requested = UnityEditor.EditorPrefs.GetBool(EditorEnabledKey, false);
+#endif
+
+        string[] args = Environment.GetCommandLineArgs();
+        for (int i = 0; i < args.Length; i++)
+        {
+            string value = i + 1 < args.Length ? args[i + 1] : null;
+            switch (args[i])
+            {
+                case RunArg:
+                    requested = true;
+                    break;
+                case "-telemetryUrl":
+                    url = value;
+                    break;
+                case "-telemetryOut":
+                    folder = value;
+                    break;
+            }
+        }
+
+        if (Application.platform == RuntimePlatform.WebGLPlayer && TryGetUrlParameter(UrlParameter, out string endpoint))
+        {
+            requested = true;
+            if (!string.IsNullOrEmpty(endpoint)) url = endpoint;
+        }
+
+        return requested;
+    }
+
+    /// <summary>
+    /// Value of a query parameter of the page URL (empty for a bare flag)
+    /// </summary>
+    private static bool TryGetUrlParameter(string name, out string value)
+    {
+        value = null;
+        string pageUrl = Application.absoluteURL;
+        int query = pageUrl.IndexOf('?');
+        if (query < 0) return false;
+
+        int end = pageUrl.IndexOf('#', query);
+        string[] pairs = pageUrl.Substring(query + 1, (end < 0 ? pageUrl.Length : end) - query - 1).Split('&');
+        foreach (string pair in pairs)
+        {
+            int equals = pair.IndexOf('=');
+            string key = equals < 0 ? pair : pair.Substring(0, equals);
+            if (key != name) continue;
+
+            value = equals < 0 ? string.Empty : Uri.UnescapeDataString(pair.Substring(equals + 1));
+            return true;
+        }
+        return false;
+    }
+
+    private void Configure(string url, string folder)
+    {
+        postUrl = url;
+        outputFolder = string.IsNullOrEmpty(folder) ? Path.Combine(Application.persistentDataPath, FolderName) : folder;
+
+        DateTime now = DateTime.UtcNow;
+        report = new Report
+        {
+            session = now.ToString("yyyyMMdd-HHmmss", CultureInfo.InvariantCulture),
+            platform = Application.platform.ToString(),
+            device = DeviceName(),
+            unityVersion = Application.unityVersion,
+            timestamp = now.ToString("o"),
+        };
+        jsonPath = Path.Combine(outputFolder, $"waves-{report.session}.json");
+        csvPath = Path.Combine(outputFolder, $"waves-{report.session}.csv");
+
+        gcAllocRecorder = ProfilerRecorder.StartNew(ProfilerCategory.Memory, "GC Allocated In Frame");
+        GameLog.Info(LogCategory.Performance, $"[WaveTelemetry] Recording waves to {outputFolder}" + (string.IsNullOrEmpty(postUrl) ? "" : $", posting to {postUrl}"));
+    }
+
+    /// <summary>
+    /// Device label the cost model groups by
+    /// </summary>
+    public static string DeviceName()
+    {
+        string device = $"{SystemInfo.deviceModel} / {SystemInfo.graphicsDeviceName}";
+        return Application.platform == RuntimePlatform.WebGLPlayer ? $"WebGL {device}" : device;
+    }
+
+    void OnDestroy()
+    {
+        if (instance != this) return;
+
+        EndWave(false);
+        gcAllocRecorder.Dispose();
+        instance = null;
+    }
+
+    // ==================== Wave boundaries ====================
+
+    /// <summary>
+    /// Start recording a wave (WaveGenerator, when the wave's spawns begin)
+    /// </summary>
+    public static void BeginWave(int waveNumber, WaveConfig config)
+    {
+        if (instance == null || config == null) return;
+
+        instance.EndWave(false);
+        instance.StartRecording(waveNumber, config);
+    }
+
+    /// <summary>
+    /// Finish and export the wave being recorded. completed is false when the run ended mid-wave.
+    /// </summary>
+    public static void EndWave(bool completed)
+    {
+        if (instance != null) instance.Finish(completed);
+    }
+
+    private void StartRecording(int waveNumber, WaveConfig config)
+    {
+        var prefabNames = new StringBuilder();
+        if (config.enemyPrefabs != null)
+        {
+            foreach (GameObject prefab in config.enemyPrefabs)
+            {
+                if (prefab == null) continue;
+                if (prefabNames.Length > 0) prefabNames.Append(';');
+                prefabNames.Append(prefab.name);
+            }
+        }
+
+        current = new Wave
+        {
+            wave = waveNumber,
+            config = config.name,
+            enemyCount = config.enemyCount,
+            spawnInterval = config.spawnInterval,
+            enemyPrefabs = prefabNames.ToString(),
+        };
+
+        report.targetFrameRate = Application.targetFrameRate;   // Set by FrameRateOptimizer after startup
+        waveStartTime = Time.time;
+        frameMs.Clear();
+        fixedMsTotal = 0.0;
+        allocated = 0;
+        lastManaged = GC.GetTotalMemory(false);
+        collectionsStart = GC.CollectionCount(0);
+        frameClock.Restart();
+        lastTicks = 0;
+    }
+
+    private void Finish(bool completed)
+    {
+        if (current == null) return;
+
+        Wave wave = current;
+        current = null;
+
+        int frames = frameMs.Count;
+        wave.completed = completed;
+        wave.durationSeconds = Time.time - waveStartTime;
+        wave.frames = frames;
+        wave.fixedUpdateMsMean = frames > 0 ? (float)(fixedMsTotal / frames) : 0f;
+        wave.gcAllocatedBytes = allocated;
+        wave.gcAllocatedBytesPerFrame = frames > 0 ? (float)allocated / frames : 0f;
+        wave.gcCollections = GC.CollectionCount(0) - collectionsStart;
+
+        if (frames > 0)
+        {
+            double sum = 0.0;
+            foreach (float ms in frameMs) sum += ms;
+            wave.frameMsMean = (float)(sum / frames);
+
+            frameMs.Sort();
+            wave.frameMsP50 = Percentile(0.5f);
+            wave.frameMsP90 = Percentile(0.9f);
+            wave.frameMsP99 = Percentile(0.99f);
+            wave.frameMsMax = frameMs[frames - 1];
+        }
+
+        report.waves.Add(wave);
+        Export(wave);
+
+        GameLog.Info(LogCategory.Performance, $"[WaveTelemetry] Wave {wave.wave} ({wave.config}): p90 {wave.frameMsP90:F2}ms, " +
+                                              $"peak {wave.peakEnemies} enemies / {wave.peakOrbs} orbs / {wave.peakProjectiles} projectiles, " +
+                                              $"GC {wave.gcAllocatedBytesPerFrame:F0} B/frame");
+    }
+
+    private float Percentile(float p)
+    {
+        int index = Mathf.Clamp(Mathf.CeilToInt(p * frameMs.Count) - 1, 0, frameMs.Count - 1);
+        return frameMs[index];
+    }
+
+    // ==================== Sampling ====================
+
+    void LateUpdate()
+    {
+        if (current == null) return;
+
+        long ticks = frameClock.ElapsedTicks;
+        float elapsedMs = (float)((ticks - lastTicks) * 1000.0 / Stopwatch.Frequency);
+        lastTicks = ticks;
+
+        // Profiler counter where available, managed heap growth otherwise (release players)
+        long managed = GC.GetTotalMemory(false);
+        long frameAllocated = gcAllocRecorder.Valid ? gcAllocRecorder.LastValue : Math.Max(0L, managed - lastManaged);
+        lastManaged = managed;
+
+        if (Time.timeScale <= 0f) return;
+
+        frameMs.Add(elapsedMs);
+        fixedMsTotal += FrameRateOptimizer.FixedUpdateMs;
+        allocated += frameAllocated;
+
+        Wave wave = current;
+        wave.peakEnemies = Mathf.Max(wave.peakEnemies, EnemyRegistry.Count);
+        wave.peakOrbs = Mathf.Max(wave.peakOrbs, ExpGainManager.ActiveCount);
+        wave.peakProjectiles = Mathf.Max(wave.peakProjectiles, ProjectileManager.ActiveCount);
+        wave.peakVoices = Mathf.Max(wave.peakVoices, AudioVoiceManager.ActiveVoiceCount);
+        wave.peakQualityLevel = Mathf.Max(wave.peakQualityLevel, QualityGovernor.Level);
+    }
+
+    // ==================== Export ====================
+
+    private void Export(Wave wave)
+    {
+        string json = JsonUtility.ToJson(report, true);
+
+        if (Application.platform == RuntimePlatform.WebGLPlayer)
+        {
+            // persistentDataPath is IndexedDB there; the console line is the fallback without an endpoint
+            if (string.IsNullOrEmpty(postUrl))
+                Debug.Log($"[WaveTelemetry] {CsvHeader}\n{CsvRow(report, wave)}");
+        }
+        else
+        {
+            WriteFiles(json, wave);
+        }
+
+        // Not while being destroyed (application quit): coroutines can't start any more
+        if (!string.IsNullOrEmpty(postUrl) && isActiveAndEnabled)
+        {
+            // One wave per request, with the session fields, so the endpoint can append rows
+            var single = new Report
+            {
+                session = report.session,
+                platform = report.platform,
+                device = report.device,
+                unityVersion = report.unityVersion,
+                targetFrameRate = report.targetFrameRate,
+                timestamp = report.timestamp,
+            };
+            single.waves.Add(wave);
+            StartCoroutine(Post(JsonUtility.ToJson(single, false)));
+        }
+    }
+
+    private void WriteFiles(string json, Wave wave)
+    {
+        try
+        {
+            Directory.CreateDirectory(outputFolder);
+            File.WriteAllText(jsonPath, json);
+
+            if (!File.Exists(csvPath))
+                File.WriteAllText(csvPath, CsvHeader + "\n");
+            File.AppendAllText(csvPath, CsvRow(report, wave) + "\n");
+        }
+        catch (Exception e)
+        {
+            GameLog.Warning(LogCategory.Performance, $"[WaveTelemetry] Failed to write {jsonPath}: {e.Message}");
+        }
+    }
+
+    private IEnumerator Post(string json)
+    {
+        using (UnityWebRequest request = UnityWebRequest.Post(postUrl, json, "application/json"))
+        {
+            request.timeout = PostTimeoutSeconds;
+            yield return request.SendWebRequest();
+
+            if (request.result != UnityWebRequest.Result.Success)
+                GameLog.Warning(LogCategory.Performance, $"[WaveTelemetry] Failed to post to {postUrl}: {request.error}");
+        }
+    }
+
+    private const string CsvHeader =
+        "session,platform,device,wave,config,enemyCount,spawnInterval,enemyPrefabs,completed,durationSeconds,frames," +
+        "peakEnemies,peakOrbs,peakProjectiles,peakVoices,frameMsMean,frameMsP50,frameMsP90,frameMsP99,frameMsMax," +
+        "fixedUpdateMsMean,gcAllocatedBytes,gcAllocatedBytesPerFrame,gcCollections,peakQualityLevel";
+
+    private static string CsvRow(Report session, Wave w)
+    {
+        CultureInfo inv = CultureInfo.InvariantCulture;
+        return string.Join(",",
+            Csv(session.session), Csv(session.platform), Csv(session.device),
+            w.wave.ToString(inv), Csv(w.config), w.enemyCount.ToString(inv), w.spawnInterval.ToString("F3", inv),
+            Csv(w.enemyPrefabs), w.completed ? "1" : "0", w.durationSeconds.ToString("F2", inv), w.frames.ToString(inv),
+            w.peakEnemies.ToString(inv), w.peakOrbs.ToString(inv), w.peakProjectiles.ToString(inv), w.peakVoices.ToString(inv),
+            w.frameMsMean.ToString("F3", inv), w.frameMsP50.ToString("F3", inv), w.frameMsP90.ToString("F3", inv),
+            w.frameMsP99.ToString("F3", inv), w.frameMsMax.ToString("F3", inv), w.fixedUpdateMsMean.ToString("F3", inv),
+            w.gcAllocatedBytes.ToString(inv), w.gcAllocatedBytesPerFrame.ToString("F1", inv), w.gcCollections.ToString(inv),
+            w.peakQualityLevel.ToString(inv));
+    }
+
+    private static string Csv(string value)
+    {
+        if (string.IsNullOrEmpty(value)) return "";
+        return value.IndexOfAny(new[] { ',', '"', '\n' }) < 0 ? value : "\"" + value.Replace("\"", "\"\"") + "\"";
+    }
+}
@@ -72,9 +72,9 @@ public class ClueSystem : MonoBehaviour
     
     private List<string> clueTextures = new()
     {
-        "Sprites/ggj-2023/Mock-up drop",
-        "Sprites/ggj-2023/Mock-up pests",
-        "Sprites/ggj-2023/Mock-up rock",
+        "Mock-up drop",
+        "Mock-up pests",
+        "Mock-up rock",
     };
 
     public List<ClueData> clueDatas      = new();
@@ -152,7 +152,7 @@ public class ClueSystem : MonoBehaviour
             // GameObject go = spawnPoints2.First();
             // spawnPoints2.RemoveAt(0);
             
-            SpawnClue(list[i].x, list[i].y, cd, "Sprites/ggj-2023/Mock-up drop");
+            SpawnClue(list[i].x, list[i].y, cd, "Mock-up drop");
 
             cluesPlaced.Add(cd);
         }
@@ -161,7 +161,7 @@ public class ClueSystem : MonoBehaviour
         {
             var cd = clueDatas[0];
 
-            SpawnClue(list[i + numWater].x, list[i + numWater].y, cd, "Sprites/ggj-2023/Mock-up pests");
+            SpawnClue(list[i + numWater].x, list[i + numWater].y, cd, "Mock-up pests");
 
             cluesPlaced.Add(cd);
         }
@@ -170,7 +170,7 @@ public class ClueSystem : MonoBehaviour
         {
             var cd = clueDatas[0];
             
-            SpawnClue(list[i + numWater + numPest].x, list[i + numWater + numPest].y, cd, "Sprites/ggj-2023/Mock-up rock");
+            SpawnClue(list[i + numWater + numPest].x, list[i + numWater + numPest].y, cd, "Mock-up rock");
 
             cluesPlaced.Add(cd);
         }
@@ -202,11 +202,9 @@ public class ClueSystem : MonoBehaviour
         // var itemPath = clueTextures[0];
         
         clueGo.name = $"item-{itemPath}";
-        if (itemPath.Contains("Sprites/ggj-2023/Mock-up rock")) {
+        if (itemPath.Contains("Mock-up rock")) {
             clueGo.name = $"{itemPath}";
         }
-        spriteRenderer.sprite = Resources.Load<Sprite>(itemPath);
-
         // spriteRenderer.sprite = Resources.Load<Sprite>("Sprites/" + clueData.graphic.Item1);
         //spriteRenderer.sprite = Resources.Load<Sprite>(randomClueTexture());
         spriteRenderer.sortingOrder = 1;
@@ -214,6 +212,15 @@ public class ClueSystem : MonoBehaviour
         var boxCollider = clueGo.AddComponent<BoxCollider2D>();
         // boxCollider.size = new Vector2(4, 4);
 
+        // Streamed sprite can arrive after the collider was added - fit it once it does
+        ContentBundles.Load<Sprite>(ContentBundles.ClueSprites, itemPath, sprite =>
+        {
+            if (spriteRenderer == null || sprite == null) return;
+            spriteRenderer.sprite = sprite;
+            boxCollider.size = sprite.bounds.size;
+            boxCollider.offset = sprite.bounds.center;
+        });
+
         // var rigidBody = clueGo.AddComponent<Rigidbody2D>();
         // rigidBody.isKinematic = true;
 
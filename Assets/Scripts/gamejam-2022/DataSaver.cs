@@ -1,113 +1,29 @@
 ﻿using System;
-using System.IO;
-using System.Text;
 using UnityEngine;
 
 // From here:
 // https://stackoverflow.com/questions/40965645/what-is-the-best-way-to-save-game-state/40966346#40966346
+// Now forwards to SaveService, which batches writes off the main thread instead of writing a
+// pretty-printed JSON file on every call.
+[Obsolete("Use SaveService")]
 public class DataSaver
 {
+    private const string KeyPrefix = "data/";
+
     //Save Data
     public static void saveData<T>(T dataToSave, string dataFileName)
     {
-        string tempPath = Path.Combine(Application.persistentDataPath, "data");
-        tempPath = Path.Combine(tempPath, dataFileName + ".txt");
-
-        //Convert To Json then to bytes
-        string jsonData = JsonUtility.ToJson(dataToSave, true);
-        byte[] jsonByte = Encoding.ASCII.GetBytes(jsonData);
-
-        //Create Directory if it does not exist
-        if (!Directory.Exists(Path.GetDirectoryName(tempPath)))
-        {
-            Directory.CreateDirectory(Path.GetDirectoryName(tempPath));
-        }
-        //Debug.Log(path);
-
-        try
-        {
-            File.WriteAllBytes(tempPath, jsonByte);
-            Debug.Log("Saved Data to: " + tempPath.Replace("/", "\\"));
-        }
-        catch (Exception e)
-        {
-            Debug.LogWarning("Failed To PlayerInfo Data to: " + tempPath.Replace("/", "\\"));
-            Debug.LogWarning("Error: " + e.Message);
-        }
+        SaveService.SetObject(KeyPrefix + dataFileName, dataToSave);
     }
 
     //Load Data
     public static T loadData<T>(string dataFileName)
     {
-        string tempPath = Path.Combine(Application.persistentDataPath, "data");
-        tempPath = Path.Combine(tempPath, dataFileName + ".txt");
-
-        //Exit if Directory or File does not exist
-        if (!Directory.Exists(Path.GetDirectoryName(tempPath)))
-        {
-            Debug.LogWarning("Directory does not exist");
-            return default(T);
-        }
-
-        if (!File.Exists(tempPath))
-        {
-            Debug.Log("File does not exist");
-            return default(T);
-        }
-
-        //Load saved Json
-        byte[] jsonByte = null;
-        try
-        {
-            jsonByte = File.ReadAllBytes(tempPath);
-            Debug.Log("Loaded Data from: " + tempPath.Replace("/", "\\"));
-        }
-        catch (Exception e)
-        {
-            Debug.LogWarning("Failed To Load Data from: " + tempPath.Replace("/", "\\"));
-            Debug.LogWarning("Error: " + e.Message);
-        }
-
-        //Convert to json string
-        string jsonData = Encoding.ASCII.GetString(jsonByte);
-
-        //Convert to Object
-        object resultValue = JsonUtility.FromJson<T>(jsonData);
-        return (T)Convert.ChangeType(resultValue, typeof(T));
+        return SaveService.GetObject<T>(KeyPrefix + dataFileName);
     }
 
     public static bool deleteData(string dataFileName)
     {
-        bool success = false;
-
-        //Load Data
-        string tempPath = Path.Combine(Application.persistentDataPath, "data");
-        tempPath = Path.Combine(tempPath, dataFileName + ".txt");
-
-        //Exit if Directory or File does not exist
-        if (!Directory.Exists(Path.GetDirectoryName(tempPath)))
-        {
-            Debug.LogWarning("Directory does not exist");
-            return false;
-        }
-
-        if (!File.Exists(tempPath))
-        {
-            Debug.Log("File does not exist");
-            return false;
-        }
-
-        try
-        {
-            File.Delete(tempPath);
-            Debug.Log("Data deleted from: " + tempPath.Replace("/", "\\"));
-            success = true;
-        }
-        catch (Exception e)
-        {
-            Debug.LogWarning("Failed To Delete Data: " + e.Message);
-        }
-
-        return success;
+        return SaveService.DeleteKey(KeyPrefix + dataFileName);
     }
 }
\ No newline at end of file
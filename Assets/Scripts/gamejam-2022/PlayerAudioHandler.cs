@@ -11,7 +11,7 @@ public class PlayerAudioHandler : MonoBehaviour
     private const string DamageSoundPath = "Sprites/ggj-2023/sfx/damage";
     private const string CollisionSoundPath = "Sprites/ggj-2023/sfx/damage";
     private const string PickupSoundPath = "Sprites/ggj-2023/sfx/pickup sound";
-    private const string GameOverSoundPath = "Sprites/ggj-2023/sfx/game over2";
+    private const string GameOverSoundPath = "Audio/game over2";
     private const string GrowSoundPath = "Sprites/ggj-2023/sfx/pickup sound";
     private const string ShrinkSoundPath = "Sprites/ggj-2023/sfx/damage";
     private const string Ambient1Path = "Sprites/ggj-2023/sfx/ambient/ambient-náttúra";
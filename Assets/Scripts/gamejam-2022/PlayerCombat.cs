@@ -22,17 +22,35 @@ public class PlayerCombat : MonoBehaviour
     private const float ProjectileSpawnSideOffset = 0.25f;
     private const float ProjectileVisualHeight = -0.5f;
     private const string ProjectilePrefabPath = "CursedDevolpmentStudioAss Assets/Projectile";
+    private const int EnemyBufferSize = 256;
+    private const float TargetQueryMargin = 0.5f;  // Registry tests centers; pad to roughly match collider overlap
+    private const int SprayCandidateCount = 3;     // Best sweep windows that get an exact damage evaluation
+    private const float SprayWarmStartBias = 0.95f; // Keep last frame's aim unless a new one is clearly better
 
     private PlayerStats _playerStats;
     private PlayerMovement _playerMovement;
     private SanitizerSpray _sanitizerSpray;
     private ProceduralGunAudio _gunAudio;
     private GameObject _projectilePrefab;
-    private LayerMask _enemyLayer;
 
     private float _nextAllowedAttack;
     private WeaponType _currentWeapon = WeaponType.SanitizerSpray;
 
+    // Reused query buffers - targeting runs every physics step while the weapon is ready
+    private readonly EnemyBase[] _enemyBuffer = new EnemyBase[EnemyBufferSize];
+    private readonly List<(Transform t, EnemyBase e, Vector2 predicted, float dist)> _sprayCandidates =
+        new List<(Transform t, EnemyBase e, Vector2 predicted, float dist)>(EnemyBufferSize);
+
+    // Angular sweep scratch for FindBestSprayTarget (sorted angles, doubled for wrap-around)
+    private readonly float[] _sweepAngles = new float[EnemyBufferSize];
+    private readonly int[] _sweepOrder = new int[EnemyBufferSize];
+    private readonly float[] _sweepWeights = new float[EnemyBufferSize];
+    private readonly float[] _sweepPrefix = new float[EnemyBufferSize * 2 + 1];
+    private readonly float[] _candidateAngles = new float[SprayCandidateCount];
+    private readonly float[] _candidateScores = new float[SprayCandidateCount];
+    private float _lastSprayAngle;
+    private bool _hasLastSprayAngle;
+
     /// <summary>
     /// The currently equipped weapon type.
     /// </summary>
@@ -60,13 +78,6 @@ public class PlayerCombat : MonoBehaviour
         {
             Debug.LogWarning($"PlayerCombat: Could not load projectile prefab from '{ProjectilePrefabPath}'");
         }
-
-        // Get enemy layer mask programmatically
-        _enemyLayer = LayerMask.GetMask("Enemy");
-        if (_enemyLayer == 0)
-        {
-            Debug.LogWarning("PlayerCombat: 'Enemy' layer not found! Combat detection will not work.");
-        }
     }
 
     private void Start()
@@ -93,10 +104,12 @@ public class PlayerCombat : MonoBehaviour
             detectionRange = _sanitizerSpray.SprayRange;
         }
 
-        Collider2D[] hits = Physics2D.OverlapCircleAll(playerPos, detectionRange, _enemyLayer);
-        if (hits.Length == 0) return;
+        int enemyCount = EnemyRegistry.Query(playerPos, detectionRange + TargetQueryMargin, _enemyBuffer);
 
-        Transform target = FindTarget(hits, playerPos, detectionRange);
+        // No enemies nearby: fall back to incoming enemy projectiles
+        Transform target = enemyCount > 0
+            ? FindTarget(enemyCount, playerPos, detectionRange)
+            : ProjectileManager.FindClosestHostile(playerPos, detectionRange);
         if (target == null) return;
 
         if (_playerStats == null)
@@ -109,57 +122,41 @@ public class PlayerCombat : MonoBehaviour
         AttackTarget(target);
     }
 
-    private Transform FindTarget(Collider2D[] hits, Vector2 playerPos, float range)
+    private Transform FindTarget(int enemyCount, Vector2 playerPos, float range)
     {
         // Use smart targeting for spray weapon
         if (_currentWeapon == WeaponType.SanitizerSpray && _sanitizerSpray != null)
         {
-            Transform sprayTarget = FindBestSprayTarget(hits, playerPos, range);
+            Transform sprayTarget = FindBestSprayTarget(enemyCount, playerPos, range);
             if (sprayTarget != null) return sprayTarget;
         }
 
-        // Fallback: find closest enemy (prefer real enemies over projectiles)
-        return FindClosestEnemy(hits, playerPos);
+        // Fallback: find closest enemy
+        return FindClosestEnemy(enemyCount, playerPos);
     }
 
-    private Transform FindClosestEnemy(Collider2D[] hits, Vector2 playerPos)
+    private Transform FindClosestEnemy(int enemyCount, Vector2 playerPos)
     {
         Transform closestEnemy = null;
-        Transform closestProjectile = null;
         float closestEnemySqrDist = float.MaxValue;
-        float closestProjectileSqrDist = float.MaxValue;
 
-        foreach (Collider2D hit in hits)
+        for (int i = 0; i < enemyCount; i++)
         {
-            if (hit == null) continue;
-
-            float sqrDist = ((Vector2)hit.transform.position - playerPos).sqrMagnitude;
-            EnemyBase enemyComponent = hit.GetComponent<EnemyBase>();
-
-            if (enemyComponent != null)
-            {
-                if (sqrDist < closestEnemySqrDist)
-                {
-                    closestEnemySqrDist = sqrDist;
-                    closestEnemy = hit.transform;
-                }
-            }
-            else
+            Transform t = _enemyBuffer[i].transform;
+            float sqrDist = ((Vector2)t.position - playerPos).sqrMagnitude;
+            if (sqrDist < closestEnemySqrDist)
             {
-                if (sqrDist < closestProjectileSqrDist)
-                {
-                    closestProjectileSqrDist = sqrDist;
-                    closestProjectile = hit.transform;
-                }
+                closestEnemySqrDist = sqrDist;
+                closestEnemy = t;
             }
         }
 
-        return closestEnemy ?? closestProjectile;
+        return closestEnemy;
     }
 
-    private Transform FindBestSprayTarget(Collider2D[] hits, Vector2 playerPos, float sprayRange)
+    private Transform FindBestSprayTarget(int enemyCount, Vector2 playerPos, float sprayRange)
     {
-        if (hits == null || hits.Length == 0) return null;
+        if (enemyCount == 0) return null;
 
         float sprayAngle = _sanitizerSpray?.SprayWidth ?? 60f;
         float halfAngle = sprayAngle * 0.5f;
@@ -167,69 +164,181 @@ public class PlayerCombat : MonoBehaviour
             ?? (SpraySettings.BaseSprayRange / SpraySettings.ParticleLifetimeBase);
 
         // Collect enemies with predicted positions using dynamic velocity-based prediction
-        var enemies = new List<(Transform t, EnemyBase e, Vector2 predicted, float dist)>();
+        var enemies = _sprayCandidates;
+        enemies.Clear();
 
-        foreach (Collider2D hit in hits)
+        for (int i = 0; i < enemyCount; i++)
         {
-            if (hit == null) continue;
-            EnemyBase enemy = hit.GetComponent<EnemyBase>();
-            if (enemy == null) continue;
+            EnemyBase enemy = _enemyBuffer[i];
 
-            Vector2 enemyPos = (Vector2)hit.bounds.center;
+            Vector2 enemyPos = enemy.BoundsCenter;
             float dist = Vector2.Distance(playerPos, enemyPos);
 
             if (dist <= sprayRange && dist > 0.1f)
             {
                 Vector2 predicted = GetPredictedEnemyPosition(enemy, enemyPos, dist, particleSpeed);
-                enemies.Add((hit.transform, enemy, predicted, dist));
+                enemies.Add((enemy.transform, enemy, predicted, dist));
             }
         }
 
-        if (enemies.Count == 0) return null;
+        if (enemies.Count == 0)
+        {
+            _hasLastSprayAngle = false;
+            return null;
+        }
         if (enemies.Count == 1) return enemies[0].t;
 
         // Nozzle offset for accurate damage calculations
         float nozzleOffset = SpraySettings.HandOffset + SpraySettings.NozzleLocalPos.x;
 
-        // Find optimal aim direction for maximum total damage
-        Transform bestTarget = null;
-        float bestTotalDamage = float.MinValue;
+        // Angular sweep: rank aim directions by the distance-weighted enemies they cover, then
+        // score only the best few (plus last frame's aim) with the full damage model
+        int candidateCount = FindSprayWindows(enemies, playerPos, halfAngle * Mathf.Deg2Rad, sprayRange);
 
-        // Sample directions: toward each enemy
-        foreach (var primary in enemies)
+        float bestAngle = _candidateAngles[0];
+        float bestTotalDamage = float.MinValue;
+        for (int c = 0; c < candidateCount; c++)
         {
-            // Calculate aim direction from PLAYER to predicted target (consistent with SprayHandVisuals)
-            Vector2 aimDir = (primary.predicted - playerPos).normalized;
-            // Nozzle position is along the aim ray from player
-            Vector2 nozzlePos = playerPos + aimDir * nozzleOffset;
-            float totalDamage = CalculateSprayDamage(enemies, nozzlePos, aimDir, halfAngle, sprayRange);
-
+            float totalDamage = EvaluateSprayAngle(enemies, playerPos, _candidateAngles[c], nozzleOffset, halfAngle, sprayRange);
             if (totalDamage > bestTotalDamage)
             {
                 bestTotalDamage = totalDamage;
-                bestTarget = primary.t;
+                bestAngle = _candidateAngles[c];
             }
         }
 
-        // Also sample directions BETWEEN enemy pairs (cluster centers)
-        for (int i = 0; i < enemies.Count && i < 5; i++)
+        // Warm start: stay on last frame's aim while it is nearly as good, so the spray doesn't jitter
+        if (_hasLastSprayAngle)
+        {
+            float lastDamage = EvaluateSprayAngle(enemies, playerPos, _lastSprayAngle, nozzleOffset, halfAngle, sprayRange);
+            if (lastDamage > 0f && lastDamage >= bestTotalDamage * SprayWarmStartBias)
+                bestAngle = _lastSprayAngle;
+        }
+
+        _lastSprayAngle = bestAngle;
+        _hasLastSprayAngle = true;
+
+        return FindEnemyNearestAngle(enemies, playerPos, bestAngle);
+    }
+
+    /// <summary>
+    /// Sort enemies by angle around the player and slide the spray cone across them.
+    /// Fills _candidateAngles with the centers of the highest-weight windows (best first)
+    /// and returns how many were written. O(N log N) for the sort, O(N) for the sweep.
+    /// </summary>
+    private int FindSprayWindows(
+        List<(Transform t, EnemyBase e, Vector2 predicted, float dist)> enemies,
+        Vector2 playerPos, float halfAngleRad, float sprayRange)
+    {
+        int n = enemies.Count;
+        for (int k = 0; k < n; k++)
+        {
+            Vector2 toEnemy = enemies[k].predicted - playerPos;
+            _sweepAngles[k] = Mathf.Atan2(toEnemy.y, toEnemy.x);
+            _sweepOrder[k] = k;
+        }
+        System.Array.Sort(_sweepAngles, _sweepOrder, 0, n);
+
+        // Same distance falloff as CalculateSprayDamage, so windows are ranked by reachable damage
+        for (int k = 0; k < n; k++)
+        {
+            float dist = (enemies[_sweepOrder[k]].predicted - playerPos).magnitude;
+            _sweepWeights[k] = Mathf.Max(0f, 1f - Mathf.Pow(Mathf.Min(dist / sprayRange, 1f), 0.7f));
+        }
+
+        _sweepPrefix[0] = 0f;
+        for (int m = 0; m < 2 * n; m++)
+            _sweepPrefix[m + 1] = _sweepPrefix[m] + _sweepWeights[m % n];
+
+        for (int c = 0; c < SprayCandidateCount; c++)
+            _candidateScores[c] = float.MinValue;
+
+        // Window starts at enemy i and extends over every enemy within one cone width after it
+        float coneWidth = halfAngleRad * 2f;
+        int j = 0;
+        for (int i = 0; i < n; i++)
         {
-            for (int j = i + 1; j < enemies.Count && j < 5; j++)
+            if (j < i) j = i;
+            while (j + 1 < i + n && SweepAngle(j + 1, n) - _sweepAngles[i] <= coneWidth)
+                j++;
+
+            float weight = _sweepPrefix[j + 1] - _sweepPrefix[i];
+            float center = (_sweepAngles[i] + SweepAngle(j, n)) * 0.5f;
+            InsertCandidate(center, weight);
+        }
+
+        int count = 0;
+        while (count < SprayCandidateCount && _candidateScores[count] > float.MinValue)
+            count++;
+        return count;
+    }
+
+    /// <summary>
+    /// Sorted angle at position m of the doubled (wrapped) sequence
+    /// </summary>
+    private float SweepAngle(int m, int n)
+    {
+        return m < n ? _sweepAngles[m] : _sweepAngles[m - n] + 2f * Mathf.PI;
+    }
+
+    private void InsertCandidate(float angle, float score)
+    {
+        if (score <= _candidateScores[SprayCandidateCount - 1]) return;
+
+        int slot = SprayCandidateCount - 1;
+        while (slot > 0 && _candidateScores[slot - 1] < score)
+        {
+            _candidateScores[slot] = _candidateScores[slot - 1];
+            _candidateAngles[slot] = _candidateAngles[slot - 1];
+            slot--;
+        }
+        _candidateScores[slot] = score;
+        _candidateAngles[slot] = angle;
+    }
+
+    private float EvaluateSprayAngle(
+        List<(Transform t, EnemyBase e, Vector2 predicted, float dist)> enemies,
+        Vector2 playerPos, float angle, float nozzleOffset, float halfAngle, float sprayRange)
+    {
+        Vector2 aimDir = new Vector2(Mathf.Cos(angle), Mathf.Sin(angle));
+        // Nozzle position is along the aim ray from player (consistent with SprayHandVisuals)
+        Vector2 nozzlePos = playerPos + aimDir * nozzleOffset;
+        return CalculateSprayDamage(enemies, nozzlePos, aimDir, halfAngle, sprayRange);
+    }
+
+    /// <summary>
+    /// Enemy to hand to SanitizerSpray for an aim angle: the one closest to the aim ray,
+    /// preferring the nearer enemy when two are about equally close
+    /// </summary>
+    private Transform FindEnemyNearestAngle(
+        List<(Transform t, EnemyBase e, Vector2 predicted, float dist)> enemies,
+        Vector2 playerPos, float angle)
+    {
+        const float TieToleranceDeg = 1f;
+
+        float aimDeg = angle * Mathf.Rad2Deg;
+        float minDelta = float.MaxValue;
+        foreach (var enemy in enemies)
+            minDelta = Mathf.Min(minDelta, AngleTo(enemy.predicted - playerPos, aimDeg));
+
+        Transform best = null;
+        float bestDist = float.MaxValue;
+        foreach (var enemy in enemies)
+        {
+            if (AngleTo(enemy.predicted - playerPos, aimDeg) > minDelta + TieToleranceDeg) continue;
+            if (enemy.dist < bestDist)
             {
-                Vector2 midpoint = (enemies[i].predicted + enemies[j].predicted) * 0.5f;
-                Vector2 aimDir = (midpoint - playerPos).normalized;
-                Vector2 nozzlePos = playerPos + aimDir * nozzleOffset;
-                float totalDamage = CalculateSprayDamage(enemies, nozzlePos, aimDir, halfAngle, sprayRange);
-
-                if (totalDamage > bestTotalDamage)
-                {
-                    bestTotalDamage = totalDamage;
-                    bestTarget = enemies[i].dist < enemies[j].dist ? enemies[i].t : enemies[j].t;
-                }
+                bestDist = enemy.dist;
+                best = enemy.t;
             }
         }
 
-        return bestTarget;
+        return best;
+    }
+
+    private static float AngleTo(Vector2 direction, float aimDeg)
+    {
+        return Mathf.Abs(Mathf.DeltaAngle(aimDeg, Mathf.Atan2(direction.y, direction.x) * Mathf.Rad2Deg));
     }
 
     /// <summary>
@@ -342,8 +451,7 @@ public class PlayerCombat : MonoBehaviour
 
         Vector3 spawnPos = new Vector3(spawnPos2D.x, spawnPos2D.y, ProjectileVisualHeight);
 
-        GameObject proj = Object.Instantiate(_projectilePrefab, spawnPos, Quaternion.identity);
-        Projectile projectile = proj?.GetComponent<Projectile>();
+        Projectile projectile = ProjectileManager.Spawn(_projectilePrefab, spawnPos) as Projectile;
         if (projectile != null && _playerStats != null)
         {
             projectile.Init(direction, _playerStats.CurrentDamage);
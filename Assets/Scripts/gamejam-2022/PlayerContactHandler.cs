@@ -0,0 +1,87 @@
+using UnityEngine;
+
+/// <summary>
+/// Resolves everything touching the player in one pass per physics step, in place of per-object
+/// OnTriggerEnter2D callbacks on enemies, XP orbs and the player.
+/// The player collider's contact array (filled by the last simulation step) is read once; enemies
+/// and orbs are looked up through EnemyRegistry and ExpGainManager instead of CompareTag and
+/// GetComponent. Enemies get OnPlayerContact once when they start touching (like a trigger enter);
+/// all orbs collected in the step are summed into a single experience grant.
+/// Enemy projectiles are hit-tested by ProjectileManager and never reach this.
+/// </summary>
+public class PlayerContactHandler : MonoBehaviour
+{
+    private const int ContactBufferSize = 128;
+
+    private Collider2D _collider;
+    private Rigidbody2D _body;
+    private PlayerDamageHandler _damageHandler;
+    private ContactFilter2D _filter;
+
+    private readonly Collider2D[] _contacts = new Collider2D[ContactBufferSize];
+
+    // Enemies (by SpawnId) touching in this and the previous step, to detect new contacts
+    private EnemyIdMap _touching = new EnemyIdMap(64);
+    private EnemyIdMap _touchingLastStep = new EnemyIdMap(64);
+
+    private void Awake()
+    {
+        _collider = GetComponent<Collider2D>();
+        _body = GetComponent<Rigidbody2D>();
+        _damageHandler = GetComponent<PlayerDamageHandler>();
+
+        _filter = new ContactFilter2D();
+        _filter.NoFilter();
+        _filter.useTriggers = true;
+    }
+
+    /// <summary>
+    /// Resolve this step's contacts. Called by PlayerController.FixedUpdate.
+    /// </summary>
+    public void ResolveContacts()
+    {
+        if (_collider == null || !_collider.isActiveAndEnabled) return;
+
+        (_touching, _touchingLastStep) = (_touchingLastStep, _touching);
+        _touching.Clear();
+
+        int count = _collider.GetContacts(_filter, _contacts);
+        int exp = 0;
+        int orbs = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            Collider2D other = _contacts[i];
+            _contacts[i] = null;
+            if (other == null) continue;
+
+            Rigidbody2D otherBody = other.attachedRigidbody;
+            if (otherBody != null && otherBody == _body) continue;
+            GameObject obj = otherBody != null ? otherBody.gameObject : other.gameObject;
+
+            EnemyBase enemy = EnemyRegistry.FromGameObject(obj);
+            if (enemy != null)
+            {
+                // An enemy can touch with several colliders; only the first counts
+                if (enemy.IsDead) continue;
+                _touching.GetOrAdd(enemy.SpawnId, out bool added);
+                if (added && !_touchingLastStep.TryGet(enemy.SpawnId, out _))
+                    enemy.OnPlayerContact();
+                continue;
+            }
+
+            ExpGain orb = ExpGainManager.FromGameObject(obj);
+            if (orb != null && orb.Collect())
+            {
+                exp += orb.expAmountGain;
+                orbs++;
+            }
+        }
+
+        if (orbs > 0)
+        {
+            ProceduralXPPickupAudio.PlayPickup();
+            _damageHandler?.HandleExperiencePickup(exp);
+        }
+    }
+}
@@ -4,7 +4,10 @@ using UnityEngine.SceneManagement;
 /// <summary>
 /// Handles damage reception, knockback triggering, and death/game-over logic.
 /// Damage feedback (knockback, shake, vignette) scales with percentage of max health lost.
-/// Damage from enemies is dealt exclusively by attack animations for proper sync.
+/// Damage from enemies is dealt exclusively by attack animations for proper sync. Each melee hit
+/// goes through PlayerStats.ApplyDamage on its own (armor and dodge apply per hit); only the
+/// feedback is batched into LateUpdate, so a swarm striking together costs one damage sound, one
+/// feedback pulse and one death check.
 /// </summary>
 public class PlayerDamageHandler : MonoBehaviour
 {
@@ -19,6 +22,10 @@ public class PlayerDamageHandler : MonoBehaviour
 
     private bool _gameOver;
 
+    // Feedback of the melee hits taken this frame (see LateUpdate)
+    private float _pendingDamage;
+    private Vector2 _pendingKnockback;
+
     /// <summary>
     /// Whether the game is over (player died).
     /// </summary>
@@ -112,68 +119,63 @@ public class PlayerDamageHandler : MonoBehaviour
 
     /// <summary>
     /// Apply melee damage to the player with knockback.
-    /// Called by enemy attack animations when strike lands.
+    /// Called by enemy attack animations when strike lands. The damage is applied now; sound,
+    /// knockback and the death check follow in LateUpdate. Returns true when the strike reached
+    /// the player (also when it was dodged or absorbed by armor), false once the game is over.
     /// </summary>
     public bool TakeMeleeDamage(float damage, Vector2 knockbackDirection)
     {
         if (_gameOver) return false;
 
+        _playerStats?.ApplyDamage(damage);
+
+        // Knockback of simultaneous hits averages, weighted by damage
+        _pendingDamage += damage;
+        _pendingKnockback += knockbackDirection.normalized * damage;
+        return true;
+    }
+
+    private void LateUpdate()
+    {
+        if (_pendingDamage <= 0f) return;
+
+        float damage = _pendingDamage;
+        Vector2 knockbackDirection = _pendingKnockback;
+        _pendingDamage = 0f;
+        _pendingKnockback = Vector2.zero;
+        if (_gameOver) return;
+
         // Play damage sound
         _audioHandler?.PlayDamageSound();
 
-        // Apply damage to stats
-        _playerStats?.ApplyDamage(damage);
-
         // Trigger scaled feedback effects
         TriggerDamageFeedback(damage, knockbackDirection);
 
         CheckForDeath();
-        return true;
     }
 
     /// <summary>
-    /// Handle collision with enemy or projectile.
-    /// Note: Enemy collision does NOT deal damage - damage comes from enemy attack animations.
+    /// Feedback for an enemy projectile that reached the player.
+    /// Pooled projectiles are hit-tested by ProjectileManager (which applies their damage) and never
+    /// touch the player's trigger, so this stands in for the "Projectile" collision case.
     /// </summary>
-    public void HandleCollision(Collider2D other)
+    public void HandleProjectileHit()
     {
         if (_gameOver) return;
 
-        switch (other.tag)
-        {
-            case "Enemy":
-                // Enemy collision does NOT deal damage
-                // Damage is dealt by enemy attack animations (EnemyScript.PerformMeleeAttack)
-                // This ensures damage is synced with the visual strike
-                break;
-            case "Projectile":
-                HandleProjectileCollision(other);
-                break;
-            case "Experience":
-                HandleExperiencePickup(other);
-                break;
-        }
-    }
-
-    private void HandleProjectileCollision(Collider2D other)
-    {
         _audioHandler?.PlayCollisionSound();
-
-        EnemyBase enemy = other.GetComponent<EnemyBase>();
-        float damage = enemy?.Damage ?? 0f;
-        
-        // Apply damage and feedback for projectiles
-        _playerStats?.ApplyDamage(damage);
-        TriggerDamageFeedback(damage, Vector2.zero);
+        TriggerDamageFeedback(0f, Vector2.zero);
         CheckForDeath();
     }
 
-    private void HandleExperiencePickup(Collider2D other)
+    /// <summary>
+    /// Grant the experience of every orb PlayerContactHandler collected in one physics step
+    /// </summary>
+    public void HandleExperiencePickup(float exp)
     {
-        _audioHandler?.PlayPickupSound();
+        if (_gameOver) return;
 
-        ExpGain expGain = other.GetComponent<ExpGain>();
-        float exp = expGain?.expAmountGain ?? 0f;
+        _audioHandler?.PlayPickupSound();
         _playerStats?.ApplyExperience(exp);
     }
 
@@ -221,8 +223,10 @@ public class PlayerDamageHandler : MonoBehaviour
         var gameStates = FindAnyObjectByType<GameStates>();
         if (gameStates != null)
         {
-            PlayerPrefs.SetInt("LastScore", gameStates.score);
-            PlayerPrefs.Save();
+            SaveService.SetInt(SaveService.LastScoreKey, gameStates.score);
+            if (gameStates.score > SaveService.GetInt(SaveService.HighScoreKey))
+                SaveService.SetInt(SaveService.HighScoreKey, gameStates.score);
+            SaveService.Flush();
             Debug.Log($"Saved final score: {gameStates.score}");
         }
     }
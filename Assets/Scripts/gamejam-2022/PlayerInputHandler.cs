@@ -1,7 +1,7 @@
 using UnityEngine;
 
 /// <summary>
-/// Handles player input from keyboard and virtual controller.
+/// Handles player input from keyboard and virtual controller (sampled by InputSampler).
 /// Provides raw and smoothed input values for other components.
 /// </summary>
 public class PlayerInputHandler : MonoBehaviour
@@ -11,7 +11,6 @@ public class PlayerInputHandler : MonoBehaviour
     private Vector2 _rawInput;
     private Vector2 _smoothedInput;
     private Vector2 _lastNonZeroInput;
-    private VirtualController _virtualController;
 
     /// <summary>
     /// The unprocessed input direction. Magnitude is 0-1 for analog, exactly 1 for keyboard.
@@ -33,11 +32,10 @@ public class PlayerInputHandler : MonoBehaviour
     /// </summary>
     public bool HasInput => _rawInput.sqrMagnitude > 0.01f;
 
-    private void Awake()
-    {
-        // Cache virtual controller reference - may be null on desktop
-        _virtualController = FindFirstObjectByType<VirtualController>();
-    }
+    /// <summary>
+    /// When set, replaces keyboard and virtual controller input (scripted input, e.g. WaveBenchmark).
+    /// </summary>
+    public Vector2? InputOverride { get; set; }
 
     // NOTE: Input is updated explicitly by PlayerController in FixedUpdate
     // to maintain the same timing as the original code. Do NOT add Update() here.
@@ -48,46 +46,18 @@ public class PlayerInputHandler : MonoBehaviour
     /// </summary>
     public void UpdateInput()
     {
-        // Get keyboard input
-        Vector2 keyboardInput = new Vector2(
-            Input.GetAxisRaw("Horizontal"),
-            Input.GetAxisRaw("Vertical")
-        );
-        
-        // Normalize if exceeds unit circle (diagonal movement)
-        if (keyboardInput.sqrMagnitude > 1f)
-        {
-            keyboardInput = keyboardInput.normalized;
-        }
-
-        // Get virtual controller input (mobile)
-        Vector2 virtualInput = Vector2.zero;
-        if (_virtualController == null)
-        {
-            // Try to find it again in case it was instantiated later
-            _virtualController = VirtualController.Instance;
-        }
-        
-        if (_virtualController != null)
+        if (InputOverride.HasValue)
         {
-            virtualInput = _virtualController.JoystickInput;
+            ApplyInput(Vector2.ClampMagnitude(InputOverride.Value, 1f));
+            return;
         }
 
-        // Prioritize keyboard over virtual controller
-        Vector2 targetInput;
-        if (keyboardInput.sqrMagnitude > 0.01f)
-        {
-            targetInput = keyboardInput;
-        }
-        else if (virtualInput.sqrMagnitude > 0.01f)
-        {
-            targetInput = virtualInput;
-        }
-        else
-        {
-            targetInput = Vector2.zero;
-        }
+        // Keyboard has priority over the virtual controller - resolved once per frame by InputSampler
+        ApplyInput(InputSampler.Current.move);
+    }
 
+    private void ApplyInput(Vector2 targetInput)
+    {
         _rawInput = targetInput;
 
         // Update smoothed input
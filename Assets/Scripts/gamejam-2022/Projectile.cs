@@ -4,12 +4,13 @@ using System.Text;
 using UnityEngine;
 using static UnityEngine.EventSystems.EventTrigger;
 
-public class Projectile : MonoBehaviour
+/// <summary>
+/// Player shot. Flown and hit-tested against enemies by ProjectileManager.
+/// </summary>
+public class Projectile : PooledProjectile
 {
     [SerializeField] private float _speed = 8f;
     [SerializeField] private float _lifetime = 3f;
-    [SerializeField] Rigidbody2D _body;
-    [SerializeField] Collider2D _collider;
 
     private float _damage = 1;
     private Vector2 direction;
@@ -18,31 +19,16 @@ public class Projectile : MonoBehaviour
     {
         _damage = damage;
         direction = dir.normalized;
-        Destroy(gameObject, _lifetime);
+        Launch(direction * _speed, _lifetime, false);
     }
 
-    private void Update()
+    public override bool OnHitEnemy(EnemyBase enemy)
     {
-        transform.position += (Vector3)(direction * _speed * Time.deltaTime);
-    }
-
-    private void OnTriggerEnter2D(Collider2D other)
-    {
-        Debug.Log("Projectile hit: " + other.name);
-        if (other.CompareTag("Enemy") == false)
-        {
-            return;
-        }
-
-        if (other.TryGetComponent(out EnemyBase enemy))
-        {
-            // Pass knockback direction (same as projectile direction)
-            enemy.TakeDamage(_damage, direction);
-            
-            // Play hit sound
-            ProceduralProjectileHitAudio.PlayHit(transform.position, ProceduralProjectileHitAudio.HitSoundType.Energy, 0.5f);
-            
-            Destroy(gameObject);
-        }
+        // Pass knockback direction (same as projectile direction)
+        enemy.TakeDamage(_damage, direction);
+        
+        // Play hit sound
+        ProceduralProjectileHitAudio.PlayHit(transform.position, ProceduralProjectileHitAudio.HitSoundType.Energy, 0.5f);
+        return true;
     }
 }
@@ -31,6 +31,13 @@ function detectBuildPath() {
 const BUILD_INFO = detectBuildPath();
 const CACHE_NAME = `unity-game-cache-${CACHE_VERSION}-${BUILD_INFO.cachePrefix}`;
 
+// Streamed asset bundles (StreamingAssets/Bundles) live in their own cache that survives new
+// versions: their file names contain the content hash, so a bundle that didn't change keeps
+// its URL and is never downloaded again. Bundles no longer listed in bundles.json are pruned.
+const BUNDLE_CACHE_NAME = `unity-bundle-cache-${BUILD_INFO.cachePrefix}`;
+const BUNDLE_PATH = '/StreamingAssets/Bundles/';
+const BUNDLE_MANIFEST = 'bundles.json';
+
 // Remote URL to check for version updates - dynamically set based on build path
 const VERSION_CHECK_URL = BUILD_INFO.versionUrl;
 
@@ -70,6 +77,34 @@ function shouldNetworkFirst(url) {
   return NETWORK_FIRST_FILES.some(file => pathname.endsWith(file));
 }
 
+// Check if a URL is a content-hashed asset bundle
+function isBundleFile(url) {
+  return url.pathname.includes(BUNDLE_PATH) && !url.pathname.endsWith(BUNDLE_MANIFEST);
+}
+
+// Check if a URL is the bundle manifest (network-first so new hashes are picked up)
+function isBundleManifest(url) {
+  return url.pathname.includes(BUNDLE_PATH) && url.pathname.endsWith(BUNDLE_MANIFEST);
+}
+
+// Drop cached bundles that the current manifest no longer references
+async function pruneBundleCache(manifest) {
+  try {
+    const keep = new Set((manifest.bundles || []).map(entry => entry.file));
+    const cache = await caches.open(BUNDLE_CACHE_NAME);
+    const requests = await cache.keys();
+    await Promise.all(requests.map(request => {
+      const file = new URL(request.url).pathname.split('/').pop();
+      if (!keep.has(file)) {
+        console.log('[ServiceWorker] Pruning stale bundle:', file);
+        return cache.delete(request);
+      }
+    }));
+  } catch (err) {
+    console.warn('[ServiceWorker] Could not prune bundle cache:', err.message);
+  }
+}
+
 // Fetch version.json from remote server
 async function fetchRemoteVersion() {
   try {
@@ -117,11 +152,12 @@ async function storeVersion(version) {
   }
 }
 
-// Clear ALL caches
-async function clearAllCaches() {
-  console.log('[ServiceWorker] Clearing ALL caches...');
+// Clear ALL caches (keepBundles leaves content-hashed bundles alone - they can't be stale)
+async function clearAllCaches(keepBundles = false) {
+  console.log('[ServiceWorker] Clearing ALL caches...', keepBundles ? '(keeping bundles)' : '');
   const cacheNames = await caches.keys();
   await Promise.all(cacheNames.map(name => {
+    if (keepBundles && name === BUNDLE_CACHE_NAME) return;
     console.log('[ServiceWorker] Deleting cache:', name);
     return caches.delete(name);
   }));
@@ -155,8 +191,8 @@ async function checkForUpdatesAndClearIfNeeded() {
     console.log('[ServiceWorker] Old:', storedVersion.buildId);
     console.log('[ServiceWorker] New:', remoteVersion.buildId);
     
-    // Clear all caches
-    await clearAllCaches();
+    // Clear all caches except unchanged bundles
+    await clearAllCaches(true);
     
     // Store new version
     await caches.open(CACHE_NAME);
@@ -204,7 +240,7 @@ self.addEventListener('activate', (event) => {
       const cacheNames = await caches.keys();
       await Promise.all(
         cacheNames.map((cacheName) => {
-          if (cacheName !== CACHE_NAME) {
+          if (cacheName !== CACHE_NAME && cacheName !== BUNDLE_CACHE_NAME) {
             console.log('[ServiceWorker] Deleting old cache:', cacheName);
             return caches.delete(cacheName);
           }
@@ -314,6 +350,52 @@ self.addEventListener('fetch', (event) => {
     return;
   }
   
+  // Bundle manifest: network-first (cached for offline), and prune bundles it no longer lists
+  if (isBundleManifest(url)) {
+    event.respondWith(
+      (async () => {
+        try {
+          const response = await fetch(event.request, { cache: 'no-store' });
+          if (response && response.status === 200) {
+            const responseToCache = response.clone();
+            response.clone().json().then(pruneBundleCache).catch(() => {});
+            caches.open(CACHE_NAME).then((cache) => cache.put(event.request, responseToCache)).catch(() => {});
+          }
+          return response;
+        } catch (err) {
+          const cachedResponse = await caches.match(event.request);
+          return cachedResponse || new Response('Bundle manifest not cached', { status: 503 });
+        }
+      })()
+    );
+    return;
+  }
+  
+  // Asset bundles: cache-first forever - the content hash in the name is the version
+  if (isBundleFile(url)) {
+    event.respondWith(
+      (async () => {
+        const cache = await caches.open(BUNDLE_CACHE_NAME);
+        const cachedResponse = await cache.match(event.request);
+        if (cachedResponse) {
+          return cachedResponse;
+        }
+        
+        try {
+          const response = await fetch(event.request);
+          if (response && response.status === 200) {
+            cache.put(event.request, response.clone()).catch(() => {});
+          }
+          return response;
+        } catch (err) {
+          console.warn('[ServiceWorker] Failed to fetch bundle:', url.pathname, err.message);
+          return new Response('Bundle not cached - please connect to internet', { status: 503 });
+        }
+      })()
+    );
+    return;
+  }
+  
   // For Unity build files, use cache-first (they're big and versioned by buildId)
   // CRITICAL: These MUST be served from cache when offline - iOS Safari can fail fetch before cache lookup
   if (url.pathname.includes('/Build/')) {
@@ -169,10 +169,12 @@ const VersionChecker = (function() {
 
   /**
    * Clears all service worker caches
+   * keepBundles leaves the content-hashed asset bundle cache (see sw.js) so an update only
+   * re-downloads bundles whose hash changed
    * Always returns gracefully - never throws
    */
-  async function clearAllCaches() {
-    log('Clearing all caches...');
+  async function clearAllCaches(keepBundles = false) {
+    log('Clearing all caches...', keepBundles ? '(keeping bundles)' : '');
     
     try {
       if (typeof caches === 'undefined') {
@@ -185,6 +187,7 @@ const VersionChecker = (function() {
       await Promise.all(
         cacheNames.map(name => {
           try {
+            if (keepBundles && name.startsWith('unity-bundle-cache-')) return Promise.resolve();
             log('Deleting cache:', name);
             return caches.delete(name);
           } catch (e) {
@@ -348,8 +351,8 @@ const VersionChecker = (function() {
       log('Update detected! Clearing caches and reloading...');
       updateLoadingMessage('New version found! Updating...');
       
-      // Clear all caches
-      await clearAllCaches();
+      // Clear all caches except unchanged bundles
+      await clearAllCaches(true);
       
       // Refresh service worker
       await refreshServiceWorker();
@@ -0,0 +1,64 @@
+# Unity Wave Benchmark Script (PowerShell)
+# Usage: .\scripts\unity-benchmark.ps1 [output.json] [extra benchmark args...]
+#
+# Runs the deterministic wave-scaling benchmark (WaveBenchmark) in batch mode and writes a JSON
+# report with frame-time percentiles, FixedUpdate cost, GC allocations and peak memory per wave.
+# Example: .\scripts\unity-benchmark.ps1 bench.json -benchmarkWaves 50,500 -benchmarkSeed 7
+
+$ErrorActionPreference = "Stop"
+
+$ProjectPath = Split-Path -Parent (Split-Path -Parent $MyInvocation.MyCommand.Path)
+$LogFile = "$env:TEMP\unity_benchmark.log"
+$UnityVersion = "6000.3.6f1"  # Update this to match your Unity version
+$UnityPath = "C:\Program Files\Unity\Hub\Editor\$UnityVersion\Editor\Unity.exe"
+
+$Output = if ($args.Count -gt 0) { $args[0] } else { Join-Path $ProjectPath "wave-benchmark.json" }
+$ExtraArgs = if ($args.Count -gt 1) { $args[1..($args.Count - 1)] } else { @() }
+
+Write-Host "📊 Unity Wave Benchmark" -ForegroundColor Cyan
+Write-Host "=======================" -ForegroundColor Cyan
+Write-Host "Project: $ProjectPath"
+Write-Host "Output:  $Output"
+Write-Host "Unity: $UnityPath"
+Write-Host ""
+
+if (-not (Test-Path $UnityPath)) {
+    Write-Host "❌ Unity not found at: $UnityPath" -ForegroundColor Red
+    Write-Host "   Install Unity $UnityVersion via Unity Hub or update the `$UnityVersion variable in this script."
+    exit 1
+}
+
+if (Test-Path $Output) { Remove-Item $Output }
+
+Write-Host "⏳ Running benchmark (compiles first, then plays every wave)..." -ForegroundColor Yellow
+Write-Host ""
+
+# No -quit: the harness exits the editor once the report is written
+$process = Start-Process -FilePath $UnityPath -ArgumentList (@(
+    "-batchmode",
+    "-projectPath", $ProjectPath,
+    "-executeMethod", "WaveBenchmarkCli.Run",
+    "-benchmarkOut", $Output,
+    "-logFile", $LogFile
+) + $ExtraArgs) -Wait -PassThru -NoNewWindow
+
+Write-Host ""
+Write-Host "=======================" -ForegroundColor Cyan
+
+$benchmarkLines = Select-String -Path $LogFile -Pattern "\[WaveBenchmark\]" -ErrorAction SilentlyContinue
+
+if ($process.ExitCode -eq 0 -and (Test-Path $Output)) {
+    Write-Host "✅ BENCHMARK COMPLETE" -ForegroundColor Green
+    Write-Host ""
+    $benchmarkLines | ForEach-Object { Write-Host "   $($_.Line)" }
+    Write-Host ""
+    Write-Host "Report: $Output"
+    exit 0
+} else {
+    Write-Host "❌ BENCHMARK FAILED (exit code $($process.ExitCode))" -ForegroundColor Red
+    Write-Host ""
+    $benchmarkLines | Select-Object -First 20 | ForEach-Object { Write-Host "   $($_.Line)" }
+    Write-Host ""
+    Write-Host "Full log: $LogFile"
+    exit 1
+}
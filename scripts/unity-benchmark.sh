@@ -0,0 +1,89 @@
+#!/bin/bash
+# Unity Wave Benchmark Script
+# Usage: ./scripts/unity-benchmark.sh [output.json] [extra benchmark args...]
+#
+# Runs the deterministic wave-scaling benchmark (WaveBenchmark) in batch mode and writes a JSON
+# report with frame-time percentiles, FixedUpdate cost, GC allocations and peak memory per wave.
+# Example: ./scripts/unity-benchmark.sh bench.json -benchmarkWaves 50,500 -benchmarkSeed 7
+# Compare two reports from different branches to catch regressions before a WebGL deploy.
+
+set -e
+
+PROJECT_PATH="$(cd "$(dirname "$0")/.." && pwd)"
+LOG_FILE="/tmp/unity_benchmark.log"
+OUTPUT="${1:-$PROJECT_PATH/wave-benchmark.json}"
+shift || true
+
+echo "📊 Unity Wave Benchmark"
+echo "======================="
+echo "Project: $PROJECT_PATH"
+echo "Output:  $OUTPUT"
+echo ""
+
+# Detect OS and set Unity path
+detect_unity_path() {
+    local version="6000.3.6f1"  # Update this to match your Unity version
+    
+    case "$(uname -s)" in
+        Darwin*)
+            UNITY_PATH="/Applications/Unity/Hub/Editor/$version/Unity.app/Contents/MacOS/Unity"
+            ;;
+        Linux*)
+            UNITY_PATH="$HOME/Unity/Hub/Editor/$version/Editor/Unity"
+            ;;
+        MINGW*|MSYS*|CYGWIN*)
+            UNITY_PATH="/c/Program Files/Unity/Hub/Editor/$version/Editor/Unity.exe"
+            ;;
+        *)
+            echo "❌ Unknown OS: $(uname -s)"
+            exit 1
+            ;;
+    esac
+    
+    echo "Unity: $UNITY_PATH"
+}
+
+detect_unity_path
+
+if [ ! -f "$UNITY_PATH" ]; then
+    echo "❌ Unity not found at: $UNITY_PATH"
+    echo "   Install Unity via Unity Hub or update the 'version' variable in this script."
+    exit 1
+fi
+
+rm -f "$OUTPUT"
+
+echo ""
+echo "⏳ Running benchmark (compiles first, then plays every wave)..."
+echo ""
+
+# No -quit: the harness exits the editor once the report is written
+set +e
+"$UNITY_PATH" \
+    -batchmode \
+    -projectPath "$PROJECT_PATH" \
+    -executeMethod WaveBenchmarkCli.Run \
+    -benchmarkOut "$OUTPUT" \
+    -logFile "$LOG_FILE" \
+    "$@" 2>&1
+EXIT_CODE=$?
+set -e
+
+echo ""
+echo "======================="
+
+if [ $EXIT_CODE -eq 0 ] && [ -f "$OUTPUT" ]; then
+    echo "✅ BENCHMARK COMPLETE"
+    echo ""
+    grep "\[WaveBenchmark\]" "$LOG_FILE" | sed 's/^/   /'
+    echo ""
+    echo "Report: $OUTPUT"
+    exit 0
+else
+    echo "❌ BENCHMARK FAILED (exit code $EXIT_CODE)"
+    echo ""
+    grep -E "\[WaveBenchmark\]|Assets/Scripts.*error CS" "$LOG_FILE" 2>/dev/null | head -20
+    echo ""
+    echo "Full log: $LOG_FILE"
+    exit 1
+fi